@@ -0,0 +1,83 @@
+#include "Benchmark.hpp"
+#include "BenchmarkData.hpp"
+
+#include "math/Arithmetic.hpp"
+#include "math/Angle.hpp"
+
+
+template <typename TValueType>
+static void BM_Round(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Round(values[index]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Wrap(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Wrap(values[index], static_cast<TValueType>(-1), static_cast<TValueType>(3)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_SquareRoot(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::SquareRoot(math::Absolute(values[index])));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_RadianRad(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Radian<TValueType>(values[index]).Rad());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_DegreeRad(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Degree<TValueType>(values[index] * static_cast<TValueType>(40)).Rad());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+
+BENCHMARK_TEMPLATE(BM_Round, float);
+BENCHMARK_TEMPLATE(BM_Round, double);
+BENCHMARK_TEMPLATE(BM_Wrap, float);
+BENCHMARK_TEMPLATE(BM_Wrap, double);
+BENCHMARK_TEMPLATE(BM_SquareRoot, float);
+BENCHMARK_TEMPLATE(BM_SquareRoot, double);
+BENCHMARK_TEMPLATE(BM_RadianRad, float);
+BENCHMARK_TEMPLATE(BM_RadianRad, double);
+BENCHMARK_TEMPLATE(BM_DegreeRad, float);
+BENCHMARK_TEMPLATE(BM_DegreeRad, double);
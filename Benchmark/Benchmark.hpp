@@ -0,0 +1,178 @@
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Minimal Google Benchmark style harness: functions take a State and
+// loop with `for (auto _ : state)`, each pass through the loop is one op.
+// Iterations grow until a run lasts long enough to be measured
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCH_UNUSED __attribute__((unused))
+#else
+#define BENCH_UNUSED
+#endif
+
+namespace bench
+{
+    // Loop variable type, never read
+    struct BENCH_UNUSED LoopValue {};
+
+
+    class State
+    {
+    public:
+
+        class Iterator
+        {
+        public:
+
+            explicit Iterator(std::int64_t remaining) : m_remaining(remaining) {}
+
+            LoopValue       operator*(void) const { return {}; }
+            Iterator&       operator++(void) { --m_remaining; return *this; }
+            bool            operator!=(const Iterator&) const { return m_remaining > 0; }
+
+        private:
+
+            std::int64_t    m_remaining;
+        };
+
+
+        explicit State(std::int64_t iterations) : m_iterations(iterations) {}
+
+        Iterator        begin(void)
+        {
+            m_start = std::chrono::steady_clock::now();
+            return Iterator(m_iterations);
+        }
+
+        Iterator        end(void)
+        {
+            return Iterator(0);
+        }
+
+        // Stop the clock, called once the loop is over
+        void            Stop(void)
+        {
+            m_elapsed = std::chrono::steady_clock::now() - m_start;
+        }
+
+        // Items handled per op, for batch functions
+        void            SetItemsPerOp(std::int64_t items) { m_itemsPerOp = items; }
+
+        std::int64_t    Iterations(void) const { return m_iterations; }
+        std::int64_t    ItemsPerOp(void) const { return m_itemsPerOp; }
+        double          Seconds(void) const { return std::chrono::duration<double>(m_elapsed).count(); }
+
+    private:
+
+        std::chrono::steady_clock::time_point   m_start;
+        std::chrono::steady_clock::duration     m_elapsed {};
+        std::int64_t                            m_iterations;
+        std::int64_t                            m_itemsPerOp = 1;
+    };
+
+
+    // Keep the compiler from discarding a result
+    template <typename TValueType> inline
+    void DoNotOptimize(TValueType const& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void*     sink;
+
+        sink = &value;
+#endif
+    }
+
+
+    using BenchmarkFunction = void (*)(State&);
+
+    struct Benchmark
+    {
+        std::string         m_name;
+        BenchmarkFunction   m_function;
+    };
+
+
+    inline std::vector<Benchmark>& Registry(void)
+    {
+        static std::vector<Benchmark>   benchmarks;
+
+        return benchmarks;
+    }
+
+
+    struct Registrar
+    {
+        Registrar(const char* name, BenchmarkFunction function)
+        {
+            Registry().push_back({ name, function });
+        }
+    };
+
+
+    // Run every benchmark whose name contains filter (all if null)
+    inline int RunAll(const char* filter)
+    {
+        constexpr double        minSeconds = 0.2;
+
+        std::printf("%-44s %14s %12s %16s\n", "Benchmark", "Iterations", "ns/op", "Mitems/s");
+
+        for (const Benchmark& benchmark : Registry())
+        {
+            if (filter && !std::strstr(benchmark.m_name.c_str(), filter))
+                continue;
+
+            std::int64_t    iterations = 1;
+
+            while (true)
+            {
+                State       state(iterations);
+
+                benchmark.m_function(state);
+                state.Stop();
+
+                const double    seconds = state.Seconds();
+
+                if (seconds >= minSeconds || iterations >= (std::int64_t(1) << 40))
+                {
+                    const double    nsPerOp = seconds * 1e9 / static_cast<double>(iterations);
+                    const double    items = static_cast<double>(iterations * state.ItemsPerOp());
+
+                    std::printf("%-44s %14lld %12.3f %16.2f\n", benchmark.m_name.c_str(),
+                                static_cast<long long>(iterations), nsPerOp, items / seconds * 1e-6);
+                    break;
+                }
+
+                // Aim slightly past the target from the current rate
+                const double    scale = (seconds > 0.0) ? minSeconds * 1.4 / seconds : 100.0;
+
+                iterations = static_cast<std::int64_t>(static_cast<double>(iterations) *
+                                                       (scale > 100.0 ? 100.0 : scale)) + 1;
+            }
+        }
+
+        return 0;
+    }
+}
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+// Register a function taking a bench::State&
+#define BENCHMARK(function) \
+    static bench::Registrar BENCH_CONCAT(s_registrar, __LINE__)(#function, function)
+
+// Register a function template instantiated for one type
+#define BENCHMARK_TEMPLATE(function, type) \
+    static bench::Registrar BENCH_CONCAT(s_registrar, __LINE__)(#function "<" #type ">", function<type>)
+
+#endif
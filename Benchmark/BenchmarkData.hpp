@@ -0,0 +1,223 @@
+#ifndef __BENCHMARK_DATA_H__
+#define __BENCHMARK_DATA_H__
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "math/Vector3.hpp"
+#include "math/Vector4.hpp"
+#include "math/Matrix4.hpp"
+#include "math/MatrixN.hpp"
+#include "math/Quaternion.hpp"
+#include "math/AABB.hpp"
+
+// Inputs are read from fixed-size random pools so the compiler cannot
+// fold ops on constants, and the pools stay in L1/L2 cache
+
+namespace bench
+{
+    constexpr std::size_t       POOL_SIZE = 1024;
+    constexpr std::size_t       POOL_MASK = POOL_SIZE - 1;
+
+
+    template <typename TValueType> inline
+    TValueType RandomValue(std::mt19937& engine, double low, double high)
+    {
+        std::uniform_real_distribution<double>  distribution(low, high);
+
+        return static_cast<TValueType>(distribution(engine));
+    }
+
+
+    template <typename TValueType> inline
+    const std::vector<TValueType>& ScalarPool(void)
+    {
+        static const std::vector<TValueType>    pool = []
+        {
+            std::mt19937                engine(42);
+            std::vector<TValueType>     values(POOL_SIZE);
+
+            for (TValueType& value : values)
+                value = RandomValue<TValueType>(engine, -10.0, 10.0);
+
+            return values;
+        }();
+
+        return pool;
+    }
+
+
+    template <typename TValueType> inline
+    const std::vector<math::Vector3<TValueType>>& Vector3Pool(void)
+    {
+        static const std::vector<math::Vector3<TValueType>>  pool = []
+        {
+            std::mt19937                                engine(7);
+            std::vector<math::Vector3<TValueType>>      vectors(POOL_SIZE);
+
+            for (math::Vector3<TValueType>& vector : vectors)
+            {
+                vector = math::Vector3<TValueType>(RandomValue<TValueType>(engine, 0.1, 10.0),
+                                                   RandomValue<TValueType>(engine, -10.0, 10.0),
+                                                   RandomValue<TValueType>(engine, -10.0, 10.0));
+            }
+
+            return vectors;
+        }();
+
+        return pool;
+    }
+
+
+    template <typename TValueType> inline
+    const std::vector<math::Vector4<TValueType>>& Vector4Pool(void)
+    {
+        static const std::vector<math::Vector4<TValueType>>  pool = []
+        {
+            std::mt19937                                engine(11);
+            std::vector<math::Vector4<TValueType>>      vectors(POOL_SIZE);
+
+            for (math::Vector4<TValueType>& vector : vectors)
+            {
+                vector = math::Vector4<TValueType>(RandomValue<TValueType>(engine, 0.1, 10.0),
+                                                   RandomValue<TValueType>(engine, -10.0, 10.0),
+                                                   RandomValue<TValueType>(engine, -10.0, 10.0),
+                                                   RandomValue<TValueType>(engine, -10.0, 10.0));
+            }
+
+            return vectors;
+        }();
+
+        return pool;
+    }
+
+
+    // Rigid transforms, always invertible
+    template <typename TValueType> inline
+    const std::vector<math::Matrix4<TValueType>>& Matrix4Pool(void)
+    {
+        static const std::vector<math::Matrix4<TValueType>>  pool = []
+        {
+            std::mt19937                                engine(13);
+            std::vector<math::Matrix4<TValueType>>      matrices(POOL_SIZE);
+
+            for (math::Matrix4<TValueType>& matrix : matrices)
+            {
+                const math::Vector3<TValueType>     position(RandomValue<TValueType>(engine, -10.0, 10.0),
+                                                             RandomValue<TValueType>(engine, -10.0, 10.0),
+                                                             RandomValue<TValueType>(engine, -10.0, 10.0));
+
+                matrix = math::Matrix4<TValueType>::PositionMatrix(position) *
+                         math::Matrix4<TValueType>::RotationMatrix(
+                             math::Radian<TValueType>(RandomValue<TValueType>(engine, -3.0, 3.0)),
+                             math::Radian<TValueType>(RandomValue<TValueType>(engine, -3.0, 3.0)),
+                             math::Radian<TValueType>(RandomValue<TValueType>(engine, -3.0, 3.0)));
+            }
+
+            return matrices;
+        }();
+
+        return pool;
+    }
+
+
+    template <typename TValueType> inline
+    const std::vector<math::Quaternion<TValueType>>& QuaternionPool(void)
+    {
+        static const std::vector<math::Quaternion<TValueType>>   pool = []
+        {
+            std::mt19937                                    engine(17);
+            std::vector<math::Quaternion<TValueType>>       quaternions;
+
+            quaternions.reserve(POOL_SIZE);
+
+            for (std::size_t index = 0; index < POOL_SIZE; ++index)
+            {
+                quaternions.emplace_back(math::Radian<TValueType>(RandomValue<TValueType>(engine, -3.0, 3.0)),
+                                         math::Radian<TValueType>(RandomValue<TValueType>(engine, -3.0, 3.0)),
+                                         math::Radian<TValueType>(RandomValue<TValueType>(engine, -3.0, 3.0)));
+            }
+
+            return quaternions;
+        }();
+
+        return pool;
+    }
+
+
+    // Random values with a dominant diagonal, always invertible
+    template <typename TValueType> inline
+    const std::vector<math::Matrix6<TValueType>>& Matrix6Pool(void)
+    {
+        static const std::vector<math::Matrix6<TValueType>>  pool = []
+        {
+            std::mt19937                                engine(19);
+            std::vector<math::Matrix6<TValueType>>      matrices(POOL_SIZE);
+
+            for (math::Matrix6<TValueType>& matrix : matrices)
+            {
+                for (int column = 0; column < 6; ++column)
+                {
+                    for (int row = 0; row < 6; ++row)
+                        matrix(row, column) = RandomValue<TValueType>(engine, -1.0, 1.0) + ((row == column) ? 10 : 0);
+                }
+            }
+
+            return matrices;
+        }();
+
+        return pool;
+    }
+
+
+    template <typename TValueType> inline
+    const std::vector<math::Vector6<TValueType>>& Vector6Pool(void)
+    {
+        static const std::vector<math::Vector6<TValueType>>  pool = []
+        {
+            std::mt19937                                engine(23);
+            std::vector<math::Vector6<TValueType>>      vectors(POOL_SIZE);
+
+            for (math::Vector6<TValueType>& vector : vectors)
+            {
+                for (int index = 0; index < 6; ++index)
+                    vector[index] = RandomValue<TValueType>(engine, -10.0, 10.0);
+            }
+
+            return vectors;
+        }();
+
+        return pool;
+    }
+
+
+    // Small boxes scattered in the same space as Matrix4Pool's positions
+    template <typename TValueType> inline
+    const std::vector<math::AABB3<TValueType>>& AABB3Pool(void)
+    {
+        static const std::vector<math::AABB3<TValueType>>    pool = []
+        {
+            std::mt19937                                engine(29);
+            std::vector<math::AABB3<TValueType>>        boxes(POOL_SIZE);
+
+            for (math::AABB3<TValueType>& box : boxes)
+            {
+                const math::Vector3<TValueType>     center(RandomValue<TValueType>(engine, -10.0, 10.0),
+                                                           RandomValue<TValueType>(engine, -10.0, 10.0),
+                                                           RandomValue<TValueType>(engine, -10.0, 10.0));
+                const math::Vector3<TValueType>     extents(RandomValue<TValueType>(engine, 0.1, 1.0),
+                                                            RandomValue<TValueType>(engine, 0.1, 1.0),
+                                                            RandomValue<TValueType>(engine, 0.1, 1.0));
+
+                box = math::AABB3<TValueType>::FromCenterExtents(center, extents);
+            }
+
+            return boxes;
+        }();
+
+        return pool;
+    }
+}
+
+#endif
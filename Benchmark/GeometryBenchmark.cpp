@@ -0,0 +1,618 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BenchmarkData.hpp"
+
+#include "math/AABB.hpp"
+#include "math/AABB3Stream.hpp"
+#include "math/BVH.hpp"
+#include "math/Intersection.hpp"
+
+
+// Rolling terrain, 256 x 256 quads (131072 triangles) over [-128, 128]
+// on x and z, as in line of sight queries between units
+template <typename TValueType>
+static const std::vector<math::Vector3<TValueType>>& TerrainTriangles(void)
+{
+    static const std::vector<math::Vector3<TValueType>>  triangles = []
+    {
+        constexpr int                               size = 256;
+        std::vector<math::Vector3<TValueType>>      result;
+
+        const auto          vertex = [](int x, int z)
+        {
+            const TValueType    height = static_cast<TValueType>(4) *
+                                         std::sin(static_cast<TValueType>(x) * static_cast<TValueType>(0.1)) *
+                                         std::cos(static_cast<TValueType>(z) * static_cast<TValueType>(0.07));
+
+            return math::Vector3<TValueType>(static_cast<TValueType>(x - size / 2), height,
+                                             static_cast<TValueType>(z - size / 2));
+        };
+
+        result.reserve(6 * size * size);
+
+        for (int z = 0; z < size; ++z)
+        {
+            for (int x = 0; x < size; ++x)
+            {
+                result.push_back(vertex(x, z));
+                result.push_back(vertex(x + 1, z));
+                result.push_back(vertex(x, z + 1));
+
+                result.push_back(vertex(x + 1, z));
+                result.push_back(vertex(x + 1, z + 1));
+                result.push_back(vertex(x, z + 1));
+            }
+        }
+
+        return result;
+    }();
+
+    return triangles;
+}
+
+
+template <typename TValueType>
+static const math::TriangleBVH<TValueType>& TerrainBVH(void)
+{
+    static const math::TriangleBVH<TValueType>   bvh = []
+    {
+        math::TriangleBVH<TValueType>   result;
+
+        result.Build(TerrainTriangles<TValueType>());
+        return result;
+    }();
+
+    return bvh;
+}
+
+
+// Ray from a point a few units above the terrain to another
+template <typename TValueType>
+static void TerrainRay(std::size_t index, math::Vector3<TValueType>& origin, math::Vector3<TValueType>& direction)
+{
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    const auto&     start = vectors[index];
+    const auto&     end = vectors[(index + 1) & bench::POOL_MASK];
+    const auto      scale = static_cast<TValueType>(10);
+
+    origin = math::Vector3<TValueType>(start.GetY() * scale, start.GetX(), start.GetZ() * scale);
+    direction = math::Vector3<TValueType>(end.GetY() * scale, end.GetX(), end.GetZ() * scale) - origin;
+}
+
+
+// Pool rays as structure-of-arrays: origin i is vector i, direction i
+// points to vector i + 1
+template <typename TValueType>
+static const math::Vector3Stream<TValueType>& RayOrigins(void)
+{
+    static const math::Vector3Stream<TValueType>    origins(bench::Vector3Pool<TValueType>());
+
+    return origins;
+}
+
+
+template <typename TValueType>
+static const math::Vector3Stream<TValueType>& RayDirections(void)
+{
+    static const math::Vector3Stream<TValueType>    directions = []
+    {
+        const auto&                         vectors = bench::Vector3Pool<TValueType>();
+        math::Vector3Stream<TValueType>     result(vectors.size());
+
+        for (std::size_t index = 0; index < vectors.size(); ++index)
+            result.Set(index, vectors[(index + 1) & bench::POOL_MASK] - vectors[index]);
+
+        return result;
+    }();
+
+    return directions;
+}
+
+
+template <typename TValueType>
+static void BM_AABB3Overlaps(bench::State& state)
+{
+    const auto&     boxes = bench::AABB3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(boxes[index].Overlaps(boxes[(index + 1) & bench::POOL_MASK]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_AABB3Transform(bench::State& state)
+{
+    const auto&     boxes = bench::AABB3Pool<TValueType>();
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(boxes[index].Transformed(matrices[index]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_AABB3IntersectRay(bench::State& state)
+{
+    const auto&     boxes = bench::AABB3Pool<TValueType>();
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        const auto&     direction = vectors[(index + 1) & bench::POOL_MASK];
+        TValueType      distance;
+
+        const math::Vector3<TValueType>     inverseDirection(static_cast<TValueType>(1) / direction.GetX(),
+                                                             static_cast<TValueType>(1) / direction.GetY(),
+                                                             static_cast<TValueType>(1) / direction.GetZ());
+
+        bench::DoNotOptimize(boxes[index].IntersectRay(vectors[index], inverseDirection, static_cast<TValueType>(0),
+                                                       static_cast<TValueType>(100), distance));
+        bench::DoNotOptimize(distance);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// One box against the whole pool, box after box
+template <typename TValueType>
+static void BM_AABB3OverlapsLoop(bench::State& state)
+{
+    const auto&             boxes = bench::AABB3Pool<TValueType>();
+    std::vector<uint8_t>    results(boxes.size());
+    std::size_t             index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(boxes.size()));
+
+    for (auto _ : state)
+    {
+        const auto&     query = boxes[index];
+
+        for (std::size_t other = 0; other < boxes.size(); ++other)
+            results[other] = static_cast<uint8_t>(query.Overlaps(boxes[other]));
+
+        bench::DoNotOptimize(results.data());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Same as BM_AABB3OverlapsLoop with structure-of-arrays boxes
+template <typename TValueType>
+static void BM_AABB3StreamOverlaps(bench::State& state)
+{
+    const auto&                         boxes = bench::AABB3Pool<TValueType>();
+    const math::AABB3Stream<TValueType> stream(boxes);
+    std::vector<uint8_t>                results(boxes.size());
+    std::size_t                         index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(boxes.size()));
+
+    for (auto _ : state)
+    {
+        math::Overlaps(stream, boxes[index], std::span<uint8_t>(results));
+        bench::DoNotOptimize(results.data());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_AABB3StreamOverlapIndices(bench::State& state)
+{
+    const auto&                         boxes = bench::AABB3Pool<TValueType>();
+    const math::AABB3Stream<TValueType> stream(boxes);
+    std::vector<uint32_t>               indices;
+    std::size_t                         index = 0;
+
+    indices.reserve(boxes.size());
+    state.SetItemsPerOp(static_cast<std::int64_t>(boxes.size()));
+
+    for (auto _ : state)
+    {
+        indices.clear();
+        bench::DoNotOptimize(math::Overlaps(stream, boxes[index], indices));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Closest hit over the whole segment
+template <typename TValueType>
+static void BM_TriangleBVHRaycast(bench::State& state)
+{
+    const auto&     bvh = TerrainBVH<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        math::Vector3<TValueType>                       origin, direction;
+        typename math::TriangleBVH<TValueType>::RayHit  hit;
+
+        TerrainRay(index, origin, direction);
+        bench::DoNotOptimize(bvh.Raycast(origin, direction, static_cast<TValueType>(1), hit));
+        bench::DoNotOptimize(hit);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Line of sight
+template <typename TValueType>
+static void BM_TriangleBVHAnyHit(bench::State& state)
+{
+    const auto&     bvh = TerrainBVH<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        math::Vector3<TValueType>   origin, direction;
+
+        TerrainRay(index, origin, direction);
+        bench::DoNotOptimize(bvh.AnyHit(origin, direction, static_cast<TValueType>(1)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Same query as BM_TriangleBVHRaycast, testing every triangle
+template <typename TValueType>
+static void BM_TriangleBruteForceRaycast(bench::State& state)
+{
+    const auto&     triangles = TerrainTriangles<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        math::Vector3<TValueType>   origin, direction;
+        TValueType                  closest = static_cast<TValueType>(1), distance, u, v;
+        bool                        hit = false;
+
+        TerrainRay(index, origin, direction);
+
+        for (std::size_t vertex = 0; vertex < triangles.size(); vertex += 3)
+        {
+            if (math::IntersectRayTriangle(origin, direction, triangles[vertex], triangles[vertex + 1],
+                                           triangles[vertex + 2], closest, distance, u, v))
+            {
+                closest = distance;
+                hit = true;
+            }
+        }
+
+        bench::DoNotOptimize(hit);
+        bench::DoNotOptimize(closest);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_TriangleBVHClosestPoint(bench::State& state)
+{
+    const auto&     bvh = TerrainBVH<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        math::Vector3<TValueType>                           origin, direction;
+        typename math::TriangleBVH<TValueType>::PointHit    hit;
+
+        TerrainRay(index, origin, direction);
+        bench::DoNotOptimize(bvh.ClosestPoint(origin, hit));
+        bench::DoNotOptimize(hit);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_TriangleBVHOverlaps(bench::State& state)
+{
+    const auto&             bvh = TerrainBVH<TValueType>();
+    std::vector<uint32_t>   triangles;
+    std::size_t             index = 0;
+
+    for (auto _ : state)
+    {
+        math::Vector3<TValueType>   origin, direction;
+
+        TerrainRay(index, origin, direction);
+        triangles.clear();
+
+        const math::Vector3<TValueType>     extents(static_cast<TValueType>(2));
+        const auto                          box = math::AABB3<TValueType>::FromCenterExtents(origin, extents);
+
+        bench::DoNotOptimize(bvh.Overlaps(box, triangles));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_TriangleBVHBuild(bench::State& state)
+{
+    const auto&                     triangles = TerrainTriangles<TValueType>();
+    math::TriangleBVH<TValueType>   bvh;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(triangles.size() / 3));
+
+    for (auto _ : state)
+    {
+        bvh.Build(triangles);
+        bench::DoNotOptimize(bvh.GetBVH().Nodes().data());
+    }
+}
+
+template <typename TValueType>
+static void BM_TriangleBVHRefit(bench::State& state)
+{
+    const auto&                     triangles = TerrainTriangles<TValueType>();
+    math::TriangleBVH<TValueType>   bvh = TerrainBVH<TValueType>();
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(triangles.size() / 3));
+
+    for (auto _ : state)
+    {
+        bvh.Refit(triangles);
+        bench::DoNotOptimize(bvh.GetBVH().Nodes().data());
+    }
+}
+
+// Pool rays against one triangle, ray after ray
+template <typename TValueType>
+static void BM_RayTriangleLoop(bench::State& state)
+{
+    const auto&                 origins = RayOrigins<TValueType>();
+    const auto&                 directions = RayDirections<TValueType>();
+    const auto&                 vectors = bench::Vector3Pool<TValueType>();
+    std::vector<TValueType>     distances(origins.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(origins.Size()));
+
+    for (auto _ : state)
+    {
+        const auto&     a = vectors[index];
+        const auto&     b = vectors[(index + 1) & bench::POOL_MASK];
+        const auto&     c = vectors[(index + 2) & bench::POOL_MASK];
+
+        for (std::size_t ray = 0; ray < origins.Size(); ++ray)
+        {
+            TValueType      u, v;
+
+            distances[ray] = static_cast<TValueType>(2);
+            math::IntersectRayTriangle(origins.Get(ray), directions.Get(ray), a, b, c, distances[ray],
+                                       distances[ray], u, v);
+        }
+
+        bench::DoNotOptimize(distances.data());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Same as BM_RayTriangleLoop, one SIMD packet of rays at a time
+template <typename TValueType>
+static void BM_RayTriangleBatch(bench::State& state)
+{
+    const auto&                 origins = RayOrigins<TValueType>();
+    const auto&                 directions = RayDirections<TValueType>();
+    const auto&                 vectors = bench::Vector3Pool<TValueType>();
+    std::vector<TValueType>     distances(origins.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(origins.Size()));
+
+    for (auto _ : state)
+    {
+        std::fill(distances.begin(), distances.end(), static_cast<TValueType>(2));
+        bench::DoNotOptimize(math::IntersectRayTriangle(origins, directions, vectors[index],
+                                                        vectors[(index + 1) & bench::POOL_MASK],
+                                                        vectors[(index + 2) & bench::POOL_MASK],
+                                                        std::span<TValueType>(distances)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_RaySphereLoop(bench::State& state)
+{
+    const auto&                 origins = RayOrigins<TValueType>();
+    const auto&                 directions = RayDirections<TValueType>();
+    const auto&                 vectors = bench::Vector3Pool<TValueType>();
+    std::vector<TValueType>     distances(origins.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(origins.Size()));
+
+    for (auto _ : state)
+    {
+        for (std::size_t ray = 0; ray < origins.Size(); ++ray)
+        {
+            distances[ray] = static_cast<TValueType>(2);
+            math::IntersectRaySphere(origins.Get(ray), directions.Get(ray), vectors[index],
+                                     static_cast<TValueType>(0.5), distances[ray], distances[ray]);
+        }
+
+        bench::DoNotOptimize(distances.data());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_RaySphereBatch(bench::State& state)
+{
+    const auto&                 origins = RayOrigins<TValueType>();
+    const auto&                 directions = RayDirections<TValueType>();
+    const auto&                 vectors = bench::Vector3Pool<TValueType>();
+    std::vector<TValueType>     distances(origins.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(origins.Size()));
+
+    for (auto _ : state)
+    {
+        std::fill(distances.begin(), distances.end(), static_cast<TValueType>(2));
+        bench::DoNotOptimize(math::IntersectRaySphere(origins, directions, vectors[index],
+                                                      static_cast<TValueType>(0.5),
+                                                      std::span<TValueType>(distances)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_RayBoxLoop(bench::State& state)
+{
+    const auto&                 origins = RayOrigins<TValueType>();
+    const auto&                 directions = RayDirections<TValueType>();
+    const auto&                 boxes = bench::AABB3Pool<TValueType>();
+    std::vector<TValueType>     distances(origins.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(origins.Size()));
+
+    for (auto _ : state)
+    {
+        for (std::size_t ray = 0; ray < origins.Size(); ++ray)
+        {
+            distances[ray] = static_cast<TValueType>(2);
+            math::IntersectRayBox(origins.Get(ray), directions.Get(ray), boxes[index], distances[ray],
+                                  distances[ray]);
+        }
+
+        bench::DoNotOptimize(distances.data());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_RayBoxBatch(bench::State& state)
+{
+    const auto&                 origins = RayOrigins<TValueType>();
+    const auto&                 directions = RayDirections<TValueType>();
+    const auto&                 boxes = bench::AABB3Pool<TValueType>();
+    std::vector<TValueType>     distances(origins.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(origins.Size()));
+
+    for (auto _ : state)
+    {
+        std::fill(distances.begin(), distances.end(), static_cast<TValueType>(2));
+        bench::DoNotOptimize(math::IntersectRayBox(origins, directions, boxes[index],
+                                                   std::span<TValueType>(distances)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_RayPlaneBatch(bench::State& state)
+{
+    const auto&                 origins = RayOrigins<TValueType>();
+    const auto&                 directions = RayDirections<TValueType>();
+    const auto&                 vectors = bench::Vector3Pool<TValueType>();
+    std::vector<TValueType>     distances(origins.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(origins.Size()));
+
+    for (auto _ : state)
+    {
+        std::fill(distances.begin(), distances.end(), static_cast<TValueType>(2));
+        bench::DoNotOptimize(math::IntersectRayPlane(origins, directions, vectors[index],
+                                                     static_cast<TValueType>(0.25),
+                                                     std::span<TValueType>(distances)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Pool points moving to the next one, against one triangle
+template <typename TValueType>
+static void BM_SegmentTriangleBatch(bench::State& state)
+{
+    static const math::Vector3Stream<TValueType>    ends = []
+    {
+        math::Vector3Stream<TValueType>     result = RayOrigins<TValueType>();
+
+        result += RayDirections<TValueType>();
+        return result;
+    }();
+
+    const auto&                 starts = RayOrigins<TValueType>();
+    const auto&                 vectors = bench::Vector3Pool<TValueType>();
+    std::vector<TValueType>     fractions(starts.Size());
+    std::size_t                 index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(starts.Size()));
+
+    for (auto _ : state)
+    {
+        std::fill(fractions.begin(), fractions.end(), static_cast<TValueType>(1));
+        bench::DoNotOptimize(math::IntersectSegmentTriangle(starts, ends, vectors[index],
+                                                            vectors[(index + 1) & bench::POOL_MASK],
+                                                            vectors[(index + 2) & bench::POOL_MASK],
+                                                            std::span<TValueType>(fractions)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_SphereOverlapsBatch(bench::State& state)
+{
+    const auto&                 centers = RayOrigins<TValueType>();
+    const auto&                 vectors = bench::Vector3Pool<TValueType>();
+    std::vector<TValueType>     radii(centers.Size());
+    std::vector<uint8_t>        results(centers.Size());
+    std::size_t                 index = 0;
+
+    for (std::size_t sphere = 0; sphere < radii.size(); ++sphere)
+        radii[sphere] = math::Absolute(vectors[sphere].GetX()) * static_cast<TValueType>(0.25);
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(centers.Size()));
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::OverlapSpheres(centers, std::span<const TValueType>(radii), vectors[index],
+                                                  static_cast<TValueType>(0.5), std::span<uint8_t>(results)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+
+BENCHMARK_TEMPLATE(BM_AABB3Overlaps, float);
+BENCHMARK_TEMPLATE(BM_AABB3Overlaps, double);
+BENCHMARK_TEMPLATE(BM_AABB3Transform, float);
+BENCHMARK_TEMPLATE(BM_AABB3Transform, double);
+BENCHMARK_TEMPLATE(BM_AABB3IntersectRay, float);
+BENCHMARK_TEMPLATE(BM_AABB3IntersectRay, double);
+BENCHMARK_TEMPLATE(BM_AABB3OverlapsLoop, float);
+BENCHMARK_TEMPLATE(BM_AABB3OverlapsLoop, double);
+BENCHMARK_TEMPLATE(BM_AABB3StreamOverlaps, float);
+BENCHMARK_TEMPLATE(BM_AABB3StreamOverlaps, double);
+BENCHMARK_TEMPLATE(BM_AABB3StreamOverlapIndices, float);
+BENCHMARK_TEMPLATE(BM_AABB3StreamOverlapIndices, double);
+BENCHMARK_TEMPLATE(BM_TriangleBVHRaycast, float);
+BENCHMARK_TEMPLATE(BM_TriangleBVHRaycast, double);
+BENCHMARK_TEMPLATE(BM_TriangleBVHAnyHit, float);
+BENCHMARK_TEMPLATE(BM_TriangleBVHAnyHit, double);
+BENCHMARK_TEMPLATE(BM_TriangleBruteForceRaycast, float);
+BENCHMARK_TEMPLATE(BM_TriangleBVHClosestPoint, float);
+BENCHMARK_TEMPLATE(BM_TriangleBVHClosestPoint, double);
+BENCHMARK_TEMPLATE(BM_TriangleBVHOverlaps, float);
+BENCHMARK_TEMPLATE(BM_TriangleBVHOverlaps, double);
+BENCHMARK_TEMPLATE(BM_TriangleBVHBuild, float);
+BENCHMARK_TEMPLATE(BM_TriangleBVHRefit, float);
+BENCHMARK_TEMPLATE(BM_RayTriangleLoop, float);
+BENCHMARK_TEMPLATE(BM_RayTriangleBatch, float);
+BENCHMARK_TEMPLATE(BM_RayTriangleBatch, double);
+BENCHMARK_TEMPLATE(BM_RaySphereLoop, float);
+BENCHMARK_TEMPLATE(BM_RaySphereBatch, float);
+BENCHMARK_TEMPLATE(BM_RaySphereBatch, double);
+BENCHMARK_TEMPLATE(BM_RayBoxLoop, float);
+BENCHMARK_TEMPLATE(BM_RayBoxBatch, float);
+BENCHMARK_TEMPLATE(BM_RayBoxBatch, double);
+BENCHMARK_TEMPLATE(BM_RayPlaneBatch, float);
+BENCHMARK_TEMPLATE(BM_SegmentTriangleBatch, float);
+BENCHMARK_TEMPLATE(BM_SphereOverlapsBatch, float);
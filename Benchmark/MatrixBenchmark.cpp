@@ -0,0 +1,426 @@
+#include <random>
+#include <span>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BenchmarkData.hpp"
+
+#include "math/Matrix4.hpp"
+#include "math/Affine3.hpp"
+#include "math/Quaternion.hpp"
+#include "math/Expression.hpp"
+#include "math/MatrixN.hpp"
+#include "math/TransformHierarchy.hpp"
+#include "math/Parallel.hpp"
+
+
+template <typename TValueType>
+static void BM_Matrix4Multiply(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index] * matrices[(index + 1) & bench::POOL_MASK]);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4MultiplyVector(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    const auto&     vectors = bench::Vector4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index] * vectors[index]);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4Determinant(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index].Determinant());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4Inverse(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index].Inverse());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4InverseAffine(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index].InverseAffine());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4Transpose(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index].Transpose());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4RotationMatrix(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        const math::Radian<TValueType>  angle(values[index]);
+
+        bench::DoNotOptimize(math::Matrix4<TValueType>::RotationMatrix(angle, angle, angle));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Whole pool per op
+template <typename TValueType>
+static void BM_Matrix4TransformPoints(bench::State& state)
+{
+    const auto&                             points = bench::Vector3Pool<TValueType>();
+    const math::Matrix4<TValueType>&        matrix = bench::Matrix4Pool<TValueType>().front();
+    std::vector<math::Vector3<TValueType>>  out(points.size());
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(points.size()));
+
+    for (auto _ : state)
+    {
+        math::TransformPoints(matrix, std::span<const math::Vector3<TValueType>>(points),
+                              std::span<math::Vector3<TValueType>>(out));
+        bench::DoNotOptimize(out.front());
+    }
+}
+
+// Three matrices and two products, as TRS replaces
+template <typename TValueType>
+static void BM_Matrix4TRSProduct(bench::State& state)
+{
+    const auto&     positions = bench::Vector3Pool<TValueType>();
+    const auto&     rotations = bench::QuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        const math::Vector3<TValueType>&    scale = positions[(index + 1) & bench::POOL_MASK];
+
+        bench::DoNotOptimize(math::Matrix4<TValueType>::PositionMatrix(positions[index]) *
+                             rotations[index].RotationMatrix() *
+                             math::Matrix4<TValueType>::ScaleMatrix(scale));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4TRS(bench::State& state)
+{
+    const auto&     positions = bench::Vector3Pool<TValueType>();
+    const auto&     rotations = bench::QuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Matrix4<TValueType>::TRS(positions[index], rotations[index],
+                                                            positions[(index + 1) & bench::POOL_MASK]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Affine3Multiply(bench::State& state)
+{
+    std::vector<math::Affine3<TValueType>>  transforms;
+
+    for (const math::Matrix4<TValueType>& matrix : bench::Matrix4Pool<TValueType>())
+        transforms.emplace_back(matrix);
+
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(transforms[index] * transforms[(index + 1) & bench::POOL_MASK]);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Affine3Inverse(bench::State& state)
+{
+    std::vector<math::Affine3<TValueType>>  transforms;
+
+    for (const math::Matrix4<TValueType>& matrix : bench::Matrix4Pool<TValueType>())
+        transforms.emplace_back(matrix);
+
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(transforms[index].Inverse());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+
+// a * s + b - c, component-wise
+template <typename TValueType>
+static void BM_Matrix4Chain(bench::State& state)
+{
+    const auto&         matrices = bench::Matrix4Pool<TValueType>();
+    const auto&         scalars = bench::ScalarPool<TValueType>();
+    std::size_t         index = 0;
+
+    for (auto _ : state)
+    {
+        const auto&     a = matrices[index];
+        const auto&     b = matrices[(index + 1) & bench::POOL_MASK];
+        const auto&     c = matrices[(index + 2) & bench::POOL_MASK];
+
+        bench::DoNotOptimize(a * scalars[index] + b - c);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4ChainExpression(bench::State& state)
+{
+    const auto&         matrices = bench::Matrix4Pool<TValueType>();
+    const auto&         scalars = bench::ScalarPool<TValueType>();
+    std::size_t         index = 0;
+
+    for (auto _ : state)
+    {
+        const auto&     a = matrices[index];
+        const auto&     b = matrices[(index + 1) & bench::POOL_MASK];
+        const auto&     c = matrices[(index + 2) & bench::POOL_MASK];
+
+        bench::DoNotOptimize(math::expr::Evaluate(math::expr::Lazy(a) * scalars[index] + b - c));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix6Multiply(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix6Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index] * matrices[(index + 1) & bench::POOL_MASK]);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix6MultiplyVector(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix6Pool<TValueType>();
+    const auto&     vectors = bench::Vector6Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index] * vectors[index]);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix6Inverse(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix6Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(matrices[index].Inverse());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// 64k transforms per op, on one thread then split across the default pool
+template <typename TValueType, bool TParallel>
+static void Matrix4TRSBatch(bench::State& state)
+{
+    constexpr std::size_t                       count = 65536;
+    std::vector<math::Vector3<TValueType>>      positions(count);
+    std::vector<math::Quaternion<TValueType>>   rotations(count);
+    std::vector<math::Matrix4<TValueType>>      out(count);
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        positions[index] = bench::Vector3Pool<TValueType>()[index & bench::POOL_MASK];
+        rotations[index] = bench::QuaternionPool<TValueType>()[index & bench::POOL_MASK];
+    }
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(count));
+
+    for (auto _ : state)
+    {
+        if constexpr (TParallel)
+            math::parallel::TRS<TValueType>(positions, rotations, positions, out);
+
+        else
+            math::TRS<TValueType>(positions, rotations, positions, out);
+
+        bench::DoNotOptimize(out.back());
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4TRSBatch(bench::State& state)
+{
+    Matrix4TRSBatch<TValueType, false>(state);
+}
+
+template <typename TValueType>
+static void BM_Matrix4TRSBatchParallel(bench::State& state)
+{
+    Matrix4TRSBatch<TValueType, true>(state);
+}
+
+// 200k nodes, each child close to its parent in memory like a scene
+// loaded depth-first, with a new root every 1000 nodes
+template <typename TValueType>
+static math::TransformHierarchy<TValueType> MakeHierarchy(void)
+{
+    constexpr uint32_t                      nodeCount = 200000;
+    const auto&                             positions = bench::Vector3Pool<TValueType>();
+    const auto&                             rotations = bench::QuaternionPool<TValueType>();
+    std::mt19937                            engine(29);
+    math::TransformHierarchy<TValueType>    hierarchy;
+
+    hierarchy.Reserve(nodeCount);
+
+    for (uint32_t node = 0; node < nodeCount; ++node)
+    {
+        const uint32_t      parent = (node % 1000 == 0) ?
+                                     math::TransformHierarchy<TValueType>::NoParent :
+                                     node - 1 - static_cast<uint32_t>(engine() % math::Min(node % 1000, 64u));
+
+        hierarchy.AddNode(parent, positions[node & bench::POOL_MASK], rotations[node & bench::POOL_MASK]);
+    }
+
+    hierarchy.Update();
+    return hierarchy;
+}
+
+// 2% of the nodes are moved each frame
+template <typename TValueType>
+static void BM_TransformHierarchyUpdate(bench::State& state)
+{
+    math::TransformHierarchy<TValueType>    hierarchy = MakeHierarchy<TValueType>();
+    const auto&                             rotations = bench::QuaternionPool<TValueType>();
+    std::mt19937                            engine(31);
+    std::vector<uint32_t>                   moved(hierarchy.Size() / 50);
+    std::size_t                             index = 0;
+
+    for (uint32_t& node : moved)
+        node = static_cast<uint32_t>(engine() % hierarchy.Size());
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(hierarchy.Size()));
+
+    for (auto _ : state)
+    {
+        for (uint32_t node : moved)
+            hierarchy.SetLocalRotation(node, rotations[index++ & bench::POOL_MASK]);
+
+        hierarchy.Update();
+        bench::DoNotOptimize(hierarchy.WorldMatrices().back());
+    }
+}
+
+// Every root is moved, so every node is recomputed
+template <typename TValueType>
+static void BM_TransformHierarchyUpdateAll(bench::State& state)
+{
+    math::TransformHierarchy<TValueType>    hierarchy = MakeHierarchy<TValueType>();
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(hierarchy.Size()));
+
+    for (auto _ : state)
+    {
+        for (uint32_t node = 0; node < hierarchy.Size(); node += 1000)
+            hierarchy.MarkDirty(node);
+
+        hierarchy.Update();
+        bench::DoNotOptimize(hierarchy.WorldMatrices().back());
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Matrix4Multiply, float);
+BENCHMARK_TEMPLATE(BM_Matrix4Multiply, double);
+BENCHMARK_TEMPLATE(BM_Matrix4MultiplyVector, float);
+BENCHMARK_TEMPLATE(BM_Matrix4MultiplyVector, double);
+BENCHMARK_TEMPLATE(BM_Matrix4Determinant, float);
+BENCHMARK_TEMPLATE(BM_Matrix4Determinant, double);
+BENCHMARK_TEMPLATE(BM_Matrix4Inverse, float);
+BENCHMARK_TEMPLATE(BM_Matrix4Inverse, double);
+BENCHMARK_TEMPLATE(BM_Matrix4InverseAffine, float);
+BENCHMARK_TEMPLATE(BM_Matrix4InverseAffine, double);
+BENCHMARK_TEMPLATE(BM_Matrix4Transpose, float);
+BENCHMARK_TEMPLATE(BM_Matrix4Transpose, double);
+BENCHMARK_TEMPLATE(BM_Matrix4RotationMatrix, float);
+BENCHMARK_TEMPLATE(BM_Matrix4RotationMatrix, double);
+BENCHMARK_TEMPLATE(BM_Matrix4TransformPoints, float);
+BENCHMARK_TEMPLATE(BM_Matrix4TransformPoints, double);
+BENCHMARK_TEMPLATE(BM_Matrix4TRSProduct, float);
+BENCHMARK_TEMPLATE(BM_Matrix4TRSProduct, double);
+BENCHMARK_TEMPLATE(BM_Matrix4TRS, float);
+BENCHMARK_TEMPLATE(BM_Matrix4TRS, double);
+BENCHMARK_TEMPLATE(BM_Affine3Multiply, float);
+BENCHMARK_TEMPLATE(BM_Affine3Multiply, double);
+BENCHMARK_TEMPLATE(BM_Affine3Inverse, float);
+BENCHMARK_TEMPLATE(BM_Affine3Inverse, double);
+BENCHMARK_TEMPLATE(BM_Matrix4Chain, double);
+BENCHMARK_TEMPLATE(BM_Matrix4Chain, long double);
+BENCHMARK_TEMPLATE(BM_Matrix4ChainExpression, double);
+BENCHMARK_TEMPLATE(BM_Matrix4ChainExpression, long double);
+BENCHMARK_TEMPLATE(BM_Matrix6Multiply, float);
+BENCHMARK_TEMPLATE(BM_Matrix6Multiply, double);
+BENCHMARK_TEMPLATE(BM_Matrix6MultiplyVector, float);
+BENCHMARK_TEMPLATE(BM_Matrix6MultiplyVector, double);
+BENCHMARK_TEMPLATE(BM_Matrix6Inverse, float);
+BENCHMARK_TEMPLATE(BM_Matrix6Inverse, double);
+BENCHMARK_TEMPLATE(BM_TransformHierarchyUpdate, float);
+BENCHMARK_TEMPLATE(BM_TransformHierarchyUpdate, double);
+BENCHMARK_TEMPLATE(BM_TransformHierarchyUpdateAll, float);
+BENCHMARK_TEMPLATE(BM_TransformHierarchyUpdateAll, double);
+BENCHMARK_TEMPLATE(BM_Matrix4TRSBatch, float);
+BENCHMARK_TEMPLATE(BM_Matrix4TRSBatch, double);
+BENCHMARK_TEMPLATE(BM_Matrix4TRSBatchParallel, float);
+BENCHMARK_TEMPLATE(BM_Matrix4TRSBatchParallel, double);
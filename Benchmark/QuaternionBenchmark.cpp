@@ -0,0 +1,326 @@
+#include <span>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BenchmarkData.hpp"
+
+#include "math/Quaternion.hpp"
+#include "math/DualQuaternion.hpp"
+
+
+template <typename TValueType>
+static void BM_QuaternionMultiply(bench::State& state)
+{
+    const auto&     quaternions = bench::QuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(quaternions[index] * quaternions[(index + 1) & bench::POOL_MASK]);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionSlerp(bench::State& state)
+{
+    const auto&     quaternions = bench::QuaternionPool<TValueType>();
+    const auto&     ratios = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        const TValueType    ratio = ratios[index] * static_cast<TValueType>(0.05) + static_cast<TValueType>(0.5);
+
+        bench::DoNotOptimize(math::Quaternion<TValueType>::Slerp(quaternions[index],
+                                                                 quaternions[(index + 1) & bench::POOL_MASK],
+                                                                 ratio));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionNlerp(bench::State& state)
+{
+    const auto&     quaternions = bench::QuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Quaternion<TValueType>::Nlerp(quaternions[index],
+                                                                 quaternions[(index + 1) & bench::POOL_MASK],
+                                                                 static_cast<TValueType>(0.3)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionSlerpFast(bench::State& state)
+{
+    const auto&     quaternions = bench::QuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Quaternion<TValueType>::SlerpFast(quaternions[index],
+                                                                     quaternions[(index + 1) & bench::POOL_MASK],
+                                                                     static_cast<TValueType>(0.3)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Whole pool per op
+template <typename TValueType>
+static void BM_QuaternionNlerpBatch(bench::State& state)
+{
+    const auto&                                 quaternions = bench::QuaternionPool<TValueType>();
+    std::vector<math::Quaternion<TValueType>>   targets(quaternions.rbegin(), quaternions.rend());
+    std::vector<math::Quaternion<TValueType>>   out(quaternions.size());
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(out.size()));
+
+    for (auto _ : state)
+    {
+        math::Nlerp(quaternions, targets, static_cast<TValueType>(0.3), out);
+        bench::DoNotOptimize(out.front());
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionSlerpFastBatch(bench::State& state)
+{
+    const auto&                                 quaternions = bench::QuaternionPool<TValueType>();
+    std::vector<math::Quaternion<TValueType>>   targets(quaternions.rbegin(), quaternions.rend());
+    std::vector<math::Quaternion<TValueType>>   out(quaternions.size());
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(out.size()));
+
+    for (auto _ : state)
+    {
+        math::SlerpFast(quaternions, targets, static_cast<TValueType>(0.3), out);
+        bench::DoNotOptimize(out.front());
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionRotate(bench::State& state)
+{
+    const auto&     quaternions = bench::QuaternionPool<TValueType>();
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(quaternions[index].Rotate(vectors[index]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionRotationMatrix(bench::State& state)
+{
+    const auto&     quaternions = bench::QuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(quaternions[index].RotationMatrix());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Whole pool per op
+template <typename TValueType>
+static void BM_QuaternionRotationMatrixBatch(bench::State& state)
+{
+    const auto&                             quaternions = bench::QuaternionPool<TValueType>();
+    std::vector<math::Matrix4<TValueType>>  out(quaternions.size());
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(out.size()));
+
+    for (auto _ : state)
+    {
+        math::RotationMatrices<TValueType>(quaternions, out);
+        bench::DoNotOptimize(out.front());
+    }
+}
+
+// Whole pool rotated by one quaternion per op
+template <typename TValueType>
+static void BM_QuaternionRotateBatch(bench::State& state)
+{
+    const auto&                             quaternions = bench::QuaternionPool<TValueType>();
+    const auto&                             vectors = bench::Vector3Pool<TValueType>();
+    std::vector<math::Vector3<TValueType>>  out(vectors.size());
+    std::size_t                             index = 0;
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(out.size()));
+
+    for (auto _ : state)
+    {
+        math::Rotate(quaternions[index], vectors, out);
+        bench::DoNotOptimize(out.front());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static std::vector<math::DualQuaternion<TValueType>> DualQuaternionPool(void)
+{
+    const auto&                                     quaternions = bench::QuaternionPool<TValueType>();
+    const auto&                                     vectors = bench::Vector3Pool<TValueType>();
+    std::vector<math::DualQuaternion<TValueType>>   transforms;
+
+    for (std::size_t index = 0; index < quaternions.size(); ++index)
+        transforms.emplace_back(quaternions[index], vectors[index]);
+
+    return transforms;
+}
+
+template <typename TValueType>
+static void BM_DualQuaternionTransformPoint(bench::State& state)
+{
+    const auto      transforms = DualQuaternionPool<TValueType>();
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(transforms[index].TransformPoint(vectors[(index + 1) & bench::POOL_MASK]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_DualQuaternionScLerp(bench::State& state)
+{
+    const auto      transforms = DualQuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::DualQuaternion<TValueType>::ScLerp(transforms[index],
+                                                                      transforms[(index + 1) & bench::POOL_MASK],
+                                                                      static_cast<TValueType>(0.3)));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Whole pool per op, 4 influences per vertex
+template <typename TValueType>
+static void BM_DualQuaternionSkinBlend(bench::State& state)
+{
+    constexpr std::size_t                           influences = 4;
+
+    const auto                                      palette = DualQuaternionPool<TValueType>();
+    std::vector<std::uint32_t>                      indices(palette.size() * influences);
+    std::vector<TValueType>                         weights(indices.size(), static_cast<TValueType>(0.25));
+    std::vector<math::DualQuaternion<TValueType>>   out(palette.size());
+
+    for (std::size_t index = 0; index < indices.size(); ++index)
+        indices[index] = static_cast<std::uint32_t>((index * 7) & bench::POOL_MASK);
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(out.size()));
+
+    for (auto _ : state)
+    {
+        math::Blend<TValueType>(palette, indices, weights, out);
+        bench::DoNotOptimize(out.front());
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionFromEuler(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        const math::Radian<TValueType>  angle(values[index]);
+
+        bench::DoNotOptimize(math::Quaternion<TValueType>(angle, angle, angle));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionNormalize(bench::State& state)
+{
+    const auto&     quaternions = bench::QuaternionPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(quaternions[index].Normalized());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_QuaternionFromRotationMatrix(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Quaternion<TValueType>::FromRotationMatrix(matrices[index]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Matrix4Decompose(bench::State& state)
+{
+    const auto&     matrices = bench::Matrix4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        math::Vector3<TValueType>       translation, scale;
+        math::Quaternion<TValueType>    rotation;
+
+        math::Decompose(matrices[index], translation, rotation, scale);
+        bench::DoNotOptimize(translation);
+        bench::DoNotOptimize(rotation);
+        bench::DoNotOptimize(scale);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, float);
+BENCHMARK_TEMPLATE(BM_QuaternionMultiply, double);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerp, float);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerp, double);
+BENCHMARK_TEMPLATE(BM_QuaternionNlerp, float);
+BENCHMARK_TEMPLATE(BM_QuaternionNlerp, double);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerpFast, float);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerpFast, double);
+BENCHMARK_TEMPLATE(BM_QuaternionNlerpBatch, float);
+BENCHMARK_TEMPLATE(BM_QuaternionNlerpBatch, double);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerpFastBatch, float);
+BENCHMARK_TEMPLATE(BM_QuaternionSlerpFastBatch, double);
+BENCHMARK_TEMPLATE(BM_QuaternionRotate, float);
+BENCHMARK_TEMPLATE(BM_QuaternionRotate, double);
+BENCHMARK_TEMPLATE(BM_QuaternionRotationMatrix, float);
+BENCHMARK_TEMPLATE(BM_QuaternionRotationMatrix, double);
+BENCHMARK_TEMPLATE(BM_QuaternionRotationMatrixBatch, float);
+BENCHMARK_TEMPLATE(BM_QuaternionRotationMatrixBatch, double);
+BENCHMARK_TEMPLATE(BM_QuaternionRotateBatch, float);
+BENCHMARK_TEMPLATE(BM_QuaternionRotateBatch, double);
+BENCHMARK_TEMPLATE(BM_QuaternionFromEuler, float);
+BENCHMARK_TEMPLATE(BM_QuaternionFromEuler, double);
+BENCHMARK_TEMPLATE(BM_QuaternionNormalize, float);
+BENCHMARK_TEMPLATE(BM_QuaternionNormalize, double);
+BENCHMARK_TEMPLATE(BM_QuaternionFromRotationMatrix, float);
+BENCHMARK_TEMPLATE(BM_QuaternionFromRotationMatrix, double);
+BENCHMARK_TEMPLATE(BM_Matrix4Decompose, float);
+BENCHMARK_TEMPLATE(BM_Matrix4Decompose, double);
+BENCHMARK_TEMPLATE(BM_DualQuaternionTransformPoint, float);
+BENCHMARK_TEMPLATE(BM_DualQuaternionTransformPoint, double);
+BENCHMARK_TEMPLATE(BM_DualQuaternionScLerp, float);
+BENCHMARK_TEMPLATE(BM_DualQuaternionScLerp, double);
+BENCHMARK_TEMPLATE(BM_DualQuaternionSkinBlend, float);
+BENCHMARK_TEMPLATE(BM_DualQuaternionSkinBlend, double);
@@ -0,0 +1,109 @@
+#include <span>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BenchmarkData.hpp"
+
+#include "math/Trigonometry.hpp"
+
+
+template <typename TValueType>
+static void BM_Cos(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Cos(math::Radian<TValueType>(values[index])));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Sin(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Sin(math::Radian<TValueType>(values[index])));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_SinCos(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        TValueType  sine, cosine;
+
+        math::SinCos(math::Radian<TValueType>(values[index]), sine, cosine);
+        bench::DoNotOptimize(sine);
+        bench::DoNotOptimize(cosine);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Tan(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Tan(math::Radian<TValueType>(values[index])));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Atan2(bench::State& state)
+{
+    const auto&     values = bench::ScalarPool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(math::Atan2(values[index], values[(index + 1) & bench::POOL_MASK]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Whole pool per op
+template <typename TValueType>
+static void BM_SinCosBatch(bench::State& state)
+{
+    const auto&                 values = bench::ScalarPool<TValueType>();
+    std::vector<TValueType>     sines(values.size());
+    std::vector<TValueType>     cosines(values.size());
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(values.size()));
+
+    for (auto _ : state)
+    {
+        math::SinCos<TValueType>(values, sines, cosines);
+        bench::DoNotOptimize(sines.front());
+        bench::DoNotOptimize(cosines.front());
+    }
+}
+
+
+BENCHMARK_TEMPLATE(BM_Cos, float);
+BENCHMARK_TEMPLATE(BM_Cos, double);
+BENCHMARK_TEMPLATE(BM_Sin, float);
+BENCHMARK_TEMPLATE(BM_Sin, double);
+BENCHMARK_TEMPLATE(BM_SinCos, float);
+BENCHMARK_TEMPLATE(BM_SinCos, double);
+BENCHMARK_TEMPLATE(BM_Tan, float);
+BENCHMARK_TEMPLATE(BM_Tan, double);
+BENCHMARK_TEMPLATE(BM_Atan2, float);
+BENCHMARK_TEMPLATE(BM_Atan2, double);
+BENCHMARK_TEMPLATE(BM_SinCosBatch, float);
+BENCHMARK_TEMPLATE(BM_SinCosBatch, double);
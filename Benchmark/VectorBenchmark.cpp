@@ -0,0 +1,194 @@
+#include <span>
+
+#include "Benchmark.hpp"
+#include "BenchmarkData.hpp"
+
+#include "math/Vector3.hpp"
+#include "math/Vector4.hpp"
+#include "math/Expression.hpp"
+
+
+template <typename TValueType>
+static void BM_Vector3Add(bench::State& state)
+{
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(vectors[index] + vectors[(index + 1) & bench::POOL_MASK]);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector3Dot(bench::State& state)
+{
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(vectors[index].Dot(vectors[(index + 1) & bench::POOL_MASK]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector3Cross(bench::State& state)
+{
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(vectors[index].Cross(vectors[(index + 1) & bench::POOL_MASK]));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector3Magnitude(bench::State& state)
+{
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(vectors[index].Magnitude());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector3Normalize(bench::State& state)
+{
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(vectors[index].Normalized());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector3NormalizeFast(bench::State& state)
+{
+    const auto&     vectors = bench::Vector3Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(vectors[index].NormalizedFast());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector3Rotate(bench::State& state)
+{
+    const auto&                     vectors = bench::Vector3Pool<TValueType>();
+    const math::Radian<TValueType>  angle(static_cast<TValueType>(0.7));
+    std::size_t                     index = 0;
+
+    for (auto _ : state)
+    {
+        math::Vector3<TValueType>   vector = vectors[index];
+
+        vector.Rotate(angle, angle, angle);
+        bench::DoNotOptimize(vector);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector4Normalize(bench::State& state)
+{
+    const auto&     vectors = bench::Vector4Pool<TValueType>();
+    std::size_t     index = 0;
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(vectors[index].Normalized());
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+// Whole pool per op
+template <typename TValueType>
+static void BM_Vector4NormalizeBatch(bench::State& state)
+{
+    std::vector<math::Vector4<TValueType>>  vectors = bench::Vector4Pool<TValueType>();
+
+    state.SetItemsPerOp(static_cast<std::int64_t>(vectors.size()));
+
+    for (auto _ : state)
+    {
+        math::fast::Normalize<math::fast::EPrecision::MEDIUM, TValueType>(vectors);
+        bench::DoNotOptimize(vectors.front());
+    }
+}
+
+
+// Integrator-like chain: a * s + b * t - c
+template <typename TValueType>
+static void BM_Vector3Chain(bench::State& state)
+{
+    const auto&         vectors = bench::Vector3Pool<TValueType>();
+    const auto&         scalars = bench::ScalarPool<TValueType>();
+    std::size_t         index = 0;
+
+    for (auto _ : state)
+    {
+        const auto&     a = vectors[index];
+        const auto&     b = vectors[(index + 1) & bench::POOL_MASK];
+        const auto&     c = vectors[(index + 2) & bench::POOL_MASK];
+
+        bench::DoNotOptimize(a * scalars[index] + b * scalars[(index + 1) & bench::POOL_MASK] - c);
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+template <typename TValueType>
+static void BM_Vector3ChainExpression(bench::State& state)
+{
+    const auto&         vectors = bench::Vector3Pool<TValueType>();
+    const auto&         scalars = bench::ScalarPool<TValueType>();
+    std::size_t         index = 0;
+
+    for (auto _ : state)
+    {
+        const auto&     a = vectors[index];
+        const auto&     b = vectors[(index + 1) & bench::POOL_MASK];
+        const auto&     c = vectors[(index + 2) & bench::POOL_MASK];
+
+        bench::DoNotOptimize(math::expr::Evaluate(math::expr::Lazy(a) * scalars[index] +
+                                                  math::expr::Lazy(b) * scalars[(index + 1) & bench::POOL_MASK] - c));
+        index = (index + 1) & bench::POOL_MASK;
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Vector3Add, float);
+BENCHMARK_TEMPLATE(BM_Vector3Add, double);
+BENCHMARK_TEMPLATE(BM_Vector3Dot, float);
+BENCHMARK_TEMPLATE(BM_Vector3Dot, double);
+BENCHMARK_TEMPLATE(BM_Vector3Cross, float);
+BENCHMARK_TEMPLATE(BM_Vector3Cross, double);
+BENCHMARK_TEMPLATE(BM_Vector3Magnitude, float);
+BENCHMARK_TEMPLATE(BM_Vector3Magnitude, double);
+BENCHMARK_TEMPLATE(BM_Vector3Normalize, float);
+BENCHMARK_TEMPLATE(BM_Vector3Normalize, double);
+BENCHMARK_TEMPLATE(BM_Vector3NormalizeFast, float);
+BENCHMARK_TEMPLATE(BM_Vector3NormalizeFast, double);
+BENCHMARK_TEMPLATE(BM_Vector3Rotate, float);
+BENCHMARK_TEMPLATE(BM_Vector3Rotate, double);
+BENCHMARK_TEMPLATE(BM_Vector4Normalize, float);
+BENCHMARK_TEMPLATE(BM_Vector4Normalize, double);
+BENCHMARK_TEMPLATE(BM_Vector4NormalizeBatch, float);
+BENCHMARK_TEMPLATE(BM_Vector4NormalizeBatch, double);
+BENCHMARK_TEMPLATE(BM_Vector3Chain, double);
+BENCHMARK_TEMPLATE(BM_Vector3Chain, long double);
+BENCHMARK_TEMPLATE(BM_Vector3ChainExpression, double);
+BENCHMARK_TEMPLATE(BM_Vector3ChainExpression, long double);
@@ -0,0 +1,26 @@
+#include <cstdio>
+
+#include "Benchmark.hpp"
+
+#include "math/Simd.hpp"
+
+
+// Usage: Benchmark [name filter]
+int main(int argc, char* argv[])
+{
+#ifdef MY_TRIG_IMPL
+    std::printf("Trigonometry: polynomial (MY_TRIG_IMPL)\n");
+#else
+    std::printf("Trigonometry: standard library\n");
+#endif
+
+#if defined(MTH_SIMD_AVX)
+    std::printf("SIMD: AVX\n\n");
+#elif defined(MTH_SIMD_SSE)
+    std::printf("SIMD: SSE\n\n");
+#else
+    std::printf("SIMD: none\n\n");
+#endif
+
+    return bench::RunAll(argc > 1 ? argv[1] : nullptr);
+}
@@ -0,0 +1,98 @@
+#include <limits>
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/AABB.hpp"
+#include "math/AABB3Stream.hpp"
+
+
+using Box = math::AABB3<float>;
+using Vec = math::Vector3<float>;
+
+static const float      s_infinity = std::numeric_limits<float>::infinity();
+
+
+// Slab test with a ray parallel to the x = 0 plane and starting in it
+static bool FaceRay(float directionX, float originX, float& entry)
+{
+    const Box       box(Vec(0.f, 0.f, 0.f), Vec(2.f, 2.f, 2.f));
+    const Vec       inverse(1.f / directionX, 1.f / 1.f, s_infinity);
+
+    return box.IntersectRay(Vec(originX, -1.f, 1.f), inverse, 0.f, 10.f, entry);
+}
+
+
+TEST(AABB, RayInsideSlabs)
+{
+    const Box       box(Vec(0.f, 0.f, 0.f), Vec(2.f, 2.f, 2.f));
+    float           entry = -1.f;
+
+    EXPECT_TRUE(box.IntersectRay(Vec(-1.f, 1.f, 1.f), Vec(1.f, s_infinity, s_infinity), 0.f, 10.f, entry));
+    EXPECT_NEAR(entry, 1.f, 1e-6f);
+
+    // Parallel to an axis and outside its slab
+    EXPECT_FALSE(box.IntersectRay(Vec(-1.f, 3.f, 1.f), Vec(1.f, s_infinity, s_infinity), 0.f, 10.f, entry));
+}
+
+
+TEST(AABB, RayOnMinFace)
+{
+    float       entry = -1.f;
+
+    EXPECT_TRUE(FaceRay(0.f, 0.f, entry));
+    EXPECT_NEAR(entry, 1.f, 1e-6f);
+
+    EXPECT_TRUE(FaceRay(-0.f, 0.f, entry));
+    EXPECT_NEAR(entry, 1.f, 1e-6f);
+}
+
+
+TEST(AABB, RayOnMaxFace)
+{
+    float       entry = -1.f;
+
+    EXPECT_TRUE(FaceRay(0.f, 2.f, entry));
+    EXPECT_NEAR(entry, 1.f, 1e-6f);
+
+    EXPECT_TRUE(FaceRay(-0.f, 2.f, entry));
+    EXPECT_NEAR(entry, 1.f, 1e-6f);
+}
+
+
+TEST(AABB3Stream, OverlapIndicesAppend)
+{
+    std::vector<Box>    boxes;
+
+    for (int index = 0; index < 150; ++index)
+    {
+        const float     offset = static_cast<float>(index);
+
+        boxes.emplace_back(Vec(offset, 0.f, 0.f), Vec(offset + 0.5f, 1.f, 1.f));
+    }
+
+    const math::AABB3Stream<float>  stream(boxes);
+    const Box                       query(Vec(4.5f, 0.5f, 0.5f), Vec(130.2f, 2.f, 2.f));
+
+    // Indices already in the vector are kept, the rest match the flags
+    std::vector<uint32_t>   indices = { 1000u, 1001u };
+    std::vector<uint8_t>    flags(boxes.size());
+
+    const std::size_t       count = math::Overlaps(stream, query, indices);
+
+    math::Overlaps(stream, query, std::span<uint8_t>(flags));
+
+    std::vector<uint32_t>   expected = { 1000u, 1001u };
+
+    for (uint32_t index = 0; index < flags.size(); ++index)
+    {
+        if (flags[index])
+            expected.push_back(index);
+    }
+
+    EXPECT_EQ(count, expected.size() - 2);
+    EXPECT_TRUE(indices == expected);
+
+    // Boxes 4 (touching) to 130, over several blocks
+    EXPECT_EQ(count, std::size_t(127));
+}
@@ -0,0 +1,100 @@
+#include <random>
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/BVH.hpp"
+#include "math/Intersection.hpp"
+
+
+using Vec = math::Vector3<float>;
+
+
+// Two triangles forming a wall at x = 5, y in [0, 2] and z in [-1, 1]
+static math::TriangleBVH<float> Wall(void)
+{
+    const std::vector<Vec>      triangles =
+    {
+        Vec(5.f, 0.f, -1.f), Vec(5.f, 2.f, -1.f), Vec(5.f, 0.f, 1.f),
+        Vec(5.f, 2.f, -1.f), Vec(5.f, 2.f, 1.f), Vec(5.f, 0.f, 1.f)
+    };
+
+    math::TriangleBVH<float>    bvh;
+
+    bvh.Build(triangles);
+    return bvh;
+}
+
+
+TEST(TriangleBVH, RayOnNodeFace)
+{
+    const math::TriangleBVH<float>  bvh = Wall();
+    math::TriangleBVH<float>::RayHit hit{};
+
+    // Rays along x in the y = 0 (min) and y = 2 (max) planes of the root,
+    // with both signs of zero for the other components
+    for (float y : { 0.f, 2.f })
+    {
+        for (float zero : { 0.f, -0.f })
+        {
+            const Vec       origin(0.f, y, 0.f);
+            const Vec       direction(1.f, zero, zero);
+
+            EXPECT_TRUE(bvh.Raycast(origin, direction, 10.f, hit));
+            EXPECT_NEAR(hit.m_distance, 5.f, 1e-5f);
+            EXPECT_TRUE(bvh.AnyHit(origin, direction, 10.f));
+        }
+    }
+
+    // Same plane, outside the wall's z range
+    EXPECT_FALSE(bvh.Raycast(Vec(0.f, 0.f, 2.f), Vec(1.f, 0.f, 0.f), 10.f, hit));
+}
+
+
+TEST(TriangleBVH, RaycastMatchesBruteForce)
+{
+    std::mt19937                            random(7);
+    std::uniform_real_distribution<float>   position(-10.f, 10.f), offset(-1.f, 1.f);
+    std::vector<Vec>                        triangles;
+
+    for (int index = 0; index < 300; ++index)
+    {
+        const Vec       center(position(random), position(random), position(random));
+
+        for (int vertex = 0; vertex < 3; ++vertex)
+            triangles.push_back(center + Vec(offset(random), offset(random), offset(random)));
+    }
+
+    math::TriangleBVH<float>    bvh;
+
+    bvh.Build(triangles, 4);
+
+    for (int ray = 0; ray < 300; ++ray)
+    {
+        const Vec       origin(position(random), position(random), position(random));
+        const Vec       direction = Vec(position(random), position(random), position(random)) - origin;
+
+        float           closest = 1.f;
+        bool            expected = false;
+
+        for (std::size_t index = 0; index < triangles.size(); index += 3)
+        {
+            float       distance, u, v;
+
+            if (math::IntersectRayTriangle(origin, direction, triangles[index], triangles[index + 1],
+                                           triangles[index + 2], closest, distance, u, v))
+            {
+                closest = distance;
+                expected = true;
+            }
+        }
+
+        math::TriangleBVH<float>::RayHit    hit{};
+
+        EXPECT_EQ(bvh.Raycast(origin, direction, 1.f, hit), expected);
+        EXPECT_EQ(bvh.AnyHit(origin, direction, 1.f), expected);
+
+        if (expected)
+            EXPECT_NEAR(hit.m_distance, closest, 1e-5f);
+    }
+}
@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/DualQuaternion.hpp"
+
+
+using DualQuat = math::DualQuaternion<float>;
+using Vec = math::Vector3<float>;
+
+
+static std::vector<DualQuat> Palette(void)
+{
+    std::vector<DualQuat>   palette;
+
+    for (int index = 0; index < 6; ++index)
+    {
+        const float                     value = static_cast<float>(index);
+        const math::Quaternion<float>   rotation(Vec(1.f, value, 2.f - value).Normalized(),
+                                                 math::Radian<float>(value * 0.9f - 2.f));
+
+        palette.emplace_back(rotation, Vec(value, -value * 0.5f, 3.f));
+    }
+
+    return palette;
+}
+
+
+static void ExpectNear(const DualQuat& lhs, const DualQuat& rhs, float tolerance)
+{
+    const Vec   point(0.5f, -2.f, 1.f);
+
+    EXPECT_NEAR(math::Distance(lhs.TransformPoint(point), rhs.TransformPoint(point)), 0.f, tolerance);
+}
+
+
+TEST(DualQuaternion, BlendTwoMatchesNlerp)
+{
+    const std::vector<DualQuat>     palette = Palette();
+    const std::vector<DualQuat>     pair = { palette[1], palette[4] };
+    const std::vector<float>        weights = { 0.7f, 0.3f };
+
+    // Containers bind without a template argument
+    ExpectNear(math::Blend(pair, weights), DualQuat::Nlerp(palette[1], palette[4], 0.3f), 1e-5f);
+}
+
+
+TEST(DualQuaternion, SkinningBlendMatchesScalar)
+{
+    const std::vector<DualQuat>     palette = Palette();
+    std::vector<std::uint32_t>      indices;
+    std::vector<float>              weights;
+
+    // 3 influences per vertex, 11 vertices so SIMD kernels have a tail
+    for (std::uint32_t vertex = 0; vertex < 11; ++vertex)
+    {
+        indices.insert(indices.end(), { vertex % 6, (vertex + 2) % 6, (vertex * 5) % 6 });
+        weights.insert(weights.end(), { 0.5f, 0.3f, 0.2f });
+    }
+
+    std::vector<DualQuat>           skinned(11);
+
+    math::Blend(palette, indices, weights, skinned);
+
+    for (std::size_t vertex = 0; vertex < skinned.size(); ++vertex)
+    {
+        const std::vector<DualQuat>     influences = { palette[indices[vertex * 3]], palette[indices[vertex * 3 + 1]],
+                                                       palette[indices[vertex * 3 + 2]] };
+        const std::vector<float>        vertexWeights(weights.begin() + vertex * 3, weights.begin() + vertex * 3 + 3);
+
+        ExpectNear(skinned[vertex], math::Blend(influences, vertexWeights), 1e-4f);
+    }
+}
@@ -0,0 +1,77 @@
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/FastMath.hpp"
+#include "math/Quaternion.hpp"
+#include "math/Vector2.hpp"
+#include "math/Vector3.hpp"
+#include "math/Vector4.hpp"
+
+
+using math::fast::EPrecision;
+
+
+TEST(FastMath, BatchInverseSquareRoot)
+{
+    std::vector<float>      values;
+
+    for (int index = 1; index <= 37; ++index)
+        values.push_back(static_cast<float>(index) * 0.75f);
+
+    std::vector<float>      medium(values.size());
+    std::vector<float>      high(values.size());
+
+    // Containers bind directly, with or without a precision
+    math::fast::InverseSquareRoot(values, medium);
+    math::fast::InverseSquareRoot<EPrecision::HIGH>(values, high);
+
+    for (std::size_t index = 0; index < values.size(); ++index)
+    {
+        const float     expected = 1.f / std::sqrt(values[index]);
+
+        EXPECT_NEAR(medium[index], expected, expected * 1e-5f);
+        EXPECT_NEAR(high[index], expected, expected * 1e-6f);
+    }
+
+    std::vector<double>     wide(values.begin(), values.end());
+
+    math::fast::InverseSquareRoot<EPrecision::HIGH>(wide, wide);
+
+    for (std::size_t index = 0; index < values.size(); ++index)
+        EXPECT_NEAR(wide[index], 1.0 / std::sqrt(static_cast<double>(values[index])), 1e-9);
+}
+
+
+TEST(FastMath, BatchNormalize)
+{
+    std::vector<math::Vector2<float>>       vectors2;
+    std::vector<math::Vector3<double>>      vectors3;
+    std::vector<math::Vector4<float>>       vectors4;
+    std::vector<math::Quaternion<float>>    quaternions;
+
+    for (int index = 1; index <= 13; ++index)
+    {
+        const float     value = static_cast<float>(index);
+
+        vectors2.emplace_back(value, -2.f);
+        vectors3.emplace_back(value, 0.5, -3.0);
+        vectors4.emplace_back(value, 1.f, -value, 4.f);
+        quaternions.emplace_back(value, 0.25f, -1.f, 2.f);
+    }
+
+    math::fast::Normalize(vectors2);
+    math::fast::Normalize<EPrecision::HIGH>(vectors3);
+    math::fast::Normalize(std::span(vectors4));
+    math::fast::Normalize(quaternions);
+
+    for (std::size_t index = 0; index < vectors2.size(); ++index)
+    {
+        EXPECT_NEAR(vectors2[index].Magnitude(), 1.f, 1e-4f);
+        EXPECT_NEAR(vectors3[index].Magnitude(), 1.0, 1e-9);
+        EXPECT_NEAR(vectors4[index].Magnitude(), 1.f, 1e-4f);
+        EXPECT_NEAR(quaternions[index].Length(), 1.f, 1e-4f);
+    }
+}
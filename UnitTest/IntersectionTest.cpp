@@ -0,0 +1,81 @@
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/Intersection.hpp"
+
+
+using Box = math::AABB3<float>;
+using Vec = math::Vector3<float>;
+
+static const Box        s_box(Vec(0.f, 0.f, 0.f), Vec(2.f, 2.f, 2.f));
+
+
+// Rays parallel to the x = faceX plane and starting in it, with +0 and -0
+// as the x direction. The box is entered at distance 1
+static void FaceRays(float faceX, std::vector<Vec>& origins, std::vector<Vec>& directions)
+{
+    for (float zero : { 0.f, -0.f })
+    {
+        origins.emplace_back(faceX, -1.f, 1.f);
+        directions.emplace_back(zero, 1.f, 0.f);
+    }
+}
+
+
+// Checks the scalar and the batch versions on the same rays. Enough copies
+// are made to go through full packets and the scalar tail
+static void CheckFaceRays(float faceX)
+{
+    std::vector<Vec>    origins;
+    std::vector<Vec>    directions;
+
+    for (int copy = 0; copy < 9; ++copy)
+        FaceRays(faceX, origins, directions);
+
+    for (std::size_t index = 0; index < origins.size(); ++index)
+    {
+        float   distance = -1.f;
+
+        EXPECT_TRUE(math::IntersectRayBox(origins[index], directions[index], s_box, 10.f, distance));
+        EXPECT_NEAR(distance, 1.f, 1e-6f);
+    }
+
+    std::vector<float>  distances(origins.size(), 10.f);
+
+    EXPECT_EQ(math::IntersectRayBox(math::Vector3Stream<float>(origins), math::Vector3Stream<float>(directions),
+                                    s_box, distances), origins.size());
+
+    for (float distance : distances)
+        EXPECT_NEAR(distance, 1.f, 1e-6f);
+}
+
+
+TEST(Intersection, RayBoxOnMinFace)
+{
+    CheckFaceRays(0.f);
+}
+
+
+TEST(Intersection, RayBoxOnMaxFace)
+{
+    CheckFaceRays(2.f);
+}
+
+
+TEST(Intersection, RayBoxParallelOutside)
+{
+    std::vector<Vec>    origins;
+    std::vector<Vec>    directions;
+
+    for (int copy = 0; copy < 9; ++copy)
+        FaceRays(3.f, origins, directions);
+
+    std::vector<float>  distances(origins.size(), 10.f);
+
+    EXPECT_EQ(math::IntersectRayBox(math::Vector3Stream<float>(origins), math::Vector3Stream<float>(directions),
+                                    s_box, distances), 0u);
+
+    for (float distance : distances)
+        EXPECT_EQ(distance, 10.f);
+}
@@ -0,0 +1,78 @@
+#include "UnitTest.hpp"
+
+#include "math/Matrix3.hpp"
+#include "math/Matrix4.hpp"
+
+
+// m[i] is column i. Values are distinct so a transposed product is caught
+static math::Matrix4<float> Values4(float offset)
+{
+    math::Matrix4<float>    matrix;
+
+    for (int column = 0; column < 4; ++column)
+    {
+        for (int row = 0; row < 4; ++row)
+            matrix[column][row] = offset + static_cast<float>(column * 4 + row);
+    }
+
+    return matrix;
+}
+
+
+static math::Matrix3<float> Values3(float offset)
+{
+    math::Matrix3<float>    matrix;
+
+    for (int column = 0; column < 3; ++column)
+    {
+        for (int row = 0; row < 3; ++row)
+            matrix[column][row] = offset + static_cast<float>(column * 3 + row);
+    }
+
+    return matrix;
+}
+
+
+TEST(Matrix4, TimesVectorIsColumnMajor)
+{
+    math::Matrix4<float>    translation(1.f);
+
+    translation[3] = math::Vector4<float>(1.f, 2.f, 3.f, 1.f);
+
+    const math::Vector4<float>  moved = translation * math::Vector4<float>(10.f, 20.f, 30.f, 1.f);
+
+    EXPECT_EQ(moved, math::Vector4<float>(11.f, 22.f, 33.f, 1.f));
+
+    // Sum of the columns weighted by the vector's components
+    const math::Vector4<float>  result = Values4(0.f) * math::Vector4<float>(1.f, 2.f, 3.f, 4.f);
+
+    EXPECT_EQ(result, math::Vector4<float>(80.f, 90.f, 100.f, 110.f));
+}
+
+
+TEST(Matrix4, TimesVectorMatchesProduct)
+{
+    const math::Matrix4<float>  lhs = Values4(1.f);
+    const math::Matrix4<float>  rhs = Values4(-7.f);
+    const math::Vector4<float>  vector(0.5f, -1.f, 2.f, 1.f);
+
+    EXPECT_EQ((lhs * rhs) * vector, lhs * (rhs * vector));
+}
+
+
+TEST(Matrix3, TimesVectorIsColumnMajor)
+{
+    const math::Vector3<float>  result = Values3(0.f) * math::Vector3<float>(1.f, 2.f, 3.f);
+
+    EXPECT_EQ(result, math::Vector3<float>(24.f, 30.f, 36.f));
+}
+
+
+TEST(Matrix3, TimesVectorMatchesProduct)
+{
+    const math::Matrix3<float>  lhs = Values3(1.f);
+    const math::Matrix3<float>  rhs = Values3(-4.f);
+    const math::Vector3<float>  vector(0.5f, -1.f, 2.f);
+
+    EXPECT_EQ((lhs * rhs) * vector, lhs * (rhs * vector));
+}
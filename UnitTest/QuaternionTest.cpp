@@ -0,0 +1,116 @@
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/Affine3.hpp"
+#include "math/Quaternion.hpp"
+
+
+using Quat = math::Quaternion<float>;
+using Vec = math::Vector3<float>;
+
+
+// Unit quaternions of varied axes and angles. 37 of them, so SIMD
+// kernels go through full registers and a scalar tail
+static std::vector<Quat> Rotations(void)
+{
+    std::vector<Quat>   rotations;
+
+    for (int index = 0; index < 37; ++index)
+    {
+        const float     value = static_cast<float>(index);
+        const Vec       axis(value - 18.f, 1.f + value * 0.1f, 3.f - value * 0.2f);
+
+        rotations.emplace_back(axis.Normalized(), math::Radian<float>(value * 0.3f - 5.f));
+    }
+
+    return rotations;
+}
+
+
+static std::vector<Vec> Points(std::size_t count)
+{
+    std::vector<Vec>    points;
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        const float     value = static_cast<float>(index);
+
+        points.emplace_back(value * 0.5f - 8.f, 2.f - value * 0.25f, value);
+    }
+
+    return points;
+}
+
+
+TEST(Quaternion, RotationMatricesMatchScalar)
+{
+    const std::vector<Quat>             rotations = Rotations();
+    std::vector<math::Matrix3<float>>   matrices3(rotations.size());
+    std::vector<math::Matrix4<float>>   matrices4(rotations.size());
+
+    // Containers bind without a template argument
+    math::RotationMatrices(rotations, matrices3);
+    math::RotationMatrices(rotations, matrices4);
+
+    for (std::size_t index = 0; index < rotations.size(); ++index)
+    {
+        const math::Matrix3<float>  expected3 = rotations[index].RotationMatrix3();
+        const math::Matrix4<float>  expected4 = rotations[index].RotationMatrix();
+
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                EXPECT_NEAR(matrices4[index][column][row], expected4[column][row], 1e-6f);
+
+                if (column < 3 && row < 3)
+                    EXPECT_NEAR(matrices3[index][column][row], expected3[column][row], 1e-6f);
+            }
+        }
+    }
+}
+
+
+TEST(Quaternion, TransformMatricesMatchScalar)
+{
+    const std::vector<Quat>             rotations = Rotations();
+    const std::vector<Vec>              translations = Points(rotations.size());
+    const std::vector<Vec>              points = Points(rotations.size() + 5);
+    std::vector<math::Affine3<float>>   rotationsOnly(rotations.size());
+    std::vector<math::Affine3<float>>   transforms(rotations.size());
+
+    math::RotationMatrices(rotations, rotationsOnly);
+    math::TransformMatrices(rotations, translations, transforms);
+
+    for (std::size_t index = 0; index < rotations.size(); ++index)
+    {
+        const Vec   rotated = rotations[index].Rotate(points[index + 5]);
+        const Vec   moved = rotated + translations[index];
+
+        EXPECT_NEAR(math::Distance(rotationsOnly[index].TransformPoint(points[index + 5]), rotated), 0.f, 1e-4f);
+        EXPECT_NEAR(math::Distance(transforms[index].TransformPoint(points[index + 5]), moved), 0.f, 1e-4f);
+    }
+}
+
+
+TEST(Quaternion, RotateSpanMatchesScalar)
+{
+    // Small arrays are rotated one by one, large ones through the matrix
+    for (std::size_t count : { std::size_t(3), std::size_t(300) })
+    {
+        const Quat              rotation = Rotations()[7];
+        const std::vector<Vec>  points = Points(count);
+        std::vector<Vec>        rotated(count);
+        std::vector<Vec>        inPlace = points;
+
+        math::Rotate(rotation, points, rotated);
+        math::Rotate(rotation, inPlace);
+
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            EXPECT_NEAR(math::Distance(rotated[index], rotation.Rotate(points[index])), 0.f, 1e-3f);
+            EXPECT_TRUE(inPlace[index] == rotated[index]);
+        }
+    }
+}
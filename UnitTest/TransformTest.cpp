@@ -0,0 +1,220 @@
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/Matrix4.hpp"
+#include "math/Vector3Stream.hpp"
+
+
+// Batch transforms are checked against the scalar matrix * vector. float
+// and double go through the SSE / AVX kernels (when enabled), int32 and the
+// UnitTestScalar build (MTH_NO_SIMD) through the scalar loops
+
+
+// m[i] is column i. The last row is not (0, 0, 0, 1), so translation,
+// w and the projective divide all matter
+template <typename TValueType>
+static math::Matrix4<TValueType> Transform(void)
+{
+    math::Matrix4<TValueType>   matrix;
+
+    for (int column = 0; column < 4; ++column)
+    {
+        for (int row = 0; row < 4; ++row)
+            matrix[column][row] = static_cast<TValueType>((column * 5 + row * 3) % 7 - 2);
+    }
+
+    matrix[3][3] = static_cast<TValueType>(9);
+    return matrix;
+}
+
+
+// 37 points: full registers of 4 / 8 values and a scalar tail
+template <typename TValueType>
+static std::vector<math::Vector3<TValueType>> Points(void)
+{
+    std::vector<math::Vector3<TValueType>>  points;
+
+    for (int index = 0; index < 37; ++index)
+    {
+        points.emplace_back(static_cast<TValueType>(index % 9 - 4), static_cast<TValueType>(3 - index % 5),
+                            static_cast<TValueType>(index / 4));
+    }
+
+    return points;
+}
+
+
+template <typename TValueType>
+static math::Vector4<TValueType> Extend(const math::Vector3<TValueType>& vector, TValueType w)
+{
+    return math::Vector4<TValueType>(vector.GetX(), vector.GetY(), vector.GetZ(), w);
+}
+
+
+template <typename TValueType>
+static void ExpectNear(const math::Vector4<TValueType>& lhs, const math::Vector4<TValueType>& rhs,
+                       TValueType tolerance)
+{
+    EXPECT_NEAR(lhs.GetX(), rhs.GetX(), tolerance);
+    EXPECT_NEAR(lhs.GetY(), rhs.GetY(), tolerance);
+    EXPECT_NEAR(lhs.GetZ(), rhs.GetZ(), tolerance);
+    EXPECT_NEAR(lhs.GetW(), rhs.GetW(), tolerance);
+}
+
+
+template <typename TValueType>
+static void ExpectNear(const math::Vector3<TValueType>& lhs, const math::Vector4<TValueType>& rhs,
+                       TValueType tolerance)
+{
+    ExpectNear(Extend(lhs, rhs.GetW()), rhs, tolerance);
+}
+
+
+template <typename TValueType>
+static void CheckProduct(TValueType tolerance)
+{
+    const math::Matrix4<TValueType>     lhs = Transform<TValueType>();
+    math::Matrix4<TValueType>           rhs;
+
+    for (int column = 0; column < 4; ++column)
+    {
+        for (int row = 0; row < 4; ++row)
+            rhs[column][row] = static_cast<TValueType>(column - 2 * row + 1);
+    }
+
+    const math::Matrix4<TValueType>     product = lhs * rhs;
+
+    // Column c of the product is lhs * (column c of rhs)
+    for (int column = 0; column < 4; ++column)
+        ExpectNear(product[column], lhs * rhs[column], tolerance);
+}
+
+
+template <typename TValueType>
+static void CheckPoints(TValueType tolerance)
+{
+    const math::Matrix4<TValueType>                 matrix = Transform<TValueType>();
+    const std::vector<math::Vector3<TValueType>>    points = Points<TValueType>();
+    const std::size_t                               count = points.size();
+
+    std::vector<math::Vector3<TValueType>>          out(count);
+    std::vector<math::Vector3<TValueType>>          inPlace = points;
+    std::vector<math::Vector4<TValueType>>          homogeneous(count);
+
+    math::TransformPoints(matrix, points, out);
+    math::TransformPoints(matrix, inPlace);
+    math::TransformPoints(matrix, points, homogeneous);
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        const math::Vector4<TValueType>     expected = matrix * Extend(points[index], static_cast<TValueType>(1));
+
+        ExpectNear(out[index], expected, tolerance);
+        ExpectNear(inPlace[index], expected, tolerance);
+        ExpectNear(homogeneous[index], expected, tolerance);
+    }
+
+    std::vector<math::Vector4<TValueType>>          vectors(count);
+    std::vector<math::Vector4<TValueType>>          vectorsOut(count);
+
+    for (std::size_t index = 0; index < count; ++index)
+        vectors[index] = Extend(points[index], static_cast<TValueType>(index % 3));
+
+    math::TransformPoints(matrix, vectors, vectorsOut);
+
+    for (std::size_t index = 0; index < count; ++index)
+        ExpectNear(vectorsOut[index], matrix * vectors[index], tolerance);
+
+    math::TransformPoints(matrix, vectors);
+
+    for (std::size_t index = 0; index < count; ++index)
+        ExpectNear(vectors[index], vectorsOut[index], static_cast<TValueType>(0));
+
+    std::vector<math::Vector3<TValueType>>          directions = points;
+
+    math::TransformDirections(matrix, points, out);
+    math::TransformDirections(matrix, directions);
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        const math::Vector4<TValueType>     expected = matrix * Extend(points[index], static_cast<TValueType>(0));
+
+        ExpectNear(out[index], expected, tolerance);
+        ExpectNear(directions[index], expected, tolerance);
+    }
+}
+
+
+template <typename TValueType>
+static void CheckProjective(TValueType tolerance)
+{
+    const math::Matrix4<TValueType>                 matrix = Transform<TValueType>();
+    const std::vector<math::Vector3<TValueType>>    points = Points<TValueType>();
+
+    std::vector<math::Vector3<TValueType>>          out(points.size());
+    std::vector<math::Vector3<TValueType>>          inPlace = points;
+
+    math::TransformPointsProjective(matrix, points, out);
+    math::TransformPointsProjective(matrix, inPlace);
+
+    for (std::size_t index = 0; index < points.size(); ++index)
+    {
+        const math::Vector4<TValueType>     clip = matrix * Extend(points[index], static_cast<TValueType>(1));
+        const math::Vector4<TValueType>     expected(clip.GetX() / clip.GetW(), clip.GetY() / clip.GetW(),
+                                                     clip.GetZ() / clip.GetW(), static_cast<TValueType>(1));
+
+        ExpectNear(out[index], expected, tolerance);
+        ExpectNear(inPlace[index], expected, tolerance);
+    }
+}
+
+
+template <typename TValueType>
+static void CheckStream(TValueType tolerance)
+{
+    const math::Matrix4<TValueType>                 matrix = Transform<TValueType>();
+    const std::vector<math::Vector3<TValueType>>    points = Points<TValueType>();
+    const math::Vector3Stream<TValueType>           stream(points);
+    math::Vector3Stream<TValueType>                 out;
+
+    math::TransformPoints(matrix, stream, out);
+
+    EXPECT_EQ(out.Size(), points.size());
+
+    for (std::size_t index = 0; index < points.size(); ++index)
+        ExpectNear(out.Get(index), matrix * Extend(points[index], static_cast<TValueType>(1)), tolerance);
+}
+
+
+TEST(Transform, Matrix4ProductMatchesColumns)
+{
+    CheckProduct<float>(1e-4f);
+    CheckProduct<double>(1e-12);
+    CheckProduct<int32_t>(0);
+}
+
+
+TEST(Transform, PointsMatchOperator)
+{
+    CheckPoints<float>(1e-4f);
+    CheckPoints<double>(1e-12);
+    CheckPoints<int32_t>(0);
+}
+
+
+TEST(Transform, ProjectiveMatchesOperator)
+{
+    CheckProjective<float>(1e-5f);
+    CheckProjective<double>(1e-12);
+}
+
+
+TEST(Transform, StreamPointsMatchOperator)
+{
+    CheckStream<float>(1e-4f);
+    CheckStream<double>(1e-12);
+    CheckStream<int32_t>(0);
+}
@@ -0,0 +1,74 @@
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "UnitTest.hpp"
+
+#include "math/Trigonometry.hpp"
+
+
+// Angles across several periods, with one block of 256 beyond SinCosMaxAngle
+// so the libm fallback is used too
+template <typename TValueType>
+static std::vector<TValueType> Angles(void)
+{
+    std::vector<TValueType>     angles;
+
+    for (int index = 0; index < 600; ++index)
+        angles.push_back(static_cast<TValueType>(index - 300) * static_cast<TValueType>(0.37));
+
+    angles[550] = static_cast<TValueType>(1e10);
+    return angles;
+}
+
+
+template <typename TValueType>
+static void CheckSinCos(const std::vector<TValueType>& angles, const std::vector<TValueType>& sines,
+                        const std::vector<TValueType>& cosines, TValueType tolerance)
+{
+    for (std::size_t index = 0; index < angles.size(); ++index)
+    {
+        EXPECT_NEAR(sines[index], std::sin(angles[index]), tolerance);
+        EXPECT_NEAR(cosines[index], std::cos(angles[index]), tolerance);
+    }
+}
+
+
+TEST(Trigonometry, BatchSinCosFloat)
+{
+    const std::vector<float>    angles = Angles<float>();
+    std::vector<float>          sines(angles.size());
+    std::vector<float>          cosines(angles.size());
+
+    // Containers bind directly, spans deduce the type
+    math::SinCos(angles, sines, cosines);
+    CheckSinCos(angles, sines, cosines, 1e-6f);
+
+    std::vector<float>          only(angles.size());
+
+    math::Sin(angles, std::span(only));
+    EXPECT_TRUE(only == sines);
+
+    math::Cos(angles, only);
+    EXPECT_TRUE(only == cosines);
+}
+
+
+TEST(Trigonometry, BatchSinCosDouble)
+{
+    const std::vector<double>   angles = Angles<double>();
+    std::vector<double>         sines(angles.size());
+    std::vector<double>         cosines(angles.size());
+
+    math::SinCos(angles, sines, cosines);
+    CheckSinCos(angles, sines, cosines, 1e-14);
+
+    std::vector<long double>    wide(angles.begin(), angles.end());
+    std::vector<long double>    wideSines(angles.size());
+    std::vector<long double>    wideCosines(angles.size());
+
+    math::SinCos(wide, std::span(wideSines), std::span(wideCosines));
+
+    for (std::size_t index = 0; index < angles.size(); ++index)
+        EXPECT_NEAR(static_cast<double>(wideSines[index]), sines[index], 1e-14);
+}
@@ -0,0 +1,109 @@
+#ifndef __UNIT_TEST_H__
+#define __UNIT_TEST_H__
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Minimal Google Test style harness: TEST(Suite, Name) registers a test,
+// EXPECT_* macros report a failure and keep running the test
+
+namespace test
+{
+    using TestFunction = void (*)(void);
+
+    struct Test
+    {
+        std::string     m_name;
+        TestFunction    m_function;
+    };
+
+
+    inline std::vector<Test>& Registry(void)
+    {
+        static std::vector<Test>    tests;
+
+        return tests;
+    }
+
+
+    struct Registrar
+    {
+        Registrar(const char* name, TestFunction function)
+        {
+            Registry().push_back({ name, function });
+        }
+    };
+
+
+    // Failed expectations in the running test
+    inline int& Failures(void)
+    {
+        static int      failures = 0;
+
+        return failures;
+    }
+
+
+    inline void Fail(const char* file, int line, const char* expression)
+    {
+        std::printf("    %s:%d: expected %s\n", file, line, expression);
+        ++Failures();
+    }
+
+
+    // Run every test whose name contains filter (all if null),
+    // get the number of failed tests
+    inline int RunAll(const char* filter)
+    {
+        int     failedTests = 0;
+        int     runTests = 0;
+
+        for (const Test& test : Registry())
+        {
+            if (filter && !std::strstr(test.m_name.c_str(), filter))
+                continue;
+
+            Failures() = 0;
+            test.m_function();
+            ++runTests;
+
+            if (Failures() != 0)
+            {
+                std::printf("[FAILED] %s\n", test.m_name.c_str());
+                ++failedTests;
+            }
+            else
+                std::printf("[    OK] %s\n", test.m_name.c_str());
+        }
+
+        std::printf("\n%d / %d tests passed\n", runTests - failedTests, runTests);
+        return failedTests;
+    }
+}
+
+#define TEST_CONCAT_IMPL(a, b) a##b
+#define TEST_CONCAT(a, b) TEST_CONCAT_IMPL(a, b)
+
+// Define and register a test function
+#define TEST(suite, name) \
+    static void TEST_CONCAT(suite, _##name)(void); \
+    static test::Registrar TEST_CONCAT(s_registrar, __LINE__)(#suite "." #name, TEST_CONCAT(suite, _##name)); \
+    static void TEST_CONCAT(suite, _##name)(void)
+
+#define EXPECT_TRUE(condition) \
+    do { if (!(condition)) test::Fail(__FILE__, __LINE__, #condition); } while (0)
+
+#define EXPECT_FALSE(condition) \
+    do { if (condition) test::Fail(__FILE__, __LINE__, "!(" #condition ")"); } while (0)
+
+#define EXPECT_EQ(lhs, rhs) \
+    do { if (!((lhs) == (rhs))) test::Fail(__FILE__, __LINE__, #lhs " == " #rhs); } while (0)
+
+#define EXPECT_NEAR(lhs, rhs, tolerance) \
+    do { if (!(std::abs((lhs) - (rhs)) <= (tolerance))) \
+        test::Fail(__FILE__, __LINE__, #lhs " near " #rhs); } while (0)
+
+#endif
@@ -0,0 +1,8 @@
+#include "UnitTest.hpp"
+
+
+// Usage: UnitTest [name filter]
+int main(int argc, char* argv[])
+{
+    return (test::RunAll(argc > 1 ? argv[1] : nullptr) == 0) ? 0 : 1;
+}
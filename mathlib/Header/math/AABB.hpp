@@ -0,0 +1,497 @@
+#ifndef __AABB_H__
+#define __AABB_H__
+
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "MathGeneric.hpp"
+#include "Arithmetic.hpp"
+
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "VectorN.hpp"
+#include "Matrix4.hpp"
+
+namespace math
+{
+    // Axis-aligned bounding box in 2D or 3D, stored as its min and max
+    // corners. A default-constructed box is empty (min > max) so that
+    // merging anything into it gives that thing's bounds
+    template <uint8_t TDimensions, CScalarType TValueType>
+    class AABB
+    {
+        static_assert(TDimensions == 2 || TDimensions == 3, "AABB is only implemented in 2D and 3D");
+
+    public:
+
+        using TVectorType = Vector<TDimensions, TValueType>;
+
+        // Constructors / destructor
+
+        constexpr                       AABB(void);
+        constexpr                       AABB(const TVectorType& min, const TVectorType& max);
+        constexpr                       AABB(const AABB& other) = default;
+
+        constexpr                       ~AABB(void) = default;
+
+        // Box around a set of points (empty if there are none)
+        static constexpr AABB           FromPoints(std::span<const TVectorType> points);
+
+        // Box from its center and half its size on each axis
+        static constexpr AABB           FromCenterExtents(const TVectorType& center, const TVectorType& extents);
+
+        // Box containing nothing, see IsEmpty
+        static constexpr AABB           Empty(void);
+
+        // Is min greater than max on any axis ?
+        constexpr bool                  IsEmpty(void)                                   const;
+
+        constexpr TVectorType           GetCenter(void)                                 const;
+
+        // Half the size on each axis
+        constexpr TVectorType           GetExtents(void)                                const;
+        constexpr TVectorType           GetSize(void)                                   const;
+
+        // Area in 2D, volume in 3D
+        constexpr TValueType            Volume(void)                                    const;
+
+        // Perimeter in 2D, surface area in 3D (e.g. SAH cost)
+        constexpr TValueType            SurfaceArea(void)                               const;
+
+        // Grow this box to include a point or another box
+        constexpr void                  Merge(const TVectorType& point);
+        constexpr void                  Merge(const AABB& other);
+
+        // Grow this box by the same margin on all sides
+        constexpr void                  Expand(TValueType margin);
+
+        constexpr bool                  Contains(const TVectorType& point)              const;
+        constexpr bool                  Contains(const AABB& other)                     const;
+
+        // Do the boxes share at least one point ? (touching boxes overlap)
+        constexpr bool                  Overlaps(const AABB& other)                     const;
+
+        // Get the box both boxes have in common (empty if they do not overlap)
+        constexpr AABB                  Intersection(const AABB& other)                 const;
+
+        // Get the point of this box closest to another point
+        constexpr TVectorType           ClosestPoint(const TVectorType& point)          const;
+
+        // Get the squared distance from a point to this box (0 inside)
+        constexpr TValueType            DistanceSquared(const TVectorType& point)       const;
+
+        // Slab test of the ray origin + t * direction for t in [tMin, tMax].
+        // Takes 1 / direction so it can be computed once per ray (infinite
+        // components are fine). On hit, tNear is the entry distance (tMin
+        // if the origin is inside)
+        constexpr bool                  IntersectRay(const TVectorType& origin, const TVectorType& inverseDirection,
+                                                     TValueType tMin, TValueType tMax,
+                                                     TValueType& tNear)                 const;
+
+        // Get bounds of this box transformed by a column-major matrix (Arvo's
+        // method: transform the center, and project the extents on each axis
+        // with the absolute values of the matrix)
+        constexpr AABB                  Transformed(const Matrix4<TValueType>& matrix)  const
+            requires (TDimensions == 3);
+
+        constexpr const TVectorType&    GetMin(void)                                    const { return m_min; }
+        constexpr const TVectorType&    GetMax(void)                                    const { return m_max; }
+
+        constexpr TVectorType&          Min(void)                                       { return m_min; }
+        constexpr TVectorType&          Max(void)                                       { return m_max; }
+
+        constexpr AABB&                 operator=(const AABB& rhs) = default;
+
+        constexpr bool                  operator==(const AABB& rhs)                     const;
+        constexpr bool                  operator!=(const AABB& rhs)                     const;
+
+    private:
+
+        TVectorType                     m_min;
+        TVectorType                     m_max;
+    };
+
+
+    template <CScalarType TValueType>
+    using AABB2 = AABB<2, TValueType>;
+
+    template <CScalarType TValueType>
+    using AABB3 = AABB<3, TValueType>;
+
+    using AABB2f = AABB2<float>;
+    using AABB2d = AABB2<double>;
+    using AABB3f = AABB3<float>;
+    using AABB3d = AABB3<double>;
+
+
+    // Get box containing both boxes
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType>   Merge(const AABB<TDimensions, TValueType>& first,
+                                          const AABB<TDimensions, TValueType>& second);
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool                            Overlaps(const AABB<TDimensions, TValueType>& first,
+                                             const AABB<TDimensions, TValueType>& second);
+
+
+    // ---- Implementation ---
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType>::AABB(void)
+        : m_min(std::numeric_limits<TValueType>::max()), m_max(std::numeric_limits<TValueType>::lowest())
+    {
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType>::AABB(const TVectorType& min, const TVectorType& max)
+        : m_min(min), m_max(max)
+    {
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType> AABB<TDimensions, TValueType>::FromPoints(std::span<const TVectorType> points)
+    {
+        AABB        result;
+
+        for (const TVectorType& point : points)
+            result.Merge(point);
+
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType> AABB<TDimensions, TValueType>::FromCenterExtents(const TVectorType& center,
+                                                                                   const TVectorType& extents)
+    {
+        return AABB(center - extents, center + extents);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType> AABB<TDimensions, TValueType>::Empty(void)
+    {
+        return AABB();
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool AABB<TDimensions, TValueType>::IsEmpty(void) const
+    {
+        bool        empty = false;
+
+        detail::Unroll<TDimensions>([&](std::size_t axis)
+        {
+            empty = empty || m_min[static_cast<int>(axis)] > m_max[static_cast<int>(axis)];
+        });
+
+        return empty;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> AABB<TDimensions, TValueType>::GetCenter(void) const
+    {
+        return (m_min + m_max) / static_cast<TValueType>(2);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> AABB<TDimensions, TValueType>::GetExtents(void) const
+    {
+        return (m_max - m_min) / static_cast<TValueType>(2);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> AABB<TDimensions, TValueType>::GetSize(void) const
+    {
+        return m_max - m_min;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType AABB<TDimensions, TValueType>::Volume(void) const
+    {
+        if (IsEmpty())
+            return static_cast<TValueType>(0);
+
+        const TVectorType       size = GetSize();
+        TValueType              result = static_cast<TValueType>(1);
+
+        detail::Unroll<TDimensions>([&](std::size_t axis) { result *= size[static_cast<int>(axis)]; });
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType AABB<TDimensions, TValueType>::SurfaceArea(void) const
+    {
+        if (IsEmpty())
+            return static_cast<TValueType>(0);
+
+        const TVectorType       size = GetSize();
+
+        if constexpr (TDimensions == 2)
+            return static_cast<TValueType>(2) * (size[0] + size[1]);
+
+        else
+            return static_cast<TValueType>(2) * (size[0] * size[1] + size[1] * size[2] + size[2] * size[0]);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    void AABB<TDimensions, TValueType>::Merge(const TVectorType& point)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int       axis = static_cast<int>(index);
+
+            m_min[axis] = math::Min(m_min[axis], point[axis]);
+            m_max[axis] = math::Max(m_max[axis], point[axis]);
+        });
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    void AABB<TDimensions, TValueType>::Merge(const AABB& other)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int       axis = static_cast<int>(index);
+
+            m_min[axis] = math::Min(m_min[axis], other.m_min[axis]);
+            m_max[axis] = math::Max(m_max[axis], other.m_max[axis]);
+        });
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    void AABB<TDimensions, TValueType>::Expand(TValueType margin)
+    {
+        const TVectorType       offset(margin);
+
+        m_min -= offset;
+        m_max += offset;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool AABB<TDimensions, TValueType>::Contains(const TVectorType& point) const
+    {
+        bool        inside = true;
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int       axis = static_cast<int>(index);
+
+            inside = inside && m_min[axis] <= point[axis] && point[axis] <= m_max[axis];
+        });
+
+        return inside;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool AABB<TDimensions, TValueType>::Contains(const AABB& other) const
+    {
+        bool        inside = true;
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int       axis = static_cast<int>(index);
+
+            inside = inside && m_min[axis] <= other.m_min[axis] && other.m_max[axis] <= m_max[axis];
+        });
+
+        return inside;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool AABB<TDimensions, TValueType>::Overlaps(const AABB& other) const
+    {
+        // Separated if there is a gap on any axis. Evaluate all axes
+        // without early outs so there is no branch to mispredict
+        bool        overlap = true;
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int       axis = static_cast<int>(index);
+
+            overlap &= (m_min[axis] <= other.m_max[axis]) & (other.m_min[axis] <= m_max[axis]);
+        });
+
+        return overlap;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType> AABB<TDimensions, TValueType>::Intersection(const AABB& other) const
+    {
+        AABB        result;
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int       axis = static_cast<int>(index);
+
+            result.m_min[axis] = math::Max(m_min[axis], other.m_min[axis]);
+            result.m_max[axis] = math::Min(m_max[axis], other.m_max[axis]);
+        });
+
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> AABB<TDimensions, TValueType>::ClosestPoint(const TVectorType& point) const
+    {
+        TVectorType     result = point;
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int       axis = static_cast<int>(index);
+
+            result[axis] = Clamp(point[axis], m_min[axis], m_max[axis]);
+        });
+
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType AABB<TDimensions, TValueType>::DistanceSquared(const TVectorType& point) const
+    {
+        TValueType      result = static_cast<TValueType>(0);
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int           axis = static_cast<int>(index);
+            const TValueType    below = math::Max(m_min[axis] - point[axis], static_cast<TValueType>(0));
+            const TValueType    above = math::Max(point[axis] - m_max[axis], static_cast<TValueType>(0));
+
+            // At most one of them is not zero
+            result += below * below + above * above;
+        });
+
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool AABB<TDimensions, TValueType>::IntersectRay(const TVectorType& origin, const TVectorType& inverseDirection,
+                                                     TValueType tMin, TValueType tMax, TValueType& tNear) const
+    {
+        TValueType      entry = tMin;
+        TValueType      exit = tMax;
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            const int           axis = static_cast<int>(index);
+            const TValueType    first = (m_min[axis] - origin[axis]) * inverseDirection[axis];
+            const TValueType    second = (m_max[axis] - origin[axis]) * inverseDirection[axis];
+
+            // A ray starting on a slab plane and parallel to it gives
+            // 0 * inf = NaN. It stays on that face of the box, so the axis
+            // does not limit the interval (a zero direction of either sign
+            // on the min or max plane is a touching hit)
+            if (first != first || second != second)
+                return;
+
+            entry = math::Max(math::Min(first, second), entry);
+            exit = math::Min(math::Max(first, second), exit);
+        });
+
+        tNear = entry;
+        return entry <= exit;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType> AABB<TDimensions, TValueType>::Transformed(const Matrix4<TValueType>& matrix) const
+        requires (TDimensions == 3)
+    {
+        if (IsEmpty())
+            return AABB();
+
+        const TVectorType       center = GetCenter();
+        const TVectorType       extents = GetExtents();
+
+        // Column-major: values[column * 4 + row]
+        const TValueType*       values = matrix.Data();
+
+        const TValueType        m00 = values[0], m01 = values[4], m02 = values[8], m03 = values[12];
+        const TValueType        m10 = values[1], m11 = values[5], m12 = values[9], m13 = values[13];
+        const TValueType        m20 = values[2], m21 = values[6], m22 = values[10], m23 = values[14];
+
+        const TValueType        x = center.GetX(), y = center.GetY(), z = center.GetZ();
+        const TValueType        extentX = extents.GetX(), extentY = extents.GetY(), extentZ = extents.GetZ();
+
+        const TVectorType       resultCenter(m00 * x + m01 * y + m02 * z + m03,
+                                             m10 * x + m11 * y + m12 * z + m13,
+                                             m20 * x + m21 * y + m22 * z + m23);
+
+        // Each corner adds or removes each extent, the furthest one
+        // along an axis picks the sign matching each matrix value
+        const TVectorType       resultExtents(
+            Absolute(m00) * extentX + Absolute(m01) * extentY + Absolute(m02) * extentZ,
+            Absolute(m10) * extentX + Absolute(m11) * extentY + Absolute(m12) * extentZ,
+            Absolute(m20) * extentX + Absolute(m21) * extentY + Absolute(m22) * extentZ
+        );
+
+        return AABB(resultCenter - resultExtents, resultCenter + resultExtents);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool AABB<TDimensions, TValueType>::operator==(const AABB& rhs) const
+    {
+        return m_min == rhs.m_min && m_max == rhs.m_max;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool AABB<TDimensions, TValueType>::operator!=(const AABB& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    AABB<TDimensions, TValueType> Merge(const AABB<TDimensions, TValueType>& first,
+                                        const AABB<TDimensions, TValueType>& second)
+    {
+        AABB<TDimensions, TValueType>   result = first;
+
+        result.Merge(second);
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool Overlaps(const AABB<TDimensions, TValueType>& first, const AABB<TDimensions, TValueType>& second)
+    {
+        return first.Overlaps(second);
+    }
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class AABB<2, float>;
+    extern template class AABB<2, double>;
+    extern template class AABB<3, float>;
+    extern template class AABB<3, double>;
+}
+
+#endif
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
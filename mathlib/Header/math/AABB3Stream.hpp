@@ -0,0 +1,538 @@
+#ifndef __AABB3_STREAM_H__
+#define __AABB3_STREAM_H__
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "MathGeneric.hpp"
+#include "AlignedAllocator.hpp"
+#include "Simd.hpp"
+
+#include "Vector3.hpp"
+#include "AABB.hpp"
+
+namespace math
+{
+    // Structure-of-arrays container of 3D boxes: all min x are stored
+    // contiguously, then all min y, ... then all max z, so one box can be
+    // tested against many others on full SIMD lanes (e.g. broadphase)
+    template <CScalarType TValueType>
+    class AABB3Stream
+    {
+    public:
+
+        // Every lane starts on a cache line
+        static constexpr std::size_t    Alignment = 64;
+
+        using TLaneType = std::vector<TValueType, AlignedAllocator<TValueType, Alignment>>;
+
+
+        // Constructors / destructor
+
+                    AABB3Stream(void) = default;
+        explicit    AABB3Stream(std::span<const AABB3<TValueType>> boxes);
+
+                    AABB3Stream(const AABB3Stream&) = default;
+                    AABB3Stream(AABB3Stream&&) noexcept = default;
+
+                    ~AABB3Stream(void) = default;
+
+        // Number of boxes
+        std::size_t             Size(void)                                  const;
+        bool                    Empty(void)                                 const;
+
+        // New boxes are empty (see AABB::IsEmpty) and overlap nothing
+        void                    Resize(std::size_t size);
+        void                    Reserve(std::size_t capacity);
+        void                    Clear(void);
+
+        void                    PushBack(const AABB3<TValueType>& box);
+
+        // Gather / scatter a single box
+        AABB3<TValueType>       Get(std::size_t index)                      const;
+        void                    Set(std::size_t index, const AABB3<TValueType>& box);
+
+        // Get box containing all boxes
+        AABB3<TValueType>       GetBounds(void)                             const;
+
+        // Lane accessors
+        TValueType*             MinX(void);
+        TValueType*             MinY(void);
+        TValueType*             MinZ(void);
+        TValueType*             MaxX(void);
+        TValueType*             MaxY(void);
+        TValueType*             MaxZ(void);
+
+        const TValueType*       MinX(void)                                  const;
+        const TValueType*       MinY(void)                                  const;
+        const TValueType*       MinZ(void)                                  const;
+        const TValueType*       MaxX(void)                                  const;
+        const TValueType*       MaxY(void)                                  const;
+        const TValueType*       MaxZ(void)                                  const;
+
+        AABB3Stream&            operator=(const AABB3Stream&) = default;
+        AABB3Stream&            operator=(AABB3Stream&&) noexcept = default;
+
+    private:
+
+        TLaneType               m_minX;
+        TLaneType               m_minY;
+        TLaneType               m_minZ;
+        TLaneType               m_maxX;
+        TLaneType               m_maxY;
+        TLaneType               m_maxZ;
+    };
+
+
+    // Non-member batch kernels, testing one box against all boxes of a
+    // stream. Same rules as AABB::Overlaps (touching boxes overlap)
+
+    // out[i] = box overlaps boxes[i] (out must hold Size() values)
+    template <CScalarType TValueType> inline
+    void            Overlaps
+    (
+        const AABB3Stream<TValueType>& boxes, const AABB3<TValueType>& box,
+        std::span<uint8_t> out
+    );
+
+    // Append indices of all boxes overlapping box to indices, in increasing
+    // order, and get how many were appended
+    template <CScalarType TValueType> inline
+    std::size_t     Overlaps
+    (
+        const AABB3Stream<TValueType>& boxes, const AABB3<TValueType>& box,
+        std::vector<uint32_t>& indices
+    );
+
+    using AABB3fStream = AABB3Stream<float>;
+    using AABB3dStream = AABB3Stream<double>;
+
+
+
+
+// ---- Implementation ----
+
+    template <CScalarType TValueType> inline
+    AABB3Stream<TValueType>::AABB3Stream(std::span<const AABB3<TValueType>> boxes)
+    {
+        Resize(boxes.size());
+
+        for (std::size_t index = 0; index < boxes.size(); ++index)
+            Set(index, boxes[index]);
+    }
+
+
+    template <CScalarType TValueType> inline
+    std::size_t AABB3Stream<TValueType>::Size(void) const
+    {
+        return m_minX.size();
+    }
+
+
+    template <CScalarType TValueType> inline
+    bool AABB3Stream<TValueType>::Empty(void) const
+    {
+        return m_minX.empty();
+    }
+
+
+    template <CScalarType TValueType> inline
+    void AABB3Stream<TValueType>::Resize(std::size_t size)
+    {
+        const AABB3<TValueType>     empty;
+
+        m_minX.resize(size, empty.GetMin().GetX());
+        m_minY.resize(size, empty.GetMin().GetY());
+        m_minZ.resize(size, empty.GetMin().GetZ());
+        m_maxX.resize(size, empty.GetMax().GetX());
+        m_maxY.resize(size, empty.GetMax().GetY());
+        m_maxZ.resize(size, empty.GetMax().GetZ());
+    }
+
+
+    template <CScalarType TValueType> inline
+    void AABB3Stream<TValueType>::Reserve(std::size_t capacity)
+    {
+        m_minX.reserve(capacity);
+        m_minY.reserve(capacity);
+        m_minZ.reserve(capacity);
+        m_maxX.reserve(capacity);
+        m_maxY.reserve(capacity);
+        m_maxZ.reserve(capacity);
+    }
+
+
+    template <CScalarType TValueType> inline
+    void AABB3Stream<TValueType>::Clear(void)
+    {
+        m_minX.clear();
+        m_minY.clear();
+        m_minZ.clear();
+        m_maxX.clear();
+        m_maxY.clear();
+        m_maxZ.clear();
+    }
+
+
+    template <CScalarType TValueType> inline
+    void AABB3Stream<TValueType>::PushBack(const AABB3<TValueType>& box)
+    {
+        m_minX.push_back(box.GetMin().GetX());
+        m_minY.push_back(box.GetMin().GetY());
+        m_minZ.push_back(box.GetMin().GetZ());
+        m_maxX.push_back(box.GetMax().GetX());
+        m_maxY.push_back(box.GetMax().GetY());
+        m_maxZ.push_back(box.GetMax().GetZ());
+    }
+
+
+    template <CScalarType TValueType> inline
+    AABB3<TValueType> AABB3Stream<TValueType>::Get(std::size_t index) const
+    {
+        return AABB3<TValueType>(Vector3<TValueType>(m_minX[index], m_minY[index], m_minZ[index]),
+                                 Vector3<TValueType>(m_maxX[index], m_maxY[index], m_maxZ[index]));
+    }
+
+
+    template <CScalarType TValueType> inline
+    void AABB3Stream<TValueType>::Set(std::size_t index, const AABB3<TValueType>& box)
+    {
+        m_minX[index] = box.GetMin().GetX();
+        m_minY[index] = box.GetMin().GetY();
+        m_minZ[index] = box.GetMin().GetZ();
+        m_maxX[index] = box.GetMax().GetX();
+        m_maxY[index] = box.GetMax().GetY();
+        m_maxZ[index] = box.GetMax().GetZ();
+    }
+
+
+    template <CScalarType TValueType> inline
+    AABB3<TValueType> AABB3Stream<TValueType>::GetBounds(void) const
+    {
+        AABB3<TValueType>       result;
+
+        for (std::size_t index = 0; index < Size(); ++index)
+            result.Merge(Get(index));
+
+        return result;
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* AABB3Stream<TValueType>::MinX(void)
+    {
+        return m_minX.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* AABB3Stream<TValueType>::MinY(void)
+    {
+        return m_minY.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* AABB3Stream<TValueType>::MinZ(void)
+    {
+        return m_minZ.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* AABB3Stream<TValueType>::MaxX(void)
+    {
+        return m_maxX.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* AABB3Stream<TValueType>::MaxY(void)
+    {
+        return m_maxY.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* AABB3Stream<TValueType>::MaxZ(void)
+    {
+        return m_maxZ.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* AABB3Stream<TValueType>::MinX(void) const
+    {
+        return m_minX.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* AABB3Stream<TValueType>::MinY(void) const
+    {
+        return m_minY.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* AABB3Stream<TValueType>::MinZ(void) const
+    {
+        return m_minZ.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* AABB3Stream<TValueType>::MaxX(void) const
+    {
+        return m_maxX.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* AABB3Stream<TValueType>::MaxY(void) const
+    {
+        return m_maxY.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* AABB3Stream<TValueType>::MaxZ(void) const
+    {
+        return m_maxZ.data();
+    }
+
+
+#ifdef MTH_SIMD_SSE
+
+    namespace simd
+    {
+        // Overlap of four boxes starting at index, one all-ones lane per
+        // overlapping box. Lanes are 64-byte aligned and index is a
+        // multiple of the box count, so loads are aligned
+        inline __m128   Overlap4(const AABB3Stream<float>& boxes, std::size_t index,
+                                 const __m128 (&queryMin)[3], const __m128 (&queryMax)[3]) noexcept
+        {
+            __m128      result = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(boxes.MinX() + index), queryMax[0]),
+                                            _mm_cmple_ps(queryMin[0], _mm_load_ps(boxes.MaxX() + index)));
+
+            result = _mm_and_ps(result, _mm_cmple_ps(_mm_load_ps(boxes.MinY() + index), queryMax[1]));
+            result = _mm_and_ps(result, _mm_cmple_ps(queryMin[1], _mm_load_ps(boxes.MaxY() + index)));
+            result = _mm_and_ps(result, _mm_cmple_ps(_mm_load_ps(boxes.MinZ() + index), queryMax[2]));
+            result = _mm_and_ps(result, _mm_cmple_ps(queryMin[2], _mm_load_ps(boxes.MaxZ() + index)));
+
+            return result;
+        }
+
+
+        // Overlap bits of two double precision boxes starting at index
+        // (bit n set if box index + n overlaps)
+        inline int      OverlapMask2(const AABB3Stream<double>& boxes, std::size_t index,
+                                     const __m128d (&queryMin)[3], const __m128d (&queryMax)[3]) noexcept
+        {
+            __m128d     result = _mm_and_pd(_mm_cmple_pd(_mm_load_pd(boxes.MinX() + index), queryMax[0]),
+                                            _mm_cmple_pd(queryMin[0], _mm_load_pd(boxes.MaxX() + index)));
+
+            result = _mm_and_pd(result, _mm_cmple_pd(_mm_load_pd(boxes.MinY() + index), queryMax[1]));
+            result = _mm_and_pd(result, _mm_cmple_pd(queryMin[1], _mm_load_pd(boxes.MaxY() + index)));
+            result = _mm_and_pd(result, _mm_cmple_pd(_mm_load_pd(boxes.MinZ() + index), queryMax[2]));
+            result = _mm_and_pd(result, _mm_cmple_pd(queryMin[2], _mm_load_pd(boxes.MaxZ() + index)));
+
+            return _mm_movemask_pd(result);
+        }
+    }
+
+#endif
+
+
+    template <CScalarType TValueType> inline
+    void Overlaps
+    (
+        const AABB3Stream<TValueType>& boxes, const AABB3<TValueType>& box,
+        std::span<uint8_t> out
+    )
+    {
+        const std::size_t       size = boxes.Size();
+
+        if (out.size() != size)
+            throw std::logic_error("Output span size does not match input");
+
+        const TValueType        queryMinX = box.GetMin().GetX(), queryMaxX = box.GetMax().GetX();
+        const TValueType        queryMinY = box.GetMin().GetY(), queryMaxY = box.GetMax().GetY();
+        const TValueType        queryMinZ = box.GetMin().GetZ(), queryMaxZ = box.GetMax().GetZ();
+
+        const TValueType        *minX = boxes.MinX(), *minY = boxes.MinY(), *minZ = boxes.MinZ();
+        const TValueType        *maxX = boxes.MaxX(), *maxY = boxes.MaxY(), *maxZ = boxes.MaxZ();
+
+        std::size_t             index = 0;
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            const __m128    queryMin[3] = { _mm_set1_ps(queryMinX), _mm_set1_ps(queryMinY),
+                                            _mm_set1_ps(queryMinZ) };
+            const __m128    queryMax[3] = { _mm_set1_ps(queryMaxX), _mm_set1_ps(queryMaxY),
+                                            _mm_set1_ps(queryMaxZ) };
+
+            const __m128i   one = _mm_set1_epi32(1);
+
+            for (; index + 4 <= size; index += 4)
+            {
+                // Narrow the four 0 / 1 lanes to bytes, then store them at once
+                const __m128    overlap = simd::Overlap4(boxes, index, queryMin, queryMax);
+                __m128i         bytes = _mm_and_si128(_mm_castps_si128(overlap), one);
+
+                bytes = _mm_packs_epi32(bytes, bytes);
+                bytes = _mm_packus_epi16(bytes, bytes);
+
+                const int       packed = _mm_cvtsi128_si32(bytes);
+
+                std::memcpy(out.data() + index, &packed, sizeof(packed));
+            }
+        }
+
+        else if constexpr (std::is_same_v<TValueType, double>)
+        {
+            const __m128d   queryMin[3] = { _mm_set1_pd(queryMinX), _mm_set1_pd(queryMinY),
+                                            _mm_set1_pd(queryMinZ) };
+            const __m128d   queryMax[3] = { _mm_set1_pd(queryMaxX), _mm_set1_pd(queryMaxY),
+                                            _mm_set1_pd(queryMaxZ) };
+
+            for (; index + 2 <= size; index += 2)
+            {
+                const int   mask = simd::OverlapMask2(boxes, index, queryMin, queryMax);
+
+                out[index] = static_cast<uint8_t>(mask & 1);
+                out[index + 1] = static_cast<uint8_t>((mask >> 1) & 1);
+            }
+        }
+#endif
+
+        // Non-short-circuiting & keeps the loop branchless
+        for (; index < size; ++index)
+        {
+            out[index] = static_cast<uint8_t>((minX[index] <= queryMaxX) & (queryMinX <= maxX[index]) &
+                                              (minY[index] <= queryMaxY) & (queryMinY <= maxY[index]) &
+                                              (minZ[index] <= queryMaxZ) & (queryMinZ <= maxZ[index]));
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    std::size_t Overlaps
+    (
+        const AABB3Stream<TValueType>& boxes, const AABB3<TValueType>& box,
+        std::vector<uint32_t>& indices
+    )
+    {
+        const std::size_t       size = boxes.Size();
+        const std::size_t       start = indices.size();
+
+        if (size > UINT32_MAX)
+            throw std::logic_error("Too many boxes to index");
+
+        const TValueType        queryMinX = box.GetMin().GetX(), queryMaxX = box.GetMax().GetX();
+        const TValueType        queryMinY = box.GetMin().GetY(), queryMaxY = box.GetMax().GetY();
+        const TValueType        queryMinZ = box.GetMin().GetZ(), queryMaxZ = box.GetMax().GetZ();
+
+        const TValueType        *minX = boxes.MinX(), *minY = boxes.MinY(), *minZ = boxes.MinZ();
+        const TValueType        *maxX = boxes.MaxX(), *maxY = boxes.MaxY(), *maxZ = boxes.MaxZ();
+
+        // Hits of each block are gathered on the stack, then appended at
+        // once, so indices only grow by the number of overlaps. simdHits
+        // tests whole registers from the start of a block and returns the
+        // index the scalar loop goes on from
+        const auto              scan = [&](auto simdHits)
+        {
+            constexpr std::size_t   blockSize = 64;
+            uint32_t                hits[blockSize];
+
+            for (std::size_t blockStart = 0; blockStart < size; blockStart += blockSize)
+            {
+                const std::size_t   blockEnd = (size - blockStart < blockSize) ? size : blockStart + blockSize;
+                std::size_t         count = 0;
+                std::size_t         index = simdHits(blockStart, blockEnd, hits, count);
+
+                // Each index is written unconditionally and only kept if the box overlaps
+                for (; index < blockEnd; ++index)
+                {
+                    hits[count] = static_cast<uint32_t>(index);
+                    count += static_cast<std::size_t>((minX[index] <= queryMaxX) & (queryMinX <= maxX[index]) &
+                                                      (minY[index] <= queryMaxY) & (queryMinY <= maxY[index]) &
+                                                      (minZ[index] <= queryMaxZ) & (queryMinZ <= maxZ[index]));
+                }
+
+                indices.insert(indices.end(), hits, hits + count);
+            }
+        };
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            const __m128    queryMin[3] = { _mm_set1_ps(queryMinX), _mm_set1_ps(queryMinY),
+                                            _mm_set1_ps(queryMinZ) };
+            const __m128    queryMax[3] = { _mm_set1_ps(queryMaxX), _mm_set1_ps(queryMaxY),
+                                            _mm_set1_ps(queryMaxZ) };
+
+            scan([&](std::size_t index, std::size_t blockEnd, uint32_t* hits, std::size_t& count)
+            {
+                for (; index + 4 <= blockEnd; index += 4)
+                {
+                    // Only visit set bits
+                    const __m128    overlap = simd::Overlap4(boxes, index, queryMin, queryMax);
+
+                    for (unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(overlap));
+                         mask != 0; mask &= mask - 1)
+                    {
+                        hits[count++] = static_cast<uint32_t>(index + static_cast<std::size_t>(std::countr_zero(mask)));
+                    }
+                }
+
+                return index;
+            });
+
+            return indices.size() - start;
+        }
+
+        else if constexpr (std::is_same_v<TValueType, double>)
+        {
+            const __m128d   queryMin[3] = { _mm_set1_pd(queryMinX), _mm_set1_pd(queryMinY),
+                                            _mm_set1_pd(queryMinZ) };
+            const __m128d   queryMax[3] = { _mm_set1_pd(queryMaxX), _mm_set1_pd(queryMaxY),
+                                            _mm_set1_pd(queryMaxZ) };
+
+            scan([&](std::size_t index, std::size_t blockEnd, uint32_t* hits, std::size_t& count)
+            {
+                for (; index + 2 <= blockEnd; index += 2)
+                {
+                    const int       overlap = simd::OverlapMask2(boxes, index, queryMin, queryMax);
+
+                    for (unsigned int mask = static_cast<unsigned int>(overlap); mask != 0; mask &= mask - 1)
+                    {
+                        hits[count++] = static_cast<uint32_t>(index + static_cast<std::size_t>(std::countr_zero(mask)));
+                    }
+                }
+
+                return index;
+            });
+
+            return indices.size() - start;
+        }
+#endif
+
+        scan([](std::size_t index, std::size_t, uint32_t*, std::size_t&) { return index; });
+
+        return indices.size() - start;
+    }
+
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -0,0 +1,464 @@
+#ifndef __AFFINE3_H__
+#define __AFFINE3_H__
+
+#include <cassert>
+
+#include "MathGeneric.hpp"
+#include "Arithmetic.hpp"
+
+#include "Vector3.hpp"
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+#include "Quaternion.hpp"
+
+namespace math
+{
+    // Affine transform stored as the upper 3x4 part of a column-major
+    // Matrix4: three linear columns then the translation column.
+    // The implicit last row is always (0, 0, 0, 1)
+    template <CFloatingType TValueType>
+    class Affine3
+    {
+    public:
+
+        constexpr               Affine3(void) = default;
+        constexpr               Affine3(const Affine3&) = default;
+
+        constexpr               Affine3(const Vector3<TValueType>& columnX, const Vector3<TValueType>& columnY,
+                                        const Vector3<TValueType>& columnZ, const Vector3<TValueType>& translation);
+
+        constexpr               Affine3(const Matrix3<TValueType>& linear, const Vector3<TValueType>& translation);
+
+        // Drop the last row of an affine Matrix4
+        explicit constexpr      Affine3(const Matrix4<TValueType>& matrix);
+
+        // translation * rotation * scale, without building intermediate matrices
+                                Affine3(const Quaternion<TValueType>& rotation, const Vector3<TValueType>& translation,
+                                        const Vector3<TValueType>& scale = Vector3<TValueType>(static_cast<TValueType>(1)));
+
+        constexpr               ~Affine3(void) = default;
+
+        // Get inverse of this transform (linear part must be invertible)
+        constexpr Affine3               Inverse(void)                                           const;
+
+        // Get inverse of a rigid transform (orthonormal rotation and translation only)
+        constexpr Affine3               InverseOrthonormal(void)                                const;
+
+        // Transform a point (w = 1)
+        constexpr Vector3<TValueType>   TransformPoint(const Vector3<TValueType>& point)        const;
+
+        // Transform a direction (w = 0, translation is ignored)
+        constexpr Vector3<TValueType>   TransformDirection(const Vector3<TValueType>& direction) const;
+
+        // Split into translation, rotation and scale. Negative determinants
+        // are given a negative X scale, shear is not supported
+        void                            Decompose(Vector3<TValueType>& translation, Quaternion<TValueType>& rotation,
+                                                  Vector3<TValueType>& scale)                   const;
+
+        constexpr Matrix3<TValueType>   Linear(void)                                            const;
+        constexpr Matrix4<TValueType>   ToMatrix4(void)                                         const;
+
+        explicit constexpr              operator Matrix4<TValueType>(void)                      const;
+
+        constexpr Affine3&              operator=(const Affine3& rhs) = default;
+
+        // Compose transforms, rhs is applied first
+        constexpr Affine3               operator*(const Affine3& rhs)                           const;
+        constexpr Affine3&              operator*=(const Affine3& rhs);
+
+        constexpr bool                  operator==(const Affine3& rhs)                          const;
+        constexpr bool                  operator!=(const Affine3& rhs)                          const;
+
+        // Columns 0 to 2 are the linear part, 3 is the translation.
+        // No bound checking outside debug builds, like Matrix4
+        constexpr Vector3<TValueType>&          operator[](int column);
+        constexpr const Vector3<TValueType>&    operator[](int column)                          const;
+
+        constexpr Vector3<TValueType>   GetTranslation(void)                                    const;
+        constexpr void                  SetTranslation(const Vector3<TValueType>& translation);
+
+        static constexpr Affine3        Identity(void);
+        static constexpr Affine3        PositionMatrix(const Vector3<TValueType>& position);
+        static constexpr Affine3        ScaleMatrix(const Vector3<TValueType>& scale);
+
+        // 12 contiguous values, column after column
+        TValueType*                     Data(void);
+        const TValueType*               Data(void)                                              const;
+
+    private:
+
+        Vector3<TValueType>             m_columns[4];
+    };
+
+
+    using Affine3f = Affine3<float>;
+    using Affine3d = Affine3<double>;
+
+
+    // Convert an array of quaternions to rotations (see Quaternion::RotationMatrix).
+    // Both spans must have the same size. As for the Matrix3 / Matrix4
+    // versions, the type is deduced from the output span and the float and
+    // double overloads also take containers directly
+    template <CFloatingType TValueType>
+    void                RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                         std::span<Affine3<TValueType>> out);
+
+    inline void         RotationMatrices(std::span<const Quaternion<float>> rotations, std::span<Affine3<float>> out);
+    inline void         RotationMatrices(std::span<const Quaternion<double>> rotations, std::span<Affine3<double>> out);
+
+    // Build one rotation then translation transform per pair (e.g. a
+    // skinning palette). All spans must have the same size
+    template <CFloatingType TValueType>
+    void                TransformMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                          std::type_identity_t<std::span<const Vector3<TValueType>>> translations,
+                                          std::span<Affine3<TValueType>> out);
+
+    inline void         TransformMatrices(std::span<const Quaternion<float>> rotations,
+                                          std::span<const Vector3<float>> translations, std::span<Affine3<float>> out);
+    inline void         TransformMatrices(std::span<const Quaternion<double>> rotations,
+                                          std::span<const Vector3<double>> translations, std::span<Affine3<double>> out);
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType>::Affine3(const Vector3<TValueType>& columnX, const Vector3<TValueType>& columnY,
+                                 const Vector3<TValueType>& columnZ, const Vector3<TValueType>& translation)
+        : m_columns{ columnX, columnY, columnZ, translation }
+    {
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType>::Affine3(const Matrix3<TValueType>& linear, const Vector3<TValueType>& translation)
+        : m_columns{ linear[0], linear[1], linear[2], translation }
+    {
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType>::Affine3(const Matrix4<TValueType>& matrix)
+    {
+        for (int column = 0; column < 4; ++column)
+            m_columns[column] = Vector3<TValueType>(matrix[column][0], matrix[column][1], matrix[column][2]);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    Affine3<TValueType>::Affine3(const Quaternion<TValueType>& rotation, const Vector3<TValueType>& translation,
+                                 const Vector3<TValueType>& scale)
+    {
+        // Same terms as Quaternion::RotationMatrix, each column scaled
+        const TValueType        w = rotation.GetW(), x = rotation.GetX(), y = rotation.GetY(), z = rotation.GetZ();
+        const TValueType        two = static_cast<TValueType>(2), one = static_cast<TValueType>(1);
+
+        const TValueType        xx = x * x, yy = y * y, zz = z * z;
+        const TValueType        xy = x * y, xz = x * z, yz = y * z;
+        const TValueType        wx = w * x, wy = w * y, wz = w * z;
+
+        m_columns[0] = Vector3<TValueType>(one - two * (yy + zz), two * (xy + wz), two * (xz - wy)) * scale.GetX();
+        m_columns[1] = Vector3<TValueType>(two * (xy - wz), one - two * (xx + zz), two * (yz + wx)) * scale.GetY();
+        m_columns[2] = Vector3<TValueType>(two * (xz + wy), two * (yz - wx), one - two * (xx + yy)) * scale.GetZ();
+        m_columns[3] = translation;
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType> Affine3<TValueType>::Inverse(void) const
+    {
+        // Rows of the inverse linear part are cross products of its
+        // columns divided by the determinant
+        const Vector3<TValueType>   row0 = m_columns[1].Cross(m_columns[2]);
+        const Vector3<TValueType>   row1 = m_columns[2].Cross(m_columns[0]);
+        const Vector3<TValueType>   row2 = m_columns[0].Cross(m_columns[1]);
+
+        const TValueType            invDeterminant = static_cast<TValueType>(1) / m_columns[0].Dot(row0);
+
+        const Vector3<TValueType>   scaledRow0 = row0 * invDeterminant;
+        const Vector3<TValueType>   scaledRow1 = row1 * invDeterminant;
+        const Vector3<TValueType>   scaledRow2 = row2 * invDeterminant;
+
+        return Affine3
+        (
+            Vector3<TValueType>(scaledRow0.GetX(), scaledRow1.GetX(), scaledRow2.GetX()),
+            Vector3<TValueType>(scaledRow0.GetY(), scaledRow1.GetY(), scaledRow2.GetY()),
+            Vector3<TValueType>(scaledRow0.GetZ(), scaledRow1.GetZ(), scaledRow2.GetZ()),
+            -Vector3<TValueType>(scaledRow0.Dot(m_columns[3]), scaledRow1.Dot(m_columns[3]), scaledRow2.Dot(m_columns[3]))
+        );
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType> Affine3<TValueType>::InverseOrthonormal(void) const
+    {
+        // Transposed rotation, translation brought back by it
+        return Affine3
+        (
+            Vector3<TValueType>(m_columns[0].GetX(), m_columns[1].GetX(), m_columns[2].GetX()),
+            Vector3<TValueType>(m_columns[0].GetY(), m_columns[1].GetY(), m_columns[2].GetY()),
+            Vector3<TValueType>(m_columns[0].GetZ(), m_columns[1].GetZ(), m_columns[2].GetZ()),
+            -Vector3<TValueType>(m_columns[0].Dot(m_columns[3]), m_columns[1].Dot(m_columns[3]), m_columns[2].Dot(m_columns[3]))
+        );
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Vector3<TValueType> Affine3<TValueType>::TransformPoint(const Vector3<TValueType>& point) const
+    {
+        return m_columns[0] * point.GetX() + m_columns[1] * point.GetY() +
+               m_columns[2] * point.GetZ() + m_columns[3];
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Vector3<TValueType> Affine3<TValueType>::TransformDirection(const Vector3<TValueType>& direction) const
+    {
+        return m_columns[0] * direction.GetX() + m_columns[1] * direction.GetY() +
+               m_columns[2] * direction.GetZ();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void Affine3<TValueType>::Decompose(Vector3<TValueType>& translation, Quaternion<TValueType>& rotation,
+                                        Vector3<TValueType>& scale) const
+    {
+        translation = m_columns[3];
+
+        scale = Vector3<TValueType>(m_columns[0].Magnitude(), m_columns[1].Magnitude(), m_columns[2].Magnitude());
+
+        // A mirrored basis cannot be a rotation, flip one axis
+        if (m_columns[0].Dot(m_columns[1].Cross(m_columns[2])) < static_cast<TValueType>(0))
+            scale.X() = -scale.GetX();
+
+        rotation = Quaternion<TValueType>::FromAxes(m_columns[0] / scale.GetX(), m_columns[1] / scale.GetY(),
+                                                    m_columns[2] / scale.GetZ());
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Matrix3<TValueType> Affine3<TValueType>::Linear(void) const
+    {
+        Matrix3<TValueType>     result;
+
+        for (int column = 0; column < 3; ++column)
+            result[column] = m_columns[column];
+
+        return result;
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Matrix4<TValueType> Affine3<TValueType>::ToMatrix4(void) const
+    {
+        Matrix4<TValueType>     result;
+
+        for (int column = 0; column < 4; ++column)
+        {
+            result[column] = Vector4<TValueType>(m_columns[column].GetX(), m_columns[column].GetY(),
+                                                 m_columns[column].GetZ(), static_cast<TValueType>(0));
+        }
+
+        result[3][3] = static_cast<TValueType>(1);
+
+        return result;
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType>::operator Matrix4<TValueType>(void) const
+    {
+        return ToMatrix4();
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType> Affine3<TValueType>::operator*(const Affine3<TValueType>& rhs) const
+    {
+        // 36 multiplications instead of 64 for a full Matrix4 product
+        return Affine3
+        (
+            TransformDirection(rhs.m_columns[0]),
+            TransformDirection(rhs.m_columns[1]),
+            TransformDirection(rhs.m_columns[2]),
+            TransformPoint(rhs.m_columns[3])
+        );
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType>& Affine3<TValueType>::operator*=(const Affine3<TValueType>& rhs)
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    bool Affine3<TValueType>::operator==(const Affine3<TValueType>& rhs) const
+    {
+        return m_columns[0] == rhs.m_columns[0] && m_columns[1] == rhs.m_columns[1] &&
+               m_columns[2] == rhs.m_columns[2] && m_columns[3] == rhs.m_columns[3];
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    bool Affine3<TValueType>::operator!=(const Affine3<TValueType>& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Vector3<TValueType>& Affine3<TValueType>::operator[](int column)
+    {
+        assert(column >= 0 && column < 4);
+
+        return m_columns[column];
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    const Vector3<TValueType>& Affine3<TValueType>::operator[](int column) const
+    {
+        assert(column >= 0 && column < 4);
+
+        return m_columns[column];
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Vector3<TValueType> Affine3<TValueType>::GetTranslation(void) const
+    {
+        return m_columns[3];
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    void Affine3<TValueType>::SetTranslation(const Vector3<TValueType>& translation)
+    {
+        m_columns[3] = translation;
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType> Affine3<TValueType>::Identity(void)
+    {
+        return ScaleMatrix(Vector3<TValueType>(static_cast<TValueType>(1)));
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType> Affine3<TValueType>::PositionMatrix(const Vector3<TValueType>& position)
+    {
+        const TValueType    zero = static_cast<TValueType>(0), one = static_cast<TValueType>(1);
+
+        return Affine3
+        (
+            Vector3<TValueType>(one, zero, zero),
+            Vector3<TValueType>(zero, one, zero),
+            Vector3<TValueType>(zero, zero, one),
+            position
+        );
+    }
+
+
+    template <CFloatingType TValueType> constexpr
+    Affine3<TValueType> Affine3<TValueType>::ScaleMatrix(const Vector3<TValueType>& scale)
+    {
+        const TValueType    zero = static_cast<TValueType>(0);
+
+        return Affine3
+        (
+            Vector3<TValueType>(scale.GetX(), zero, zero),
+            Vector3<TValueType>(zero, scale.GetY(), zero),
+            Vector3<TValueType>(zero, zero, scale.GetZ()),
+            Vector3<TValueType>(zero)
+        );
+    }
+
+
+    template <CFloatingType TValueType> inline
+    TValueType* Affine3<TValueType>::Data(void)
+    {
+        static_assert(sizeof(Vector3<TValueType>) == 3 * sizeof(TValueType), "Vector3 must be tightly packed");
+
+        return reinterpret_cast<TValueType*>(m_columns);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    const TValueType* Affine3<TValueType>::Data(void) const
+    {
+        static_assert(sizeof(Vector3<TValueType>) == 3 * sizeof(TValueType), "Vector3 must be tightly packed");
+
+        return reinterpret_cast<const TValueType*>(m_columns);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                          std::span<Affine3<TValueType>> out)
+    {
+        if (rotations.size() != out.size())
+            throw std::logic_error("Output span size does not match input");
+
+        const Vector3<TValueType>   origin(static_cast<TValueType>(0));
+
+        for (std::size_t index = 0; index < out.size(); ++index)
+            out[index] = Affine3<TValueType>(rotations[index].RotationMatrix3(), origin);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                           std::type_identity_t<std::span<const Vector3<TValueType>>> translations,
+                           std::span<Affine3<TValueType>> out)
+    {
+        if (rotations.size() != out.size() || translations.size() != out.size())
+            throw std::logic_error("Input span sizes do not match output");
+
+        for (std::size_t index = 0; index < out.size(); ++index)
+            out[index] = Affine3<TValueType>(rotations[index].RotationMatrix3(), translations[index]);
+    }
+
+
+    inline void RotationMatrices(std::span<const Quaternion<float>> rotations, std::span<Affine3<float>> out)
+    {
+        RotationMatrices<float>(rotations, out);
+    }
+
+
+    inline void RotationMatrices(std::span<const Quaternion<double>> rotations, std::span<Affine3<double>> out)
+    {
+        RotationMatrices<double>(rotations, out);
+    }
+
+
+    inline void TransformMatrices(std::span<const Quaternion<float>> rotations,
+                                  std::span<const Vector3<float>> translations, std::span<Affine3<float>> out)
+    {
+        TransformMatrices<float>(rotations, translations, out);
+    }
+
+
+    inline void TransformMatrices(std::span<const Quaternion<double>> rotations,
+                                  std::span<const Vector3<double>> translations, std::span<Affine3<double>> out)
+    {
+        TransformMatrices<double>(rotations, translations, out);
+    }
+
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class Affine3<float>;
+    extern template class Affine3<double>;
+}
+
+#endif
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef __ALIGNED_H__
+#define __ALIGNED_H__
+
+#include <cstddef>
+
+#include "MathGeneric.hpp"
+
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "Matrix4.hpp"
+#include "Simd.hpp"
+
+namespace math
+{
+    // Over-aligned storage for the types SIMD kernels load in one go.
+    // Each one derives from the plain type, so every operation is
+    // available and results convert back implicitly
+
+    // Vector4 aligned on TAlignment bytes (a full register by default)
+    template <CScalarType TValueType, std::size_t TAlignment = 4 * sizeof(TValueType)>
+    class alignas(TAlignment) Vector4a : public Vector4<TValueType>
+    {
+        using TBaseType = Vector4<TValueType>;
+
+    public:
+
+        using TBaseType::TBaseType;
+
+        constexpr               Vector4a(void) = default;
+        constexpr               Vector4a(const TBaseType& other) : TBaseType(other) {}
+    };
+
+
+    // Matrix4 aligned on TAlignment bytes (one column per register by
+    // default, 64 to start on a cache line)
+    template <CScalarType TValueType, std::size_t TAlignment = 4 * sizeof(TValueType)>
+    class alignas(TAlignment) Matrix4a : public Matrix4<TValueType>
+    {
+        using TBaseType = Matrix4<TValueType>;
+
+    public:
+
+        using TBaseType::TBaseType;
+
+        constexpr               Matrix4a(void) = default;
+        constexpr               Matrix4a(const TBaseType& other) : TBaseType(other) {}
+    };
+
+
+    // Vector3 padded to the size of a Vector4 and aligned like one,
+    // so it can be loaded as a single register. The padding lane is
+    // always 0 so it does not pollute 4-lane dot products
+    template <CScalarType TValueType>
+    class alignas(4 * sizeof(TValueType)) Vector3p : public Vector3<TValueType>
+    {
+        using TBaseType = Vector3<TValueType>;
+
+    public:
+
+        using TBaseType::TBaseType;
+
+        constexpr               Vector3p(void) = default;
+        constexpr               Vector3p(const TBaseType& other) : TBaseType(other) {}
+
+    private:
+
+        TValueType              m_padding = static_cast<TValueType>(0);
+    };
+
+
+    using Vector4af = Vector4a<float>;
+    using Vector4ad = Vector4a<double>;
+
+    using Matrix4af = Matrix4a<float>;
+    using Matrix4ad = Matrix4a<double>;
+
+    using Vector3pf = Vector3p<float>;
+    using Vector3pd = Vector3p<double>;
+
+
+    static_assert(sizeof(Vector4af) == 16 && alignof(Vector4af) == 16, "Vector4af must fill one 128-bit register");
+    static_assert(sizeof(Vector3pf) == 16 && alignof(Vector3pf) == 16, "Vector3pf must fill one 128-bit register");
+    static_assert(sizeof(Matrix4af) == 64 && alignof(Matrix4af) == 16, "Matrix4af must be 4 aligned columns");
+    static_assert(sizeof(Vector3pd) == 32 && alignof(Vector3pd) == 32, "Vector3pd must fill one 256-bit register");
+
+
+#ifdef MTH_SIMD_SSE
+
+    namespace simd
+    {
+        // Aligned loads and stores, no split across cache lines
+
+        inline __m128   Load(const Vector4af& vector) noexcept
+        {
+            return _mm_load_ps(reinterpret_cast<const float*>(&vector));
+        }
+
+        inline __m128   Load(const Vector3pf& vector) noexcept
+        {
+            return _mm_load_ps(reinterpret_cast<const float*>(&vector));
+        }
+
+        inline void     Store(Vector4af& vector, __m128 value) noexcept
+        {
+            _mm_store_ps(reinterpret_cast<float*>(&vector), value);
+        }
+
+        // Keep the padding lane at 0
+        inline void     Store(Vector3pf& vector, __m128 value) noexcept
+        {
+            const __m128    mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+            _mm_store_ps(reinterpret_cast<float*>(&vector), _mm_and_ps(value, mask));
+        }
+
+        // Column of an aligned matrix
+        inline __m128   Load(const Matrix4af& matrix, int column) noexcept
+        {
+            return _mm_load_ps(matrix.Data() + column * 4);
+        }
+    }
+
+#endif
+
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef __ALIGNED_ALLOCATOR_H__
+#define __ALIGNED_ALLOCATOR_H__
+
+#include <cstddef>
+#include <new>
+
+namespace math
+{
+    // Standard allocator returning memory aligned on TAlignment bytes,
+    // so containers can be read with aligned SIMD loads
+    template <typename TValueType, std::size_t TAlignment>
+    class AlignedAllocator
+    {
+        static_assert((TAlignment & (TAlignment - 1)) == 0, "Alignment must be a power of two");
+        static_assert(TAlignment >= alignof(TValueType), "Alignment is weaker than the type's");
+
+    public:
+
+        using value_type = TValueType;
+
+        template <typename TOtherType>
+        struct rebind
+        {
+            using other = AlignedAllocator<TOtherType, TAlignment>;
+        };
+
+
+        AlignedAllocator(void) noexcept = default;
+
+        template <typename TOtherType>
+        AlignedAllocator(const AlignedAllocator<TOtherType, TAlignment>&) noexcept {}
+
+
+        TValueType*     allocate(std::size_t count)
+        {
+            return static_cast<TValueType*>
+            (
+                ::operator new(count * sizeof(TValueType), std::align_val_t(TAlignment))
+            );
+        }
+
+
+        void            deallocate(TValueType* pointer, std::size_t) noexcept
+        {
+            ::operator delete(pointer, std::align_val_t(TAlignment));
+        }
+
+
+        template <typename TOtherType>
+        bool            operator==(const AlignedAllocator<TOtherType, TAlignment>&) const noexcept
+        {
+            // Stateless, any instance can free another's memory
+            return true;
+        }
+
+        template <typename TOtherType>
+        bool            operator!=(const AlignedAllocator<TOtherType, TAlignment>&) const noexcept
+        {
+            return false;
+        }
+    };
+
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
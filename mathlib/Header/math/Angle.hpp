@@ -41,58 +41,58 @@ namespace math
     	Degree(void) = default;
 
     
-        Degree(TValueType val);
+        constexpr Degree(TValueType val);
 
-    	Degree(const Degree& other);
+    	constexpr Degree(const Degree& other);
     	~Degree(void) = default;
 
-    	operator Radian<TValueType>(void)			            const;
+    	constexpr operator Radian<TValueType>(void)			            const;
 
 
         // Accessors
-    	TValueType		Deg(bool wrap180 = false)				const;
-    	TValueType		Rad(bool wrapPi = true)				    const;
-    	TValueType		Raw()									const;
+    	constexpr TValueType		Deg(bool wrap180 = false)				const;
+    	constexpr TValueType		Rad(bool wrapPi = true)				    const;
+    	constexpr TValueType		Raw()									const;
 
         // Wrap around unit circle
-    	void			Wrap(bool wrap180 = false);
+    	constexpr void			Wrap(bool wrap180 = false);
 
         // Copy assignment
-    	Degree&			operator=(const Degree<TValueType>& rhs);
-    	Degree&			operator=(TValueType rhs);
+    	constexpr Degree&			operator=(const Degree<TValueType>& rhs);
+    	constexpr Degree&			operator=(TValueType rhs);
 
          // Arithmetic operators
-    	Degree			operator+(const Degree& rhs)				const;
-    	Degree			operator-(const Degree& rhs)				const;
-    	Degree			operator*(const Degree& rhs)				const;
-    	Degree			operator/(const Degree& rhs)				const;
+    	constexpr Degree			operator+(const Degree& rhs)				const;
+    	constexpr Degree			operator-(const Degree& rhs)				const;
+    	constexpr Degree			operator*(const Degree& rhs)				const;
+    	constexpr Degree			operator/(const Degree& rhs)				const;
 
-    	Degree			operator+(TValueType rhs)					const;
-    	Degree			operator-(TValueType rhs)					const;
-    	Degree			operator*(TValueType rhs)					const;
-    	Degree			operator/(TValueType rhs)					const;
+    	constexpr Degree			operator+(TValueType rhs)					const;
+    	constexpr Degree			operator-(TValueType rhs)					const;
+    	constexpr Degree			operator*(TValueType rhs)					const;
+    	constexpr Degree			operator/(TValueType rhs)					const;
 
         // Arithmetic assignment operators
-    	Degree&			operator+=(const Degree& rhs);
-    	Degree&			operator-=(const Degree& rhs);
-    	Degree&			operator*=(const Degree& rhs);
-    	Degree&			operator/=(const Degree& rhs);
+    	constexpr Degree&			operator+=(const Degree& rhs);
+    	constexpr Degree&			operator-=(const Degree& rhs);
+    	constexpr Degree&			operator*=(const Degree& rhs);
+    	constexpr Degree&			operator/=(const Degree& rhs);
 
 
-    	Degree&			operator+=(TValueType rhs);
-    	Degree&			operator-=(TValueType rhs);
-    	Degree&			operator*=(TValueType rhs);
-    	Degree&			operator/=(TValueType rhs);
+    	constexpr Degree&			operator+=(TValueType rhs);
+    	constexpr Degree&			operator-=(TValueType rhs);
+    	constexpr Degree&			operator*=(TValueType rhs);
+    	constexpr Degree&			operator/=(TValueType rhs);
 
         // Negation operators
-    	Degree			operator-(void)								const;
+    	constexpr Degree			operator-(void)								const;
 
         // Equality operators
-    	bool			operator==(const Degree& rhs)				const;
-    	bool			operator!=(const Degree& rhs)				const;
+    	constexpr bool			operator==(const Degree& rhs)				const;
+    	constexpr bool			operator!=(const Degree& rhs)				const;
 
-    	bool			operator==(TValueType rhs)					const;
-    	bool			operator!=(TValueType rhs)					const;
+    	constexpr bool			operator==(TValueType rhs)					const;
+    	constexpr bool			operator!=(TValueType rhs)					const;
 
 
     private:
@@ -113,60 +113,60 @@ namespace math
         Radian(void) = default;
 
         explicit
-        Radian(TValueType val);
-        Radian(const Radian& other);
+        constexpr Radian(TValueType val);
+        constexpr Radian(const Radian& other);
         ~Radian(void) = default;
 
         // Implicit cast operator
-        operator Degree<TValueType>(void)							const;
+        constexpr operator Degree<TValueType>(void)							const;
 
         // Accessors
-        TValueType		Rad(bool wrapPi = true)						const;
-        TValueType		Deg(bool wrap180 = false)					const;
-        TValueType		Raw()										const;
+        constexpr TValueType		Rad(bool wrapPi = true)						const;
+        constexpr TValueType		Deg(bool wrap180 = false)					const;
+        constexpr TValueType		Raw()										const;
 
         // Wrap around unit circle
-        void			Wrap(bool wrap180 = false);
+        constexpr void			Wrap(bool wrap180 = false);
 
 
         // Copy assignment
-        Radian&			operator=(const Radian& rhs);
-        Radian&			operator=(TValueType rhs);
+        constexpr Radian&			operator=(const Radian& rhs);
+        constexpr Radian&			operator=(TValueType rhs);
 
 
         // Arithmetic operators
-        Radian			operator+(const Radian& rhs)				const;
-        Radian			operator-(const Radian& rhs)				const;
-        Radian			operator*(const Radian& rhs)				const;
-        Radian			operator/(const Radian& rhs)				const;
+        constexpr Radian			operator+(const Radian& rhs)				const;
+        constexpr Radian			operator-(const Radian& rhs)				const;
+        constexpr Radian			operator*(const Radian& rhs)				const;
+        constexpr Radian			operator/(const Radian& rhs)				const;
 
         // Arithmetic assignment
-        Radian&			operator+=(const Radian& rhs);
-        Radian&			operator-=(const Radian& rhs);
-        Radian&			operator*=(const Radian& rhs);
-        Radian&			operator/=(const Radian& rhs);
+        constexpr Radian&			operator+=(const Radian& rhs);
+        constexpr Radian&			operator-=(const Radian& rhs);
+        constexpr Radian&			operator*=(const Radian& rhs);
+        constexpr Radian&			operator/=(const Radian& rhs);
 
         // Arithmetic with scalar
-        Radian			operator+(TValueType rhs)					const;
-        Radian			operator-(TValueType rhs)					const;
-        Radian			operator*(TValueType rhs)					const;
-        Radian			operator/(TValueType rhs)					const;
+        constexpr Radian			operator+(TValueType rhs)					const;
+        constexpr Radian			operator-(TValueType rhs)					const;
+        constexpr Radian			operator*(TValueType rhs)					const;
+        constexpr Radian			operator/(TValueType rhs)					const;
 
         // Arithmetic assignment with scalar
-        Radian&			operator+=(TValueType rhs);
-        Radian&			operator-=(TValueType rhs);
-        Radian&			operator*=(TValueType rhs);
-        Radian&			operator/=(TValueType rhs);
+        constexpr Radian&			operator+=(TValueType rhs);
+        constexpr Radian&			operator-=(TValueType rhs);
+        constexpr Radian&			operator*=(TValueType rhs);
+        constexpr Radian&			operator/=(TValueType rhs);
 
         // Negate value
-        Radian			operator-(void)								const;
+        constexpr Radian			operator-(void)								const;
 
         // Equality operators
-        bool			operator==(const Radian& rhs)				const;
-        bool			operator!=(const Radian& rhs)				const;
+        constexpr bool			operator==(const Radian& rhs)				const;
+        constexpr bool			operator!=(const Radian& rhs)				const;
 
-        bool			operator==(TValueType rhs)					const;
-        bool			operator!=(TValueType rhs)					const;
+        constexpr bool			operator==(TValueType rhs)					const;
+        constexpr bool			operator!=(TValueType rhs)					const;
 
 
     private:
@@ -178,11 +178,11 @@ namespace math
     // Angle literals
     inline namespace Literal
     {
-        inline Degree<float>			operator""_deg(long double val);
-        inline Degree<float>			operator""_deg(unsigned long long int val);
+        constexpr Degree<float>			operator""_deg(long double val);
+        constexpr Degree<float>			operator""_deg(unsigned long long int val);
 
-        inline Radian<float>			operator""_rad(long double val);
-        inline Radian<float>			operator""_rad(unsigned long long int val);
+        constexpr Radian<float>			operator""_rad(long double val);
+        constexpr Radian<float>			operator""_rad(unsigned long long int val);
 
     }
 
@@ -205,26 +205,26 @@ namespace math
 
 // ---- Degree implementation
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>::Degree(TValueType val)
         : m_value(val) {}
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>::Degree(const Degree<TValueType>& other)
         : m_value(other.m_value) {}
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>::operator Radian<TValueType>() const
     {
         // Convert deg value to rad
         return Radian<TValueType>(Rad(false));
     }
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     TValueType Degree<TValueType>::Deg(bool wrap180) const
     {
         // Wrap value depending on argument
@@ -245,7 +245,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     TValueType Degree<TValueType>::Rad(bool wrapPi) const
     {
         // Wrap value depending on argument
@@ -267,7 +267,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     TValueType Degree<TValueType>::Raw(void) const
     {
         return m_value;
@@ -275,7 +275,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     void Degree<TValueType>::Wrap(bool wrap180)
     {
         // Assign wrapped value to raw value
@@ -284,7 +284,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator=(const Degree& rhs)
     {
         // Copy assignment
@@ -296,7 +296,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator=(TValueType rhs)
     {
         // Copy assignment
@@ -308,7 +308,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator+(const Degree& rhs) const
     {
         // Addition
@@ -318,7 +318,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator-(const Degree<TValueType>& rhs) const
     {
         // Subtraction
@@ -328,7 +328,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator*(const Degree<TValueType>& rhs) const
     {
         // Multiplication
@@ -338,7 +338,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator/(const Degree<TValueType>& rhs) const
     {
         // Division
@@ -349,7 +349,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator+(TValueType rhs) const
     {
         // Addition
@@ -359,7 +359,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator-(TValueType rhs) const
     {
         // Subtraction
@@ -369,7 +369,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator*(TValueType rhs) const
     {
         // Multiplication
@@ -378,7 +378,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator/(TValueType rhs) const
     {
         // Division
@@ -387,7 +387,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator+=(const Degree& rhs)
     {
         // Addition assignment
@@ -399,7 +399,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator-=(const Degree& rhs)
     {
         // Subtraction assignment
@@ -411,7 +411,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator*=(const Degree& rhs)
     {
         // Multiplication assignment
@@ -423,7 +423,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator/=(const Degree& rhs)
     {
         // Division assignment
@@ -436,7 +436,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator+=(TValueType rhs)
     {
         // Addition assignment
@@ -448,7 +448,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator-=(TValueType rhs)
     {
         // Subtraction assignment
@@ -460,7 +460,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator*=(TValueType rhs)
     {
         // Multiplication assignment
@@ -472,7 +472,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType>& Degree<TValueType>::operator/=(TValueType rhs)
     {
         // Division assignment
@@ -484,7 +484,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     Degree<TValueType> Degree<TValueType>::operator-(void) const
     {
         // Flip sign
@@ -493,7 +493,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     bool Degree<TValueType>::operator==(const Degree<TValueType>& rhs) const
     {
         return AlmostEqual
@@ -506,7 +506,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     bool Degree<TValueType>::operator!=(const Degree& rhs) const
     {
         // Not equal
@@ -515,7 +515,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     bool Degree<TValueType>::operator==(TValueType rhs) const
     {
         return AlmostEqual<TValueType>
@@ -528,7 +528,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType>
+    template <CScalarType TValueType> constexpr
     bool Degree<TValueType>::operator!=(TValueType rhs) const
     {
         // Not equal
@@ -548,19 +548,19 @@ namespace math
 
 // ---- Radian implementation ----
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>::Radian(TValueType val)
         : m_value(val) {}
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>::Radian(const Radian<TValueType>& other)
         : m_value(other.m_value) {}
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>::operator Degree<TValueType>(void) const
     {
         // Converti value to radians and construct object
@@ -568,7 +568,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Radian<TValueType>::Radian::Deg(bool wrap180) const
     {
         // Wrap value depending on argument
@@ -589,7 +589,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Radian<TValueType>::Rad(bool wrapPi) const
     {
         // Use custom wrap as math wrap is not precise enough
@@ -629,13 +629,13 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Radian<TValueType>::Raw() const
     {
         return m_value;
     }
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     void Radian<TValueType>::Wrap(bool wrap180)
     {
         // Set raw value to wrapped value
@@ -643,7 +643,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator=(const Radian<TValueType>& rhs)
     {
         // Copy assignment
@@ -654,7 +654,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator=(TValueType rhs)
     {
         // Copy assignment
@@ -665,7 +665,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator+(const Radian<TValueType>& rhs) const
     {
         // Addition
@@ -674,7 +674,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator-(const Radian<TValueType>& rhs) const
     {
         // Subtraction
@@ -682,7 +682,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator*(const Radian<TValueType>& rhs) const
     {
         // Multiplication
@@ -690,7 +690,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator/(const Radian<TValueType>& rhs) const
     {
         // Division
@@ -698,7 +698,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator+=(const Radian<TValueType>& rhs)
     {
         // Addition assignment
@@ -708,7 +708,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator-=(const Radian<TValueType>& rhs)
     {
         // Subtraction assignment
@@ -718,7 +718,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator*=(const Radian<TValueType>& rhs)
     {
         // Multiplication assignment
@@ -728,7 +728,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator/=(const Radian<TValueType>& rhs)
     {
         // Division assignment
@@ -739,7 +739,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator+(TValueType rhs) const
     {
         // Addition
@@ -747,7 +747,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator-(TValueType rhs) const
     {
         // Subtraction
@@ -755,7 +755,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator*(TValueType rhs) const
     {
         // Multiplication
@@ -764,7 +764,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator/(TValueType rhs) const
     {
         // Division
@@ -772,7 +772,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator+=(TValueType rhs)
     {
         // Addition assignment
@@ -783,7 +783,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator-=(TValueType rhs)
     {
         // Subtraction assignment
@@ -794,7 +794,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator*=(TValueType rhs)
     {
         // Multiplication assignment
@@ -804,7 +804,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType>& Radian<TValueType>::operator/=(TValueType rhs)
     {
         // Division assignment
@@ -814,7 +814,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Radian<TValueType> Radian<TValueType>::operator-(void) const
     {
         // Flip sign
@@ -822,7 +822,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool Radian<TValueType>::operator==(const Radian<TValueType>& rhs) const
     {
         return AlmostEqual
@@ -834,7 +834,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool Radian<TValueType>::operator!=(const Radian<TValueType>& rhs) const
     {
         // Not equal
@@ -843,7 +843,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool Radian<TValueType>::operator==(TValueType rhs) const
     {
         return AlmostEqual
@@ -862,7 +862,7 @@ namespace math
 
 // ---- Literal operators implementation ----
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool Radian<TValueType>::operator!=(TValueType rhs) const
     {
         // Not equal
@@ -871,27 +871,27 @@ namespace math
 
 
 
-    inline Radian<float> math::Literal::operator""_rad(long double val)
+    constexpr Radian<float> math::Literal::operator""_rad(long double val)
     {
         // Get numeric value from literal
         return Radian(static_cast<float>(val));
     }
 
 
-    inline Radian<float> math::Literal::operator""_rad(unsigned long long int val)
+    constexpr Radian<float> math::Literal::operator""_rad(unsigned long long int val)
     {
         // Get numeric value from literal
         return Radian(static_cast<float>(val));
     }
 
 
-    inline Degree<float> math::Literal::operator""_deg(long double val)
+    constexpr Degree<float> math::Literal::operator""_deg(long double val)
     {
         // Get numeric value from literal
         return Degree(static_cast<float>(val));
     }
 
-    inline Degree<float> Literal::operator""_deg(unsigned long long int val)
+    constexpr Degree<float> Literal::operator""_deg(unsigned long long int val)
     {
         // Get numeric value from literal
         return Degree(static_cast<float>(val));
@@ -2,7 +2,9 @@
 #define __ARITHMETIC_H__
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 #include "MathGeneric.hpp"
 
@@ -10,12 +12,12 @@ namespace math
 {
 
     // Absolute value
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Absolute(TValueType val)                          noexcept;
 
 
     // Epsilon test
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool             AlmostEqual
     (
         TValueType a, TValueType b,
@@ -24,30 +26,30 @@ namespace math
 
 
     // Round to the nearest integral value
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Round(TValueType val)                             noexcept;
 
 
     // Round to the nearest integral value (greater or equal)
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Ceil(TValueType val)                              noexcept;
 
 
 
     // Round to the nearest integral value (smaller or equal)
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Floor(TValueType val)                             noexcept;
 
 
     // Wrap value around a set of limits
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Wrap
     (
         TValueType val, TValueType low, TValueType high
     )                                                                   noexcept;
 
     // Get value within a range without wrapping
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Clamp
     (
         TValueType val, TValueType low, TValueType high
@@ -55,30 +57,30 @@ namespace math
 
 
     // Raise number to an integral power
-    template <CScalarType TValueType, CUnsignedType TPowerType> inline
+    template <CScalarType TValueType, CUnsignedType TPowerType> constexpr
     TValueType       Pow(TValueType val, TPowerType power)            noexcept;
 
 
     //TODO: Re-implement our own function
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       SquareRoot(TValueType val)                        noexcept;
 
     // Get smallest value
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Min(TValueType a, TValueType b)                  noexcept;
 
     // Get largest value
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType       Max(TValueType a, TValueType b)                  noexcept;
 
 
 
     // Get factorial of an unsigned integral value
-    template <CIntegralType TValueType> inline
+    template <CIntegralType TValueType> constexpr
     TValueType      Factorial(TValueType val)                          noexcept;
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType      Modulus(TValueType toDivide, TValueType divisor)  noexcept;
 
 
@@ -89,7 +91,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Absolute(TValueType val) noexcept
     {
         // Unsigned types cannot be negative
@@ -102,7 +104,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool  AlmostEqual(TValueType a, TValueType b, TValueType epsilon) noexcept
     {
         // Cannot use negative differences with unsigned types,
@@ -117,7 +119,7 @@ namespace math
             return Absolute(a - b) <= epsilon;
     }
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Modulus(TValueType toDivide, TValueType divisor) noexcept
     {
         // Integral modulo, floating point types
@@ -128,21 +130,33 @@ namespace math
 
 // ---- Modulus specializations ----
 
-    template<> inline
+    template<> constexpr
     double Modulus<double>(double toDivide, double divisor) noexcept
     {
+        // fmod is not constexpr, truncate the quotient at compile time
+        if (std::is_constant_evaluated())
+            return toDivide - static_cast<double>(static_cast<int64_t>(toDivide / divisor)) * divisor;
+
         return fmod(toDivide, divisor);
     }
 
-    template <> inline
+    template <> constexpr
     float Modulus<float>(float toDivide, float divisor) noexcept
     {
+        // fmodf is not constexpr, truncate the quotient at compile time
+        if (std::is_constant_evaluated())
+            return toDivide - static_cast<float>(static_cast<int64_t>(toDivide / divisor)) * divisor;
+
         return fmodf(toDivide, divisor);
     }
 
-    template<> inline
+    template<> constexpr
     long double Modulus<long double>(long double toDivide, long double divisor) noexcept
     {
+        // fmodl is not constexpr, truncate the quotient at compile time
+        if (std::is_constant_evaluated())
+            return toDivide - static_cast<long double>(static_cast<int64_t>(toDivide / divisor)) * divisor;
+
         return fmodl(toDivide, divisor);
     }
 
@@ -150,7 +164,7 @@ namespace math
 // !Modulus specializations
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Floor(TValueType val) noexcept
     {
         // Integral types do not need to be manipulated.
@@ -163,7 +177,7 @@ namespace math
 
     // Strip down decimal part and match size if possible
 
-    template <> inline
+    template <> constexpr
     float Floor(float val) noexcept
     {
         return static_cast<float>
@@ -173,7 +187,7 @@ namespace math
     }
 
 
-    template <> inline
+    template <> constexpr
     double Floor(double val) noexcept
     {
         return static_cast<double>
@@ -183,7 +197,7 @@ namespace math
     }
 
 
-    template <> inline
+    template <> constexpr
     long double Floor(long double val) noexcept
     {
         return static_cast<long double>
@@ -197,7 +211,7 @@ namespace math
 // !Floor specializations
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Round(TValueType val) noexcept
     {
         return val;
@@ -206,7 +220,7 @@ namespace math
 
 // ---- Round specializations ----
 
-    template <> inline
+    template <> constexpr
     float Round(float val) noexcept
     {
 
@@ -223,7 +237,7 @@ namespace math
     }
 
 
-    template <> inline
+    template <> constexpr
     double Round(double val) noexcept
     {
 
@@ -239,7 +253,7 @@ namespace math
 
     }
 
-    template <> inline
+    template <> constexpr
     long double Round(long double val) noexcept
     {
 
@@ -258,7 +272,7 @@ namespace math
 
 // !Round specializations
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Ceil(TValueType val) noexcept
     {
         // No need to round integral values.
@@ -268,7 +282,7 @@ namespace math
 
 // ---- Ceil specializations ----
 
-    template <> inline
+    template <> constexpr
     float Ceil(float val) noexcept
     {
         float      floored = Floor<float>(val);
@@ -283,7 +297,7 @@ namespace math
     }
 
 
-    template <> inline
+    template <> constexpr
     double Ceil(double val) noexcept
     {
         double      floored = Floor<double>(val);
@@ -298,7 +312,7 @@ namespace math
     }
 
 
-    template <> inline
+    template <> constexpr
     long double Ceil(long double val) noexcept
     {
         long double      floored = Floor<long double>(val);
@@ -317,7 +331,7 @@ namespace math
 
 
    // Get value within a range without wrapping
-   template <CScalarType TValueType> inline
+   template <CScalarType TValueType> constexpr
    TValueType Clamp(TValueType val, TValueType low, TValueType high) noexcept
    {
        // Return highest of low values
@@ -333,7 +347,7 @@ namespace math
 
 
 
-   template <CScalarType TValueType> inline
+   template <CScalarType TValueType> constexpr
    TValueType Wrap(TValueType val, TValueType low, TValueType high) noexcept
    {
        if (-val > high)
@@ -350,7 +364,7 @@ namespace math
 
 
 
-   template <CScalarType TValueType, CUnsignedType TPowerType> inline
+   template <CScalarType TValueType, CUnsignedType TPowerType> constexpr
    TValueType Pow(TValueType val, TPowerType power) noexcept
    {
        if (static_cast<TPowerType>(0) == power)
@@ -371,9 +385,45 @@ namespace math
 
 
 
-   template <CScalarType TValueType> inline
+   // Newton-Raphson square root for constant evaluation,
+   // starts above the root so the sequence decreases until it converges
+   template <CScalarType TValueType> constexpr
+   TValueType InternalSquareRoot(TValueType val) noexcept
+   {
+       const long double    value = static_cast<long double>(val);
+
+       if (value < 0.l)
+       {
+           if constexpr (std::is_floating_point_v<TValueType>)
+               return std::numeric_limits<TValueType>::quiet_NaN();
+
+           else
+               return static_cast<TValueType>(0);
+       }
+
+       if (value == 0.l || value == std::numeric_limits<long double>::infinity())
+           return val;
+
+       long double          guess = (value > 1.l) ? value : 1.l;
+
+       while (true)
+       {
+           const long double    next = 0.5l * (guess + value / guess);
+
+           if (next >= guess)
+               return static_cast<TValueType>(guess);
+
+           guess = next;
+       }
+   }
+
+
+   template <CScalarType TValueType> constexpr
    TValueType SquareRoot(TValueType val) noexcept
    {
+       if (std::is_constant_evaluated())
+           return InternalSquareRoot(val);
+
        return static_cast<TValueType>
        (
            sqrt(static_cast<double>(val))
@@ -384,16 +434,22 @@ namespace math
 
    // ---- SquareRoot specializations ----
 
-   template<> inline
+   template<> constexpr
    float SquareRoot<float>(float val) noexcept
    {
+       if (std::is_constant_evaluated())
+           return InternalSquareRoot(val);
+
        return sqrtf(val);
    }
 
 
-   template<> inline
+   template<> constexpr
    long double SquareRoot<long double>(long double val) noexcept
    {
+       if (std::is_constant_evaluated())
+           return InternalSquareRoot(val);
+
        return sqrtl(val);
    }
 
@@ -403,7 +459,7 @@ namespace math
 
 
 
-   template <CScalarType TValueType> inline
+   template <CScalarType TValueType> constexpr
    TValueType Min(TValueType a, TValueType b) noexcept
    {
        // Return smallest
@@ -411,7 +467,7 @@ namespace math
    }
 
 
-   template <CScalarType TValueType> inline
+   template <CScalarType TValueType> constexpr
    TValueType Max(TValueType a, TValueType b) noexcept
    {
        // Return largest
@@ -419,7 +475,7 @@ namespace math
    }
 
 
-   template <CIntegralType TValueType> inline
+   template <CIntegralType TValueType> constexpr
    TValueType Factorial(TValueType val) noexcept
    {
        TValueType       zero = static_cast<TValueType>(0),
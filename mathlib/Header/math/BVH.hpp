@@ -0,0 +1,1240 @@
+#ifndef __BVH_H__
+#define __BVH_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "MathGeneric.hpp"
+#include "Arithmetic.hpp"
+
+#include "Vector3.hpp"
+#include "AABB.hpp"
+#include "Intersection.hpp"
+
+namespace math
+{
+    // Bounding volume hierarchy over any primitives given by their bounds.
+    // Built top-down with the surface area heuristic (SAH) evaluated on
+    // binned centroids, and stored as one array of nodes in depth-first
+    // order: an inner node's first child always comes right after it.
+    // Queries take a function called on the primitives of each leaf they
+    // reach, with the primitive's position in Primitives() (leaf order),
+    // so per-primitive data can be laid out in that order as well
+    template <CFloatingType TValueType>
+    class BVH
+    {
+    public:
+
+        // 32 bytes in float: two nodes per cache line
+        struct Node
+        {
+            TValueType      m_min[3];
+
+            // Leaf: first primitive. Inner node: second child
+            uint32_t        m_offset;
+
+            TValueType      m_max[3];
+
+            // Primitive count, zero for inner nodes
+            uint32_t        m_count;
+
+            bool            IsLeaf(void)                                const { return m_count != 0; }
+        };
+
+        static constexpr uint32_t       DefaultLeafSize = 4;
+
+        // Split planes tested per axis + 1
+        static constexpr uint32_t       BinCount = 16;
+
+        // Deeper nodes are turned into leaves, so queries need a fixed stack
+        static constexpr uint32_t       MaxDepth = 64;
+
+        BVH(void) = default;
+        BVH(const BVH&) = default;
+        BVH(BVH&&) noexcept = default;
+
+        ~BVH(void) = default;
+
+        // Build the tree over primitives with given bounds. Leaves hold up to
+        // maxLeafSize primitives unless their centroids cannot be separated,
+        // and fewer if splitting them is not worth it
+        void                            Build(std::span<const AABB3<TValueType>> bounds,
+                                              uint32_t maxLeafSize = DefaultLeafSize);
+
+        // Recompute node bounds after primitives moved, keeping the same tree.
+        // Bounds are in the same order as in Build. Faster than a rebuild,
+        // but queries slow down as primitives move far from their neighbors
+        void                            Refit(std::span<const AABB3<TValueType>> bounds);
+
+        void                            Clear(void);
+
+        // Call function(primitive) for each primitive of the leaves overlapping
+        // box. Primitives themselves are not tested, function should
+        template <typename TFunction>
+        void                            Overlaps(const AABB3<TValueType>& box, TFunction&& function) const;
+
+        // Find the closest hit along origin + t * direction for t in [0, distance).
+        // intersect(primitive, distance) must return true and lower distance
+        // on a closer hit. Children are visited near to far and skipped
+        // once they are further than the closest hit
+        template <typename TFunction>
+        bool                            Raycast(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                                TValueType& distance, TFunction&& intersect) const;
+
+        // Same as Raycast, but stop at the first hit (e.g. line of sight)
+        template <typename TFunction>
+        bool                            AnyHit(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                               TValueType distance, TFunction&& intersect) const;
+
+        // Find the primitive closest to point within sqrt(distanceSquared).
+        // measure(primitive, distanceSquared) must return true and lower
+        // distanceSquared if the primitive is closer
+        template <typename TFunction>
+        bool                            Nearest(const Vector3<TValueType>& point, TValueType& distanceSquared,
+                                                TFunction&& measure) const;
+
+        // Bounds of all primitives (empty box if there are none)
+        AABB3<TValueType>               GetBounds(void)                                 const;
+
+        std::span<const Node>           Nodes(void)                                     const;
+
+        // Indices given to Build, in leaf order
+        std::span<const uint32_t>       Primitives(void)                                const;
+
+        bool                            Empty(void)                                     const;
+
+        BVH&                            operator=(const BVH&) = default;
+        BVH&                            operator=(BVH&&) noexcept = default;
+
+    private:
+
+        // Box as plain arrays for the build's inner loops, which would
+        // otherwise go through Vector3's range checked indexing
+        struct Bounds
+        {
+            TValueType                  m_min[3] = { std::numeric_limits<TValueType>::max(),
+                                                     std::numeric_limits<TValueType>::max(),
+                                                     std::numeric_limits<TValueType>::max() };
+            TValueType                  m_max[3] = { std::numeric_limits<TValueType>::lowest(),
+                                                     std::numeric_limits<TValueType>::lowest(),
+                                                     std::numeric_limits<TValueType>::lowest() };
+
+            void                        Merge(const Bounds& other);
+            void                        Merge(const TValueType (&point)[3]);
+
+            // 0 if empty
+            TValueType                  SurfaceArea(void)                               const;
+        };
+
+        // Primitive data moved around during the build, so each pass
+        // over a node reads contiguous memory
+        struct BuildPrimitive
+        {
+            Bounds                      m_bounds;
+            TValueType                  m_centroid[3];
+            uint32_t                    m_index;
+        };
+
+        struct Bin
+        {
+            Bounds                      m_bounds;
+            uint32_t                    m_count = 0;
+        };
+
+        // Partition a node's primitives and get the size of the first
+        // child, or the primitive count for a leaf
+        static uint32_t                 Split(std::span<BuildPrimitive> primitives, uint32_t depth,
+                                              uint32_t maxLeafSize, const Bounds& nodeBounds,
+                                              const Bounds& centroidBounds);
+
+        template <bool TAnyHit, typename TFunction>
+        bool                            Traverse(const Vector3<TValueType>& origin,
+                                                 const Vector3<TValueType>& direction,
+                                                 TValueType& distance, TFunction& intersect) const;
+
+        // Distance to where the ray enters a node, infinity if it misses
+        static TValueType               EntryDistance(const Node& node, const TValueType (&origin)[3],
+                                                      const TValueType (&inverseDirection)[3], TValueType distance);
+
+        static TValueType               NodeDistanceSquared(const Node& node, const TValueType (&point)[3]);
+
+        static bool                     NodeOverlaps(const Node& node, const AABB3<TValueType>& box);
+
+        static AABB3<TValueType>        NodeBounds(const Node& node);
+        static Bounds                   MakeBounds(const Node& node);
+        static Bounds                   MakeBounds(const AABB3<TValueType>& box);
+        static void                     SetNodeBounds(Node& node, const Bounds& bounds);
+
+        std::vector<Node>               m_nodes;
+        std::vector<uint32_t>           m_primitives;
+    };
+
+
+    // Triangle mesh with a BVH, answering closest hit, any hit, box overlap
+    // and closest point queries. Triangles are copied in the tree's leaf
+    // order so each leaf reads contiguous memory, results use the indices
+    // of the triangles as given to Build
+    template <CFloatingType TValueType>
+    class TriangleBVH
+    {
+    public:
+
+        struct RayHit
+        {
+            uint32_t                    m_triangle;
+            TValueType                  m_distance;
+
+            // Barycentric coordinates of the hit point: weights of the
+            // second and third vertices
+            TValueType                  m_u;
+            TValueType                  m_v;
+        };
+
+        struct PointHit
+        {
+            uint32_t                    m_triangle;
+            TValueType                  m_distanceSquared;
+            Vector3<TValueType>         m_point;
+        };
+
+        TriangleBVH(void) = default;
+        TriangleBVH(const TriangleBVH&) = default;
+        TriangleBVH(TriangleBVH&&) noexcept = default;
+
+        ~TriangleBVH(void) = default;
+
+        // Build from an indexed mesh, three indices per triangle
+        void                            Build(std::span<const Vector3<TValueType>> vertices,
+                                              std::span<const uint32_t> indices,
+                                              uint32_t maxLeafSize = BVH<TValueType>::DefaultLeafSize);
+
+        // Build from a triangle soup, three vertices per triangle
+        void                            Build(std::span<const Vector3<TValueType>> triangles,
+                                              uint32_t maxLeafSize = BVH<TValueType>::DefaultLeafSize);
+
+        // Update vertex positions and refit the tree. Same layout as Build
+        void                            Refit(std::span<const Vector3<TValueType>> vertices,
+                                              std::span<const uint32_t> indices);
+        void                            Refit(std::span<const Vector3<TValueType>> triangles);
+
+        void                            Clear(void);
+
+        // Closest triangle hit by origin + t * direction for t in [0, maxDistance).
+        // The direction does not have to be normalized, distances are
+        // expressed in multiples of it
+        bool                            Raycast(const Vector3<TValueType>& origin,
+                                                const Vector3<TValueType>& direction,
+                                                TValueType maxDistance, RayHit& hit)                const;
+
+        // Does any triangle block origin + t * direction for t in [0, maxDistance) ?
+        bool                            AnyHit(const Vector3<TValueType>& origin,
+                                               const Vector3<TValueType>& direction,
+                                               TValueType maxDistance)                              const;
+
+        // Append indices of triangles overlapping box (touching counts),
+        // and get how many were appended
+        std::size_t                     Overlaps(const AABB3<TValueType>& box,
+                                                 std::vector<uint32_t>& triangles)                  const;
+
+        // Closest point on the mesh within maxDistance of point
+        bool                            ClosestPoint(const Vector3<TValueType>& point, PointHit& hit,
+                                                     TValueType maxDistance =
+                                                     std::numeric_limits<TValueType>::infinity())   const;
+
+        std::size_t                     TriangleCount(void)                                         const;
+
+        const BVH<TValueType>&          GetBVH(void)                                                const;
+
+        TriangleBVH&                    operator=(const TriangleBVH&) = default;
+        TriangleBVH&                    operator=(TriangleBVH&&) noexcept = default;
+
+    private:
+
+        // Copy triangles in input order, three vertices each
+        static std::vector<Vector3<TValueType>>     Gather(std::span<const Vector3<TValueType>> vertices,
+                                                           std::span<const uint32_t> indices);
+
+        static std::vector<AABB3<TValueType>>       TriangleBounds(std::span<const Vector3<TValueType>> triangles);
+
+        // Copy triangles in leaf order
+        void                            Reorder(std::span<const Vector3<TValueType>> triangles);
+
+        BVH<TValueType>                 m_bvh;
+
+        // Three vertices per triangle, in leaf order
+        std::vector<Vector3<TValueType>>    m_vertices;
+    };
+
+
+    using BVHf = BVH<float>;
+    using BVHd = BVH<double>;
+
+    using TriangleBVHf = TriangleBVH<float>;
+    using TriangleBVHd = TriangleBVH<double>;
+
+
+    namespace detail
+    {
+        // Separating axis test between triangle abc and a box: box faces,
+        // triangle plane and the 9 cross products of their edges
+        // (Akenine-Moller, Ericson 5.2.9). Touching counts as overlapping
+        template <CFloatingType TValueType> inline
+        bool    OverlapTriangleBox(const Vector3<TValueType>& a, const Vector3<TValueType>& b,
+                                   const Vector3<TValueType>& c, const AABB3<TValueType>& box)
+        {
+            const Vector3<TValueType>   center = box.GetCenter();
+            const Vector3<TValueType>   extents = box.GetExtents();
+
+            // Move the box to the origin
+            const Vector3<TValueType>   vertices[3] = { a - center, b - center, c - center };
+            const Vector3<TValueType>   edges[3] =
+            {
+                vertices[1] - vertices[0], vertices[2] - vertices[1], vertices[0] - vertices[2]
+            };
+
+            const auto                  separates = [&](const Vector3<TValueType>& axis)
+            {
+                const TValueType    p0 = vertices[0].Dot(axis);
+                const TValueType    p1 = vertices[1].Dot(axis);
+                const TValueType    p2 = vertices[2].Dot(axis);
+                const TValueType    radius = extents.GetX() * Absolute(axis.GetX()) +
+                                             extents.GetY() * Absolute(axis.GetY()) +
+                                             extents.GetZ() * Absolute(axis.GetZ());
+
+                return math::Max(-math::Max(math::Max(p0, p1), p2), math::Min(math::Min(p0, p1), p2)) > radius;
+            };
+
+            const Vector3<TValueType>   boxAxes[3] =
+            {
+                Vector3<TValueType>(static_cast<TValueType>(1), static_cast<TValueType>(0), static_cast<TValueType>(0)),
+                Vector3<TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(1), static_cast<TValueType>(0)),
+                Vector3<TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(0), static_cast<TValueType>(1))
+            };
+
+            // Box faces first, cheapest and most likely to separate
+            for (const Vector3<TValueType>& axis : boxAxes)
+            {
+                if (separates(axis))
+                    return false;
+            }
+
+            if (separates(edges[0].Cross(edges[1])))
+                return false;
+
+            for (const Vector3<TValueType>& axis : boxAxes)
+            {
+                for (const Vector3<TValueType>& edge : edges)
+                {
+                    if (separates(axis.Cross(edge)))
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+
+        // Closest point to p on triangle abc, by Voronoi region
+        // (Ericson, Real-Time Collision Detection 5.1.5)
+        template <CFloatingType TValueType> inline
+        Vector3<TValueType>     ClosestPointOnTriangle(const Vector3<TValueType>& p, const Vector3<TValueType>& a,
+                                                       const Vector3<TValueType>& b, const Vector3<TValueType>& c)
+        {
+            const TValueType            zero = static_cast<TValueType>(0);
+
+            const Vector3<TValueType>   ab = b - a;
+            const Vector3<TValueType>   ac = c - a;
+            const Vector3<TValueType>   ap = p - a;
+
+            const TValueType            d1 = ab.Dot(ap);
+            const TValueType            d2 = ac.Dot(ap);
+
+            if (d1 <= zero && d2 <= zero)
+                return a;
+
+            const Vector3<TValueType>   bp = p - b;
+            const TValueType            d3 = ab.Dot(bp);
+            const TValueType            d4 = ac.Dot(bp);
+
+            if (d3 >= zero && d4 <= d3)
+                return b;
+
+            const TValueType            vc = d1 * d4 - d3 * d2;
+
+            if (vc <= zero && d1 >= zero && d3 <= zero)
+                return a + ab * (d1 / (d1 - d3));
+
+            const Vector3<TValueType>   cp = p - c;
+            const TValueType            d5 = ab.Dot(cp);
+            const TValueType            d6 = ac.Dot(cp);
+
+            if (d6 >= zero && d5 <= d6)
+                return c;
+
+            const TValueType            vb = d5 * d2 - d1 * d6;
+
+            if (vb <= zero && d2 >= zero && d6 <= zero)
+                return a + ac * (d2 / (d2 - d6));
+
+            const TValueType            va = d3 * d6 - d5 * d4;
+
+            if (va <= zero && (d4 - d3) >= zero && (d5 - d6) >= zero)
+                return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+            // Inside the face
+            const TValueType            invSum = static_cast<TValueType>(1) / (va + vb + vc);
+
+            return a + ab * (vb * invSum) + ac * (vc * invSum);
+        }
+    }
+
+
+    // ---- BVH ----
+
+    template <CFloatingType TValueType> inline
+    void BVH<TValueType>::Build(std::span<const AABB3<TValueType>> bounds, uint32_t maxLeafSize)
+    {
+        if (maxLeafSize == 0)
+            throw std::logic_error("BVH leaf size cannot be zero");
+
+        if (bounds.size() >= UINT32_MAX)
+            throw std::logic_error("Too many primitives in BVH");
+
+        Clear();
+
+        const uint32_t              count = static_cast<uint32_t>(bounds.size());
+
+        if (count == 0)
+            return;
+
+        std::vector<BuildPrimitive>     primitives(count);
+
+        for (uint32_t primitive = 0; primitive < count; ++primitive)
+        {
+            const Vector3<TValueType>   center = bounds[primitive].GetCenter();
+
+            primitives[primitive] = { MakeBounds(bounds[primitive]), { center.GetX(), center.GetY(), center.GetZ() },
+                                      primitive };
+        }
+
+        // A binary tree with one primitive per leaf at most
+        m_nodes.reserve(2 * static_cast<std::size_t>(count) - 1);
+
+        struct Task
+        {
+            // Node to link to this one if it is a second child
+            uint32_t        m_parent;
+            uint32_t        m_begin;
+            uint32_t        m_end;
+            uint32_t        m_depth;
+        };
+
+        // Second children are pushed first so the first child's whole
+        // subtree is written before them (depth-first order)
+        std::vector<Task>           tasks;
+
+        tasks.push_back({ UINT32_MAX, 0, count, 0 });
+
+        while (!tasks.empty())
+        {
+            const Task          task = tasks.back();
+            const uint32_t      index = static_cast<uint32_t>(m_nodes.size());
+
+            tasks.pop_back();
+            m_nodes.emplace_back();
+
+            if (task.m_parent != UINT32_MAX)
+                m_nodes[task.m_parent].m_offset = index;
+
+            Bounds              nodeBounds;
+            Bounds              centroidBounds;
+
+            const std::span<BuildPrimitive>     range(primitives.data() + task.m_begin, task.m_end - task.m_begin);
+
+            for (const BuildPrimitive& primitive : range)
+            {
+                nodeBounds.Merge(primitive.m_bounds);
+                centroidBounds.Merge(primitive.m_centroid);
+            }
+
+            SetNodeBounds(m_nodes[index], nodeBounds);
+
+            const uint32_t      split = task.m_begin + Split(range, task.m_depth, maxLeafSize, nodeBounds,
+                                                             centroidBounds);
+
+            if (split == task.m_end)
+            {
+                m_nodes[index].m_offset = task.m_begin;
+                m_nodes[index].m_count = task.m_end - task.m_begin;
+                continue;
+            }
+
+            tasks.push_back({ index, split, task.m_end, task.m_depth + 1 });
+            tasks.push_back({ UINT32_MAX, task.m_begin, split, task.m_depth + 1 });
+        }
+
+        m_primitives.resize(count);
+
+        for (uint32_t position = 0; position < count; ++position)
+            m_primitives[position] = primitives[position].m_index;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    uint32_t BVH<TValueType>::Split(std::span<BuildPrimitive> primitives, uint32_t depth, uint32_t maxLeafSize,
+                                    const Bounds& nodeBounds, const Bounds& centroidBounds)
+    {
+        // Relative cost of visiting a node, intersecting a primitive costs 1
+        constexpr TValueType    traversalCost = static_cast<TValueType>(1);
+
+        const uint32_t          count = static_cast<uint32_t>(primitives.size());
+
+        if (count <= 1 || depth + 1 >= MaxDepth)
+            return count;
+
+        TValueType              low[3], scale[3];
+        Bin                     bins[3][BinCount];
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const TValueType    extent = centroidBounds.m_max[axis] - centroidBounds.m_min[axis];
+
+            low[axis] = centroidBounds.m_min[axis];
+
+            // All centroids on one plane, no split along this axis
+            scale[axis] = (extent > static_cast<TValueType>(0)) ?
+                          static_cast<TValueType>(BinCount) / extent : static_cast<TValueType>(0);
+        }
+
+        // Rounding can land on BinCount for the highest centroid
+        const auto              binIndex = [&](int axis, const BuildPrimitive& primitive)
+        {
+            const uint32_t      bin = static_cast<uint32_t>((primitive.m_centroid[axis] - low[axis]) * scale[axis]);
+
+            return (bin < BinCount) ? bin : BinCount - 1;
+        };
+
+        for (const BuildPrimitive& primitive : primitives)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                Bin&            bin = bins[axis][binIndex(axis, primitive)];
+
+                bin.m_bounds.Merge(primitive.m_bounds);
+                ++bin.m_count;
+            }
+        }
+
+        // Unnormalized SAH: area * count on each side
+        TValueType              bestCost = std::numeric_limits<TValueType>::infinity();
+        int                     bestAxis = -1;
+        uint32_t                bestBin = 0;
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (scale[axis] == static_cast<TValueType>(0))
+                continue;
+
+            // Right side of each plane, plane n lies between bins n - 1 and n
+            TValueType          rightCosts[BinCount];
+            Bounds              side;
+            uint32_t            sideCount = 0;
+
+            for (uint32_t plane = BinCount - 1; plane > 0; --plane)
+            {
+                side.Merge(bins[axis][plane].m_bounds);
+                sideCount += bins[axis][plane].m_count;
+                rightCosts[plane] = (sideCount != 0) ?
+                                    side.SurfaceArea() * static_cast<TValueType>(sideCount) :
+                                    std::numeric_limits<TValueType>::infinity();
+            }
+
+            side = Bounds();
+            sideCount = 0;
+
+            for (uint32_t plane = 1; plane < BinCount; ++plane)
+            {
+                side.Merge(bins[axis][plane - 1].m_bounds);
+                sideCount += bins[axis][plane - 1].m_count;
+
+                if (sideCount == 0)
+                    continue;
+
+                const TValueType    cost = side.SurfaceArea() * static_cast<TValueType>(sideCount) +
+                                           rightCosts[plane];
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = plane;
+                }
+            }
+        }
+
+        const TValueType        area = nodeBounds.SurfaceArea();
+
+        // Identical centroids (or flat bounds): halve the range if the
+        // leaf would be too large, the order does not matter
+        if (bestAxis < 0 || area <= static_cast<TValueType>(0))
+            return (count > maxLeafSize) ? count / 2 : count;
+
+        if (count <= maxLeafSize && traversalCost + bestCost / area >= static_cast<TValueType>(count))
+            return count;
+
+        const auto              middle = std::partition(primitives.begin(), primitives.end(),
+                                                        [&](const BuildPrimitive& primitive)
+                                                        {
+                                                            return binIndex(bestAxis, primitive) < bestBin;
+                                                        });
+
+        // Both sides hold at least one primitive, as counted in the bins
+        return static_cast<uint32_t>(middle - primitives.begin());
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void BVH<TValueType>::Refit(std::span<const AABB3<TValueType>> bounds)
+    {
+        if (bounds.size() != m_primitives.size())
+            throw std::logic_error("BVH refit primitive count does not match build");
+
+        // Children always come after their parent
+        for (std::size_t index = m_nodes.size(); index-- > 0;)
+        {
+            Node&                   node = m_nodes[index];
+            Bounds                  nodeBounds;
+
+            if (node.IsLeaf())
+            {
+                for (uint32_t position = node.m_offset; position < node.m_offset + node.m_count; ++position)
+                    nodeBounds.Merge(MakeBounds(bounds[m_primitives[position]]));
+
+                SetNodeBounds(node, nodeBounds);
+                continue;
+            }
+
+            const Node&             first = m_nodes[index + 1];
+            const Node&             second = m_nodes[node.m_offset];
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                node.m_min[axis] = math::Min(first.m_min[axis], second.m_min[axis]);
+                node.m_max[axis] = math::Max(first.m_max[axis], second.m_max[axis]);
+            }
+        }
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void BVH<TValueType>::Clear(void)
+    {
+        m_nodes.clear();
+        m_primitives.clear();
+    }
+
+
+    template <CFloatingType TValueType>
+    template <typename TFunction> inline
+    void BVH<TValueType>::Overlaps(const AABB3<TValueType>& box, TFunction&& function) const
+    {
+        if (m_nodes.empty() || !NodeOverlaps(m_nodes[0], box))
+            return;
+
+        uint32_t        stack[MaxDepth];
+        uint32_t        stackSize = 0;
+        uint32_t        index = 0;
+
+        while (true)
+        {
+            const Node&     node = m_nodes[index];
+
+            if (node.IsLeaf())
+            {
+                for (uint32_t position = node.m_offset; position < node.m_offset + node.m_count; ++position)
+                    function(position);
+            }
+
+            else
+            {
+                const bool  first = NodeOverlaps(m_nodes[index + 1], box);
+                const bool  second = NodeOverlaps(m_nodes[node.m_offset], box);
+
+                if (first)
+                {
+                    if (second)
+                        stack[stackSize++] = node.m_offset;
+
+                    index = index + 1;
+                    continue;
+                }
+
+                if (second)
+                {
+                    index = node.m_offset;
+                    continue;
+                }
+            }
+
+            if (stackSize == 0)
+                return;
+
+            index = stack[--stackSize];
+        }
+    }
+
+
+    template <CFloatingType TValueType>
+    template <typename TFunction> inline
+    bool BVH<TValueType>::Raycast(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                  TValueType& distance, TFunction&& intersect) const
+    {
+        return Traverse<false>(origin, direction, distance, intersect);
+    }
+
+
+    template <CFloatingType TValueType>
+    template <typename TFunction> inline
+    bool BVH<TValueType>::AnyHit(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                 TValueType distance, TFunction&& intersect) const
+    {
+        return Traverse<true>(origin, direction, distance, intersect);
+    }
+
+
+    template <CFloatingType TValueType>
+    template <bool TAnyHit, typename TFunction> inline
+    bool BVH<TValueType>::Traverse(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                   TValueType& distance, TFunction& intersect) const
+    {
+        constexpr TValueType    miss = std::numeric_limits<TValueType>::infinity();
+
+        if (m_nodes.empty())
+            return false;
+
+        const TValueType        rayOrigin[3] = { origin.GetX(), origin.GetY(), origin.GetZ() };
+
+        // Zero components become infinities, handled by the slab test
+        const TValueType        inverseDirection[3] =
+        {
+            static_cast<TValueType>(1) / direction.GetX(),
+            static_cast<TValueType>(1) / direction.GetY(),
+            static_cast<TValueType>(1) / direction.GetZ()
+        };
+
+        if (EntryDistance(m_nodes[0], rayOrigin, inverseDirection, distance) == miss)
+            return false;
+
+        // Far children waiting to be visited, with their entry distance
+        // to skip them if a closer hit was found since
+        uint32_t                stack[MaxDepth];
+        TValueType              stackEntries[MaxDepth];
+        uint32_t                stackSize = 0;
+
+        uint32_t                index = 0;
+        bool                    hit = false;
+
+        while (true)
+        {
+            const Node&     node = m_nodes[index];
+
+            if (node.IsLeaf())
+            {
+                for (uint32_t position = node.m_offset; position < node.m_offset + node.m_count; ++position)
+                {
+                    if (intersect(position, distance))
+                    {
+                        if constexpr (TAnyHit)
+                            return true;
+
+                        hit = true;
+                    }
+                }
+            }
+
+            else
+            {
+                uint32_t        first = index + 1;
+                uint32_t        second = node.m_offset;
+                TValueType      firstEntry = EntryDistance(m_nodes[first], rayOrigin, inverseDirection, distance);
+                TValueType      secondEntry = EntryDistance(m_nodes[second], rayOrigin, inverseDirection, distance);
+
+                if (secondEntry < firstEntry)
+                {
+                    std::swap(first, second);
+                    std::swap(firstEntry, secondEntry);
+                }
+
+                if (firstEntry != miss)
+                {
+                    if (secondEntry != miss)
+                    {
+                        stack[stackSize] = second;
+                        stackEntries[stackSize++] = secondEntry;
+                    }
+
+                    index = first;
+                    continue;
+                }
+            }
+
+            // Next far child still in front of the closest hit
+            do
+            {
+                if (stackSize == 0)
+                    return hit;
+
+                --stackSize;
+            } while (stackEntries[stackSize] > distance);
+
+            index = stack[stackSize];
+        }
+    }
+
+
+    template <CFloatingType TValueType>
+    template <typename TFunction> inline
+    bool BVH<TValueType>::Nearest(const Vector3<TValueType>& point, TValueType& distanceSquared,
+                                  TFunction&& measure) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        const TValueType        position[3] = { point.GetX(), point.GetY(), point.GetZ() };
+
+        if (NodeDistanceSquared(m_nodes[0], position) > distanceSquared)
+            return false;
+
+        uint32_t                stack[MaxDepth];
+        TValueType              stackDistances[MaxDepth];
+        uint32_t                stackSize = 0;
+
+        uint32_t                index = 0;
+        bool                    found = false;
+
+        while (true)
+        {
+            const Node&     node = m_nodes[index];
+
+            if (node.IsLeaf())
+            {
+                for (uint32_t primitive = node.m_offset; primitive < node.m_offset + node.m_count; ++primitive)
+                    found = measure(primitive, distanceSquared) || found;
+            }
+
+            else
+            {
+                uint32_t        first = index + 1;
+                uint32_t        second = node.m_offset;
+                TValueType      firstDistance = NodeDistanceSquared(m_nodes[first], position);
+                TValueType      secondDistance = NodeDistanceSquared(m_nodes[second], position);
+
+                if (secondDistance < firstDistance)
+                {
+                    std::swap(first, second);
+                    std::swap(firstDistance, secondDistance);
+                }
+
+                if (firstDistance <= distanceSquared)
+                {
+                    if (secondDistance <= distanceSquared)
+                    {
+                        stack[stackSize] = second;
+                        stackDistances[stackSize++] = secondDistance;
+                    }
+
+                    index = first;
+                    continue;
+                }
+            }
+
+            do
+            {
+                if (stackSize == 0)
+                    return found;
+
+                --stackSize;
+            } while (stackDistances[stackSize] > distanceSquared);
+
+            index = stack[stackSize];
+        }
+    }
+
+
+    template <CFloatingType TValueType> inline
+    AABB3<TValueType> BVH<TValueType>::GetBounds(void) const
+    {
+        return m_nodes.empty() ? AABB3<TValueType>() : NodeBounds(m_nodes[0]);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::span<const typename BVH<TValueType>::Node> BVH<TValueType>::Nodes(void) const
+    {
+        return m_nodes;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::span<const uint32_t> BVH<TValueType>::Primitives(void) const
+    {
+        return m_primitives;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool BVH<TValueType>::Empty(void) const
+    {
+        return m_nodes.empty();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    TValueType BVH<TValueType>::EntryDistance(const Node& node, const TValueType (&origin)[3],
+                                              const TValueType (&inverseDirection)[3], TValueType distance)
+    {
+        TValueType      entry = static_cast<TValueType>(0);
+        TValueType      exit = distance;
+
+        // Same slab test as AABB::IntersectRay, including NaN slabs
+        // (ray in a face plane of the node and parallel to it)
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const TValueType    first = (node.m_min[axis] - origin[axis]) * inverseDirection[axis];
+            const TValueType    second = (node.m_max[axis] - origin[axis]) * inverseDirection[axis];
+
+            if (first != first || second != second)
+                continue;
+
+            entry = math::Max(math::Min(first, second), entry);
+            exit = math::Min(math::Max(first, second), exit);
+        }
+
+        return (entry <= exit) ? entry : std::numeric_limits<TValueType>::infinity();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    TValueType BVH<TValueType>::NodeDistanceSquared(const Node& node, const TValueType (&point)[3])
+    {
+        TValueType      result = static_cast<TValueType>(0);
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const TValueType    below = math::Max(node.m_min[axis] - point[axis], static_cast<TValueType>(0));
+            const TValueType    above = math::Max(point[axis] - node.m_max[axis], static_cast<TValueType>(0));
+
+            result += below * below + above * above;
+        }
+
+        return result;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool BVH<TValueType>::NodeOverlaps(const Node& node, const AABB3<TValueType>& box)
+    {
+        return (node.m_min[0] <= box.GetMax().GetX()) & (box.GetMin().GetX() <= node.m_max[0]) &
+               (node.m_min[1] <= box.GetMax().GetY()) & (box.GetMin().GetY() <= node.m_max[1]) &
+               (node.m_min[2] <= box.GetMax().GetZ()) & (box.GetMin().GetZ() <= node.m_max[2]);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    AABB3<TValueType> BVH<TValueType>::NodeBounds(const Node& node)
+    {
+        return AABB3<TValueType>(Vector3<TValueType>(node.m_min[0], node.m_min[1], node.m_min[2]),
+                                 Vector3<TValueType>(node.m_max[0], node.m_max[1], node.m_max[2]));
+    }
+
+
+    template <CFloatingType TValueType> inline
+    typename BVH<TValueType>::Bounds BVH<TValueType>::MakeBounds(const Node& node)
+    {
+        return { { node.m_min[0], node.m_min[1], node.m_min[2] }, { node.m_max[0], node.m_max[1], node.m_max[2] } };
+    }
+
+
+    template <CFloatingType TValueType> inline
+    typename BVH<TValueType>::Bounds BVH<TValueType>::MakeBounds(const AABB3<TValueType>& box)
+    {
+        return { { box.GetMin().GetX(), box.GetMin().GetY(), box.GetMin().GetZ() },
+                 { box.GetMax().GetX(), box.GetMax().GetY(), box.GetMax().GetZ() } };
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void BVH<TValueType>::SetNodeBounds(Node& node, const Bounds& bounds)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            node.m_min[axis] = bounds.m_min[axis];
+            node.m_max[axis] = bounds.m_max[axis];
+        }
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void BVH<TValueType>::Bounds::Merge(const Bounds& other)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            m_min[axis] = math::Min(m_min[axis], other.m_min[axis]);
+            m_max[axis] = math::Max(m_max[axis], other.m_max[axis]);
+        }
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void BVH<TValueType>::Bounds::Merge(const TValueType (&point)[3])
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            m_min[axis] = math::Min(m_min[axis], point[axis]);
+            m_max[axis] = math::Max(m_max[axis], point[axis]);
+        }
+    }
+
+
+    template <CFloatingType TValueType> inline
+    TValueType BVH<TValueType>::Bounds::SurfaceArea(void) const
+    {
+        const TValueType        x = m_max[0] - m_min[0];
+        const TValueType        y = m_max[1] - m_min[1];
+        const TValueType        z = m_max[2] - m_min[2];
+
+        if (x < static_cast<TValueType>(0) || y < static_cast<TValueType>(0) || z < static_cast<TValueType>(0))
+            return static_cast<TValueType>(0);
+
+        return static_cast<TValueType>(2) * (x * y + y * z + z * x);
+    }
+
+
+    static_assert(sizeof(BVH<float>::Node) == 32, "BVH nodes should fit two per cache line");
+
+
+    // ---- TriangleBVH ----
+
+    template <CFloatingType TValueType> inline
+    void TriangleBVH<TValueType>::Build(std::span<const Vector3<TValueType>> vertices,
+                                        std::span<const uint32_t> indices, uint32_t maxLeafSize)
+    {
+        const std::vector<Vector3<TValueType>>  triangles = Gather(vertices, indices);
+
+        Build(triangles, maxLeafSize);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TriangleBVH<TValueType>::Build(std::span<const Vector3<TValueType>> triangles, uint32_t maxLeafSize)
+    {
+        if (triangles.size() % 3 != 0)
+            throw std::logic_error("Triangle vertex count must be a multiple of 3");
+
+        m_bvh.Build(TriangleBounds(triangles), maxLeafSize);
+        Reorder(triangles);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TriangleBVH<TValueType>::Refit(std::span<const Vector3<TValueType>> vertices,
+                                        std::span<const uint32_t> indices)
+    {
+        const std::vector<Vector3<TValueType>>  triangles = Gather(vertices, indices);
+
+        Refit(triangles);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TriangleBVH<TValueType>::Refit(std::span<const Vector3<TValueType>> triangles)
+    {
+        if (triangles.size() != m_vertices.size())
+            throw std::logic_error("Triangle refit vertex count does not match build");
+
+        m_bvh.Refit(TriangleBounds(triangles));
+        Reorder(triangles);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TriangleBVH<TValueType>::Clear(void)
+    {
+        m_bvh.Clear();
+        m_vertices.clear();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool TriangleBVH<TValueType>::Raycast(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                          TValueType maxDistance, RayHit& hit) const
+    {
+        const std::span<const uint32_t>     primitives = m_bvh.Primitives();
+
+        TValueType                          distance = maxDistance;
+
+        return m_bvh.Raycast(origin, direction, distance, [&](uint32_t position, TValueType& closest)
+        {
+            const Vector3<TValueType>*  triangle = m_vertices.data() + 3 * static_cast<std::size_t>(position);
+            TValueType                  u, v;
+
+            if (!IntersectRayTriangle(origin, direction, triangle[0], triangle[1], triangle[2], closest,
+                                      closest, u, v))
+                return false;
+
+            hit = { primitives[position], closest, u, v };
+            return true;
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool TriangleBVH<TValueType>::AnyHit(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                         TValueType maxDistance) const
+    {
+        return m_bvh.AnyHit(origin, direction, maxDistance, [&](uint32_t position, TValueType closest)
+        {
+            const Vector3<TValueType>*  triangle = m_vertices.data() + 3 * static_cast<std::size_t>(position);
+            TValueType                  hitDistance, u, v;
+
+            return IntersectRayTriangle(origin, direction, triangle[0], triangle[1], triangle[2], closest,
+                                        hitDistance, u, v);
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t TriangleBVH<TValueType>::Overlaps(const AABB3<TValueType>& box, std::vector<uint32_t>& triangles) const
+    {
+        const std::span<const uint32_t>     primitives = m_bvh.Primitives();
+        const std::size_t                   start = triangles.size();
+
+        m_bvh.Overlaps(box, [&](uint32_t position)
+        {
+            const Vector3<TValueType>*  triangle = m_vertices.data() + 3 * static_cast<std::size_t>(position);
+
+            if (detail::OverlapTriangleBox(triangle[0], triangle[1], triangle[2], box))
+                triangles.push_back(primitives[position]);
+        });
+
+        return triangles.size() - start;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool TriangleBVH<TValueType>::ClosestPoint(const Vector3<TValueType>& point, PointHit& hit,
+                                               TValueType maxDistance) const
+    {
+        const std::span<const uint32_t>     primitives = m_bvh.Primitives();
+        TValueType                          distanceSquared = maxDistance * maxDistance;
+
+        return m_bvh.Nearest(point, distanceSquared, [&](uint32_t position, TValueType& closest)
+        {
+            const Vector3<TValueType>*  triangle = m_vertices.data() + 3 * static_cast<std::size_t>(position);
+            const Vector3<TValueType>   candidate = detail::ClosestPointOnTriangle(point, triangle[0], triangle[1],
+                                                                                   triangle[2]);
+            const TValueType            candidateDistance = point.DistanceSquaredFrom(candidate);
+
+            if (candidateDistance > closest)
+                return false;
+
+            closest = candidateDistance;
+            hit = { primitives[position], candidateDistance, candidate };
+            return true;
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t TriangleBVH<TValueType>::TriangleCount(void) const
+    {
+        return m_vertices.size() / 3;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    const BVH<TValueType>& TriangleBVH<TValueType>::GetBVH(void) const
+    {
+        return m_bvh;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::vector<Vector3<TValueType>> TriangleBVH<TValueType>::Gather(std::span<const Vector3<TValueType>> vertices,
+                                                                     std::span<const uint32_t> indices)
+    {
+        if (indices.size() % 3 != 0)
+            throw std::logic_error("Triangle index count must be a multiple of 3");
+
+        std::vector<Vector3<TValueType>>    triangles(indices.size());
+
+        for (std::size_t index = 0; index < indices.size(); ++index)
+        {
+            if (indices[index] >= vertices.size())
+                throw std::logic_error("Vertex index out of range");
+
+            triangles[index] = vertices[indices[index]];
+        }
+
+        return triangles;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::vector<AABB3<TValueType>> TriangleBVH<TValueType>::TriangleBounds(std::span<const Vector3<TValueType>> triangles)
+    {
+        std::vector<AABB3<TValueType>>      bounds(triangles.size() / 3);
+
+        for (std::size_t triangle = 0; triangle < bounds.size(); ++triangle)
+        {
+            bounds[triangle].Merge(triangles[3 * triangle]);
+            bounds[triangle].Merge(triangles[3 * triangle + 1]);
+            bounds[triangle].Merge(triangles[3 * triangle + 2]);
+        }
+
+        return bounds;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TriangleBVH<TValueType>::Reorder(std::span<const Vector3<TValueType>> triangles)
+    {
+        const std::span<const uint32_t>     primitives = m_bvh.Primitives();
+
+        m_vertices.resize(triangles.size());
+
+        for (std::size_t position = 0; position < primitives.size(); ++position)
+        {
+            const std::size_t   source = 3 * static_cast<std::size_t>(primitives[position]);
+
+            m_vertices[3 * position] = triangles[source];
+            m_vertices[3 * position + 1] = triangles[source + 1];
+            m_vertices[3 * position + 2] = triangles[source + 2];
+        }
+    }
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class BVH<float>;
+    extern template class BVH<double>;
+
+    extern template class TriangleBVH<float>;
+    extern template class TriangleBVH<double>;
+}
+
+#endif
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
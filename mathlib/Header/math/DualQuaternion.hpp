@@ -0,0 +1,517 @@
+#ifndef __DUAL_QUATERNION_H__
+#define __DUAL_QUATERNION_H__
+
+#include <cstdint>
+#include <span>
+
+#include "MathGeneric.hpp"
+#include "Arithmetic.hpp"
+#include "Trigonometry.hpp"
+
+#include "Vector3.hpp"
+#include "Matrix4.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+
+namespace math
+{
+    // Rigid transform (rotation then translation) as real + dual * e,
+    // with e^2 = 0. The real part is the rotation and the dual part is
+    // half the translation times the rotation. Unit dual quaternions
+    // blend without the shrinking of matrix palette skinning
+    template <CFloatingType TValueType>
+    class DualQuaternion
+    {
+    public:
+
+                                DualQuaternion(void) = default;
+                                DualQuaternion(const DualQuaternion&) = default;
+
+                                DualQuaternion(const Quaternion<TValueType>& real, const Quaternion<TValueType>& dual);
+
+                                DualQuaternion(const Quaternion<TValueType>& rotation, const Vector3<TValueType>& translation);
+
+        // Take the rotation and translation of a rigid Matrix4 (no scale)
+        explicit                DualQuaternion(const Matrix4<TValueType>& matrix);
+
+                                ~DualQuaternion(void) = default;
+
+        // Conjugate both parts (inverse of a unit dual quaternion)
+        DualQuaternion          Conjugate(void)                                         const;
+
+        DualQuaternion          Inverse(void)                                           const;
+
+        // Make the real part unit length and the dual part orthogonal to it
+        DualQuaternion          Normalized(void)                                        const;
+        void                    Normalize(void);
+
+        Quaternion<TValueType>  GetRotation(void)                                       const;
+        Vector3<TValueType>     GetTranslation(void)                                    const;
+
+        // Transform a point (rotation then translation), must be normalized
+        Vector3<TValueType>     TransformPoint(const Vector3<TValueType>& point)        const;
+
+        // Transform a direction (translation is ignored), must be normalized
+        Vector3<TValueType>     TransformDirection(const Vector3<TValueType>& direction) const;
+
+        Matrix4<TValueType>     ToMatrix4(void)                                         const;
+
+        explicit                operator Matrix4<TValueType>(void)                      const;
+
+        DualQuaternion&         operator=(const DualQuaternion& rhs) = default;
+
+        // Compose transforms, rhs is applied first
+        DualQuaternion          operator*(const DualQuaternion& rhs)                    const;
+        DualQuaternion&         operator*=(const DualQuaternion& rhs);
+
+        DualQuaternion          operator+(const DualQuaternion& rhs)                    const;
+        DualQuaternion          operator-(const DualQuaternion& rhs)                    const;
+        DualQuaternion          operator*(TValueType rhs)                               const;
+
+        bool                    operator==(const DualQuaternion& rhs)                   const;
+        bool                    operator!=(const DualQuaternion& rhs)                   const;
+
+        // Linear blend then normalize along the shortest path (DLB).
+        // Cheap, and constant speed is not kept
+        static DualQuaternion   Nlerp(const DualQuaternion& from, const DualQuaternion& to, TValueType ratio);
+
+        // Screw linear interpolation, constant speed rotation around and
+        // translation along the screw axis between both transforms.
+        // Both must be normalized
+        static DualQuaternion   ScLerp(const DualQuaternion& from, const DualQuaternion& to, TValueType ratio);
+
+        static DualQuaternion   Identity(void);
+
+        const Quaternion<TValueType>&   GetReal(void)   const { return m_real; }
+        const Quaternion<TValueType>&   GetDual(void)   const { return m_dual; }
+
+        Quaternion<TValueType>&         Real(void)      { return m_real; }
+        Quaternion<TValueType>&         Dual(void)      { return m_dual; }
+
+    private:
+
+        Quaternion<TValueType>  m_real;
+        Quaternion<TValueType>  m_dual;
+    };
+
+
+    using DualQuatf = DualQuaternion<float>;
+    using DualQuatd = DualQuaternion<double>;
+
+
+    // Blend a set of transforms with their weights (DLB). Signs are
+    // matched to the first transform so all rotations take the short path.
+    // Both spans must have the same size. The float and double overloads
+    // take spans or containers without a template argument
+    template <CFloatingType TValueType>
+    DualQuaternion<TValueType>  Blend(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> transforms,
+                                      std::type_identity_t<std::span<const TValueType>> weights);
+
+    inline DualQuaternion<float>    Blend(std::span<const DualQuaternion<float>> transforms,
+                                          std::span<const float> weights);
+    inline DualQuaternion<double>   Blend(std::span<const DualQuaternion<double>> transforms,
+                                          std::span<const double> weights);
+
+    // Blend two arrays of transforms with the same ratio, see DualQuaternion::Nlerp.
+    // All spans must have the same size, out may be the same memory as from or to
+    template <CFloatingType TValueType>
+    void                Nlerp(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> from,
+                              std::type_identity_t<std::span<const DualQuaternion<TValueType>>> to,
+                              TValueType ratio, std::type_identity_t<std::span<DualQuaternion<TValueType>>> out);
+
+    // Skinning: blend palette transforms for each vertex. indices and weights
+    // hold the same number of influences per vertex, one vertex after the other.
+    // The type is deduced from the output span, the float and double
+    // overloads also take containers directly
+    template <CFloatingType TValueType>
+    void                Blend(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> palette,
+                              std::span<const std::uint32_t> indices,
+                              std::type_identity_t<std::span<const TValueType>> weights,
+                              std::span<DualQuaternion<TValueType>> out);
+
+    inline void         Blend(std::span<const DualQuaternion<float>> palette, std::span<const std::uint32_t> indices,
+                              std::span<const float> weights, std::span<DualQuaternion<float>> out);
+    inline void         Blend(std::span<const DualQuaternion<double>> palette, std::span<const std::uint32_t> indices,
+                              std::span<const double> weights, std::span<DualQuaternion<double>> out);
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType>::DualQuaternion(const Quaternion<TValueType>& real, const Quaternion<TValueType>& dual)
+        : m_real(real), m_dual(dual)
+    {
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType>::DualQuaternion(const Quaternion<TValueType>& rotation,
+                                               const Vector3<TValueType>& translation)
+        : m_real(rotation)
+    {
+        // dual = 0.5 * (0, translation) * rotation
+        const TValueType    half = static_cast<TValueType>(0.5);
+
+        m_dual = Quaternion<TValueType>(static_cast<TValueType>(0), translation.GetX() * half,
+                                        translation.GetY() * half, translation.GetZ() * half) * rotation;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType>::DualQuaternion(const Matrix4<TValueType>& matrix)
+    {
+        const Vector4<TValueType>   translation = matrix[3];
+
+        *this = DualQuaternion(Quaternion<TValueType>::FromRotationMatrix(matrix),
+                               Vector3<TValueType>(translation.GetX(), translation.GetY(), translation.GetZ()));
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::Conjugate(void) const
+    {
+        return DualQuaternion(m_real.Conjugate(), m_dual.Conjugate());
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::Inverse(void) const
+    {
+        // (r + d e)^-1 = r^-1 - r^-1 d r^-1 e
+        const Quaternion<TValueType>    realInverse = m_real.Inverse();
+
+        // Quaternion::operator-(void) is the inverse, negate by scaling
+        return DualQuaternion(realInverse, realInverse * m_dual * realInverse * static_cast<TValueType>(-1));
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::Normalized(void) const
+    {
+        DualQuaternion  copy = *this;
+
+        copy.Normalize();
+        return copy;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void DualQuaternion<TValueType>::Normalize(void)
+    {
+        // Divide by |real|, then remove the part of dual along real
+        // so that real . dual = 0 holds exactly
+        const TValueType    lengthSquared = m_real.LengthSquared();
+        const TValueType    invLength = static_cast<TValueType>(1) / SquareRoot(lengthSquared);
+        const TValueType    parallel = Dot(m_real, m_dual) / lengthSquared;
+
+        m_dual = (m_dual - m_real * parallel) * invLength;
+        m_real = m_real * invLength;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    Quaternion<TValueType> DualQuaternion<TValueType>::GetRotation(void) const
+    {
+        return m_real;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    Vector3<TValueType> DualQuaternion<TValueType>::GetTranslation(void) const
+    {
+        // Vector part of 2 * dual * conjugate(real)
+        const Vector3<TValueType>   realVector(m_real.GetX(), m_real.GetY(), m_real.GetZ());
+        const Vector3<TValueType>   dualVector(m_dual.GetX(), m_dual.GetY(), m_dual.GetZ());
+
+        return (dualVector * m_real.GetW() - realVector * m_dual.GetW() + realVector.Cross(dualVector)) *
+               static_cast<TValueType>(2);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    Vector3<TValueType> DualQuaternion<TValueType>::TransformPoint(const Vector3<TValueType>& point) const
+    {
+        return m_real.Rotate(point) + GetTranslation();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    Vector3<TValueType> DualQuaternion<TValueType>::TransformDirection(const Vector3<TValueType>& direction) const
+    {
+        return m_real.Rotate(direction);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    Matrix4<TValueType> DualQuaternion<TValueType>::ToMatrix4(void) const
+    {
+        return Matrix4<TValueType>::TRS(GetTranslation(), m_real, Vector3<TValueType>(static_cast<TValueType>(1)));
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType>::operator Matrix4<TValueType>(void) const
+    {
+        return ToMatrix4();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::operator*(const DualQuaternion& rhs) const
+    {
+        return DualQuaternion(m_real * rhs.m_real, m_real * rhs.m_dual + m_dual * rhs.m_real);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType>& DualQuaternion<TValueType>::operator*=(const DualQuaternion& rhs)
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::operator+(const DualQuaternion& rhs) const
+    {
+        return DualQuaternion(m_real + rhs.m_real, m_dual + rhs.m_dual);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::operator-(const DualQuaternion& rhs) const
+    {
+        return DualQuaternion(m_real - rhs.m_real, m_dual - rhs.m_dual);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::operator*(TValueType rhs) const
+    {
+        return DualQuaternion(m_real * rhs, m_dual * rhs);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool DualQuaternion<TValueType>::operator==(const DualQuaternion& rhs) const
+    {
+        return m_real == rhs.m_real && m_dual == rhs.m_dual;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool DualQuaternion<TValueType>::operator!=(const DualQuaternion& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::Nlerp(const DualQuaternion& from, const DualQuaternion& to,
+                                                                 TValueType ratio)
+    {
+        const TValueType    toRatio = (Dot(from.m_real, to.m_real) < static_cast<TValueType>(0)) ? -ratio : ratio;
+
+        return (from * (static_cast<TValueType>(1) - ratio) + to * toRatio).Normalized();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::ScLerp(const DualQuaternion& from, const DualQuaternion& to,
+                                                                  TValueType ratio)
+    {
+        // from * (from^-1 * to)^ratio, the power is taken on the screw
+        // parameters: angle, pitch (slide along the axis), axis and moment
+        DualQuaternion      difference = from.Conjugate() * to;
+
+        if (difference.m_real.GetW() < static_cast<TValueType>(0))
+            difference = difference * static_cast<TValueType>(-1);
+
+        const TValueType    half = static_cast<TValueType>(0.5), two = static_cast<TValueType>(2);
+
+        const Vector3<TValueType>   realVector(difference.m_real.GetX(), difference.m_real.GetY(), difference.m_real.GetZ());
+        const Vector3<TValueType>   dualVector(difference.m_dual.GetX(), difference.m_dual.GetY(), difference.m_dual.GetZ());
+
+        const TValueType    sinHalfAngle = realVector.Magnitude();
+
+        // No rotation: only the translation is scaled
+        if (sinHalfAngle < static_cast<TValueType>(1e-6))
+        {
+            const Vector3<TValueType>   translation = difference.GetTranslation() * ratio;
+
+            return from * DualQuaternion(Quaternion<TValueType>::Identity(), translation);
+        }
+
+        const TValueType            cosHalfAngle = difference.m_real.GetW();
+        const TValueType            halfAngle = Atan2(sinHalfAngle, cosHalfAngle).Raw();
+        const TValueType            invSinHalfAngle = static_cast<TValueType>(1) / sinHalfAngle;
+
+        const Vector3<TValueType>   axis = realVector * invSinHalfAngle;
+        const TValueType            pitch = -two * difference.m_dual.GetW() * invSinHalfAngle;
+        const Vector3<TValueType>   moment = (dualVector - axis * (pitch * half * cosHalfAngle)) * invSinHalfAngle;
+
+        // Scale the angle and pitch, keep the axis
+        const TValueType            scaledPitch = pitch * ratio;
+        TValueType                  sine, cosine;
+
+        SinCos(Radian<TValueType>(halfAngle * ratio), sine, cosine);
+
+        const Vector3<TValueType>   realPart = axis * sine;
+        const Vector3<TValueType>   dualPart = moment * sine + axis * (scaledPitch * half * cosine);
+
+        const DualQuaternion        power
+        (
+            Quaternion<TValueType>(cosine, realPart.GetX(), realPart.GetY(), realPart.GetZ()),
+            Quaternion<TValueType>(-scaledPitch * half * sine, dualPart.GetX(), dualPart.GetY(), dualPart.GetZ())
+        );
+
+        return from * power;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> DualQuaternion<TValueType>::Identity(void)
+    {
+        return DualQuaternion(Quaternion<TValueType>::Identity(), Quaternion<TValueType>(static_cast<TValueType>(0)));
+    }
+
+
+    template <CFloatingType TValueType> inline
+    DualQuaternion<TValueType> Blend(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> transforms,
+                                     std::type_identity_t<std::span<const TValueType>> weights)
+    {
+        if (transforms.size() != weights.size())
+            throw std::logic_error("Input span sizes do not match");
+
+        if (transforms.empty())
+            return DualQuaternion<TValueType>::Identity();
+
+        const Quaternion<TValueType>&   pivot = transforms[0].GetReal();
+        DualQuaternion<TValueType>      result = transforms[0] * weights[0];
+
+        for (std::size_t index = 1; index < transforms.size(); ++index)
+        {
+            const TValueType    weight = (Dot(pivot, transforms[index].GetReal()) < static_cast<TValueType>(0)) ?
+                                         -weights[index] : weights[index];
+
+            result = result + transforms[index] * weight;
+        }
+
+        return result.Normalized();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void Nlerp(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> from,
+               std::type_identity_t<std::span<const DualQuaternion<TValueType>>> to,
+               TValueType ratio, std::type_identity_t<std::span<DualQuaternion<TValueType>>> out)
+    {
+        if (from.size() != out.size() || to.size() != out.size())
+            throw std::logic_error("Input span sizes do not match output");
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            static_assert(sizeof(DualQuaternion<float>) == 8 * sizeof(float), "DualQuaternion must be tightly packed");
+
+            simd::NlerpDualQuaternions(reinterpret_cast<const float*>(from.data()), reinterpret_cast<const float*>(to.data()),
+                                       reinterpret_cast<float*>(out.data()), out.size(), ratio);
+            return;
+        }
+#endif
+
+        for (std::size_t index = 0; index < out.size(); ++index)
+            out[index] = DualQuaternion<TValueType>::Nlerp(from[index], to[index], ratio);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void Blend(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> palette,
+               std::span<const std::uint32_t> indices,
+               std::type_identity_t<std::span<const TValueType>> weights,
+               std::span<DualQuaternion<TValueType>> out)
+    {
+        const std::size_t   influences = out.empty() ? 0 : weights.size() / out.size();
+
+        if (indices.size() != weights.size() || weights.size() != out.size() * influences ||
+            (!out.empty() && influences == 0))
+            throw std::logic_error("Input span sizes do not match output");
+
+        for (std::uint32_t index : indices)
+        {
+            if (index >= palette.size())
+                throw std::logic_error("Palette index out of range");
+        }
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            static_assert(sizeof(DualQuaternion<float>) == 8 * sizeof(float), "DualQuaternion must be tightly packed");
+
+            simd::BlendDualQuaternions(reinterpret_cast<const float*>(palette.data()), indices.data(), weights.data(),
+                                       reinterpret_cast<float*>(out.data()), out.size(), influences);
+            return;
+        }
+#endif
+
+        for (std::size_t vertex = 0; vertex < out.size(); ++vertex)
+        {
+            const std::size_t               first = vertex * influences;
+            const Quaternion<TValueType>&   pivot = palette[indices[first]].GetReal();
+            DualQuaternion<TValueType>      result = palette[indices[first]] * weights[first];
+
+            // Same sign correction as the span Blend above
+            for (std::size_t influence = first + 1; influence < first + influences; ++influence)
+            {
+                const DualQuaternion<TValueType>&   transform = palette[indices[influence]];
+                const TValueType                    weight = (Dot(pivot, transform.GetReal()) < static_cast<TValueType>(0)) ?
+                                                             -weights[influence] : weights[influence];
+
+                result = result + transform * weight;
+            }
+
+            out[vertex] = result.Normalized();
+        }
+    }
+
+
+    inline DualQuaternion<float> Blend(std::span<const DualQuaternion<float>> transforms, std::span<const float> weights)
+    {
+        return Blend<float>(transforms, weights);
+    }
+
+
+    inline DualQuaternion<double> Blend(std::span<const DualQuaternion<double>> transforms,
+                                        std::span<const double> weights)
+    {
+        return Blend<double>(transforms, weights);
+    }
+
+
+    inline void Blend(std::span<const DualQuaternion<float>> palette, std::span<const std::uint32_t> indices,
+                      std::span<const float> weights, std::span<DualQuaternion<float>> out)
+    {
+        Blend<float>(palette, indices, weights, out);
+    }
+
+
+    inline void Blend(std::span<const DualQuaternion<double>> palette, std::span<const std::uint32_t> indices,
+                      std::span<const double> weights, std::span<DualQuaternion<double>> out)
+    {
+        Blend<double>(palette, indices, weights, out);
+    }
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class DualQuaternion<float>;
+    extern template class DualQuaternion<double>;
+}
+
+#endif
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
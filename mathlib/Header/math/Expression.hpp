@@ -0,0 +1,352 @@
+#ifndef __EXPRESSION_H__
+#define __EXPRESSION_H__
+
+#include <cstddef>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "MathGeneric.hpp"
+
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "Matrix2.hpp"
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+
+// Opt-in expression templates for component-wise vector and matrix
+// arithmetic. Operands wrapped with expr::Lazy build a tree instead of
+// returning temporaries, and the whole chain is computed in one loop
+// when converted to a Vector / Matrix or passed to expr::Assign:
+//
+//     Vector3d velocity = expr::Lazy(a) * dt + expr::Lazy(b) * t - c;
+//
+// Only +, -, unary -, and * or / by a scalar are fused. Matrix products,
+// dot and cross products still go through the regular operators
+
+namespace math::expr
+{
+    namespace detail
+    {
+        // Number of values of the supported types.
+        // Vectors are N contiguous components, matrices N contiguous columns
+        template <typename TType>
+        struct Traits;
+
+        template <uint8_t TDimensions, CScalarType TValueType>
+        struct Traits<Vector<TDimensions, TValueType>>
+        {
+            static constexpr std::size_t    Size = TDimensions;
+        };
+
+        template <uint8_t TDimensions, CScalarType TValueType>
+        struct Traits<Matrix<TDimensions, TValueType>>
+        {
+            static constexpr std::size_t    Size = static_cast<std::size_t>(TDimensions) * TDimensions;
+        };
+
+        template <typename TType>
+        concept CStorage = requires { Traits<TType>::Size; };
+    }
+
+    // Every node exposes its result type, its number of values and
+    // read access to value index of the result
+    template <typename TType>
+    concept CExpression = requires
+    {
+        typename TType::TResultType;
+        typename TType::TValueType;
+        TType::IsExpression;
+    };
+
+    // Compute an expression in one pass
+    template <CExpression TExpression>
+    typename TExpression::TResultType   Evaluate(const TExpression& expression);
+
+    // Compute an expression in one pass into an existing object.
+    // destination may be one of the operands
+    template <CExpression TExpression>
+    void            Assign(typename TExpression::TResultType& destination, const TExpression& expression);
+
+
+    // Leaf node: reference to an existing vector or matrix
+    template <typename TResult, typename TValue>
+    class Terminal
+    {
+    public:
+
+        using TResultType = TResult;
+        using TValueType = TValue;
+
+        static constexpr bool           IsExpression = true;
+        static constexpr std::size_t    Size = detail::Traits<TResult>::Size;
+
+        explicit                Terminal(const TResult& object) noexcept
+            : m_values(reinterpret_cast<const TValue*>(&object))
+        {
+            static_assert(sizeof(TResult) == Size * sizeof(TValue), "Expression operands must be tightly packed");
+        }
+
+        TValueType              operator[](std::size_t index)   const noexcept { return m_values[index]; }
+
+        operator TResultType(void)                               const { return Evaluate(*this); }
+
+    private:
+
+        const TValue*           m_values;
+    };
+
+
+    // lhs (+ or -) rhs
+    template <CExpression TLhs, CExpression TRhs, bool TSubtract>
+    class Sum
+    {
+    public:
+
+        using TResultType = typename TLhs::TResultType;
+        using TValueType = typename TLhs::TValueType;
+
+        static constexpr bool           IsExpression = true;
+        static constexpr std::size_t    Size = TLhs::Size;
+
+                                Sum(const TLhs& lhs, const TRhs& rhs) noexcept
+            : m_lhs(lhs), m_rhs(rhs)
+        {
+        }
+
+        TValueType              operator[](std::size_t index)   const noexcept
+        {
+            if constexpr (TSubtract)
+                return m_lhs[index] - m_rhs[index];
+
+            else
+                return m_lhs[index] + m_rhs[index];
+        }
+
+        operator TResultType(void)                               const { return Evaluate(*this); }
+
+    private:
+
+        TLhs                    m_lhs;
+        TRhs                    m_rhs;
+    };
+
+
+    // operand * factor (division is a multiplication by the inverse
+    // for floating point types)
+    template <CExpression TOperand>
+    class Scale
+    {
+    public:
+
+        using TResultType = typename TOperand::TResultType;
+        using TValueType = typename TOperand::TValueType;
+
+        static constexpr bool           IsExpression = true;
+        static constexpr std::size_t    Size = TOperand::Size;
+
+                                Scale(const TOperand& operand, TValueType factor) noexcept
+            : m_operand(operand), m_factor(factor)
+        {
+        }
+
+        TValueType              operator[](std::size_t index)   const noexcept { return m_operand[index] * m_factor; }
+
+        operator TResultType(void)                               const { return Evaluate(*this); }
+
+    private:
+
+        TOperand                m_operand;
+        TValueType              m_factor;
+    };
+
+
+    // operand / divisor, kept for integral types
+    template <CExpression TOperand>
+    class Divide
+    {
+    public:
+
+        using TResultType = typename TOperand::TResultType;
+        using TValueType = typename TOperand::TValueType;
+
+        static constexpr bool           IsExpression = true;
+        static constexpr std::size_t    Size = TOperand::Size;
+
+                                Divide(const TOperand& operand, TValueType divisor) noexcept
+            : m_operand(operand), m_divisor(divisor)
+        {
+        }
+
+        TValueType              operator[](std::size_t index)   const noexcept { return m_operand[index] / m_divisor; }
+
+        operator TResultType(void)                               const { return Evaluate(*this); }
+
+    private:
+
+        TOperand                m_operand;
+        TValueType              m_divisor;
+    };
+
+
+    template <CExpression TOperand>
+    class Negate
+    {
+    public:
+
+        using TResultType = typename TOperand::TResultType;
+        using TValueType = typename TOperand::TValueType;
+
+        static constexpr bool           IsExpression = true;
+        static constexpr std::size_t    Size = TOperand::Size;
+
+        explicit                Negate(const TOperand& operand) noexcept
+            : m_operand(operand)
+        {
+        }
+
+        TValueType              operator[](std::size_t index)   const noexcept { return -m_operand[index]; }
+
+        operator TResultType(void)                               const { return Evaluate(*this); }
+
+    private:
+
+        TOperand                m_operand;
+    };
+
+
+    // Start an expression from a vector or matrix. The expression keeps a
+    // reference, so the operand must outlive it
+    template <uint8_t TDimensions, CScalarType TValueType>
+    Terminal<Vector<TDimensions, TValueType>, TValueType>   Lazy(const Vector<TDimensions, TValueType>& vector) noexcept;
+
+    template <uint8_t TDimensions, CScalarType TValueType>
+    Terminal<Matrix<TDimensions, TValueType>, TValueType>   Lazy(const Matrix<TDimensions, TValueType>& matrix) noexcept;
+
+    template <uint8_t TDimensions, CScalarType TValueType>
+    void            Lazy(const Vector<TDimensions, TValueType>&&) = delete;
+
+    template <uint8_t TDimensions, CScalarType TValueType>
+    void            Lazy(const Matrix<TDimensions, TValueType>&&) = delete;
+
+
+    namespace detail
+    {
+        // Wrap plain vectors and matrices so they can be mixed with expressions
+        template <CExpression TOperand>
+        inline const TOperand&  AsExpression(const TOperand& operand) noexcept
+        {
+            return operand;
+        }
+
+        template <typename TOperand> requires CStorage<TOperand>
+        inline auto             AsExpression(const TOperand& operand) noexcept
+        {
+            return Lazy(operand);
+        }
+
+        template <typename TOperand>
+        using TNode = std::remove_cvref_t<decltype(AsExpression(std::declval<const TOperand&>()))>;
+
+        // At least one side is already an expression and both have the same result
+        template <typename TLhs, typename TRhs>
+        concept COperands = (CExpression<TLhs> || CExpression<TRhs>) &&
+                            (CExpression<TLhs> || CStorage<TLhs>) && (CExpression<TRhs> || CStorage<TRhs>) &&
+                            std::same_as<typename TNode<TLhs>::TResultType, typename TNode<TRhs>::TResultType>;
+    }
+
+
+    template <typename TLhs, typename TRhs> requires detail::COperands<TLhs, TRhs>
+    inline Sum<detail::TNode<TLhs>, detail::TNode<TRhs>, false>     operator+(const TLhs& lhs, const TRhs& rhs) noexcept
+    {
+        return { detail::AsExpression(lhs), detail::AsExpression(rhs) };
+    }
+
+    template <typename TLhs, typename TRhs> requires detail::COperands<TLhs, TRhs>
+    inline Sum<detail::TNode<TLhs>, detail::TNode<TRhs>, true>      operator-(const TLhs& lhs, const TRhs& rhs) noexcept
+    {
+        return { detail::AsExpression(lhs), detail::AsExpression(rhs) };
+    }
+
+    template <CExpression TOperand>
+    inline Scale<TOperand>      operator*(const TOperand& operand, typename TOperand::TValueType factor) noexcept
+    {
+        return { operand, factor };
+    }
+
+    template <CExpression TOperand>
+    inline Scale<TOperand>      operator*(typename TOperand::TValueType factor, const TOperand& operand) noexcept
+    {
+        return { operand, factor };
+    }
+
+    template <CExpression TOperand>
+    inline auto                 operator/(const TOperand& operand, typename TOperand::TValueType divisor) noexcept
+    {
+        using TValueType = typename TOperand::TValueType;
+
+        if constexpr (std::is_floating_point_v<TValueType>)
+            return Scale<TOperand>(operand, static_cast<TValueType>(1) / divisor);
+
+        else
+            return Divide<TOperand>(operand, divisor);
+    }
+
+    template <CExpression TOperand>
+    inline Negate<TOperand>     operator-(const TOperand& operand) noexcept
+    {
+        return Negate<TOperand>(operand);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> inline
+    Terminal<Vector<TDimensions, TValueType>, TValueType> Lazy(const Vector<TDimensions, TValueType>& vector) noexcept
+    {
+        return Terminal<Vector<TDimensions, TValueType>, TValueType>(vector);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> inline
+    Terminal<Matrix<TDimensions, TValueType>, TValueType> Lazy(const Matrix<TDimensions, TValueType>& matrix) noexcept
+    {
+        return Terminal<Matrix<TDimensions, TValueType>, TValueType>(matrix);
+    }
+
+
+    template <CExpression TExpression> inline
+    void Assign(typename TExpression::TResultType& destination, const TExpression& expression)
+    {
+        using TValueType = typename TExpression::TValueType;
+        using TResultType = typename TExpression::TResultType;
+
+        static_assert(sizeof(TResultType) == TExpression::Size * sizeof(TValueType),
+                      "Expression results must be tightly packed");
+
+        TValueType*     values = reinterpret_cast<TValueType*>(&destination);
+
+        // Each value only depends on the operands' values at the same
+        // index, so destination can also be read by the expression.
+        // Unrolled at compile time, the sizes are at most 16
+        [&]<std::size_t... TIndices>(std::index_sequence<TIndices...>)
+        {
+            ((values[TIndices] = expression[TIndices]), ...);
+        }
+        (std::make_index_sequence<TExpression::Size>{});
+    }
+
+
+    template <CExpression TExpression> inline
+    typename TExpression::TResultType Evaluate(const TExpression& expression)
+    {
+        typename TExpression::TResultType  result;
+
+        Assign(result, expression);
+        return result;
+    }
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
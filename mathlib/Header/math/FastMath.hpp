@@ -0,0 +1,118 @@
+#ifndef __FAST_MATH_H__
+#define __FAST_MATH_H__
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "MathGeneric.hpp"
+#include "Simd.hpp"
+
+// Opt-in approximations trading accuracy for speed.
+// Nothing in this namespace checks for zero or negative input
+
+namespace math::fast
+{
+    // Number of Newton-Raphson steps applied to the reciprocal square root
+    // estimate. Max relative error with SSE (without SSE):
+    // LOW 3.3e-4 (1.8e-3), MEDIUM 2.5e-7 (4.7e-6), HIGH float rounding.
+    // Double and long double: MEDIUM 1.6e-7 (4.6e-6), HIGH 3.7e-14 (3.2e-11)
+    enum class EPrecision
+    {
+        LOW = 0,
+        MEDIUM = 1,
+        HIGH = 2
+    };
+
+    // Approximate 1 / sqrt(value) for a strictly positive value.
+    // Double and long double refine a float estimate,
+    // so value must be within the float range
+    template <EPrecision TPrecision = EPrecision::MEDIUM, CFloatingType TValueType> inline
+    TValueType      InverseSquareRoot(TValueType value) noexcept;
+
+    // Batch version, out[i] = 1 / sqrt(values[i]). out may alias values.
+    // The float and double overloads take spans or containers directly
+    template <EPrecision TPrecision = EPrecision::MEDIUM, CFloatingType TValueType> inline
+    void            InverseSquareRoot(std::type_identity_t<std::span<const TValueType>> values,
+                                      std::type_identity_t<std::span<TValueType>> out);
+
+    template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+    void            InverseSquareRoot(std::span<const float> values, std::span<float> out);
+
+    template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+    void            InverseSquareRoot(std::span<const double> values, std::span<double> out);
+
+
+    // Low precision 1 / sqrt(value), about 12 correct bits
+    inline float    InverseSquareRootEstimate(float value) noexcept
+    {
+#ifdef MTH_SIMD_SSE
+        return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+#else
+        // Halve and negate the exponent through the integer representation,
+        // then refine once to get close to the rsqrtss accuracy
+        const float     estimate = std::bit_cast<float>(0x5f375a86u - (std::bit_cast<uint32_t>(value) >> 1));
+
+        return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#endif
+    }
+
+
+    template <EPrecision TPrecision, CFloatingType TValueType> inline
+    TValueType InverseSquareRoot(TValueType value) noexcept
+    {
+        constexpr TValueType    half = static_cast<TValueType>(0.5);
+        constexpr TValueType    threeHalves = static_cast<TValueType>(1.5);
+
+        TValueType      estimate = static_cast<TValueType>(InverseSquareRootEstimate(static_cast<float>(value)));
+        TValueType      halfValue = value * half;
+
+        for (int step = 0; step < static_cast<int>(TPrecision); ++step)
+            estimate *= threeHalves - halfValue * estimate * estimate;
+
+        return estimate;
+    }
+
+
+    template <EPrecision TPrecision, CFloatingType TValueType> inline
+    void InverseSquareRoot(std::type_identity_t<std::span<const TValueType>> values,
+                           std::type_identity_t<std::span<TValueType>> out)
+    {
+        if (out.size() != values.size())
+            throw std::logic_error("Output span size does not match input size");
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            simd::InverseSquareRoot(values.data(), out.data(), values.size(),
+                                    static_cast<unsigned int>(TPrecision));
+            return;
+        }
+#endif
+
+        for (std::size_t index = 0; index < values.size(); ++index)
+            out[index] = InverseSquareRoot<TPrecision>(values[index]);
+    }
+
+
+    template <EPrecision TPrecision> inline
+    void InverseSquareRoot(std::span<const float> values, std::span<float> out)
+    {
+        InverseSquareRoot<TPrecision, float>(values, out);
+    }
+
+
+    template <EPrecision TPrecision> inline
+    void InverseSquareRoot(std::span<const double> values, std::span<double> out)
+    {
+        InverseSquareRoot<TPrecision, double>(values, out);
+    }
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
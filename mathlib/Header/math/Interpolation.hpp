@@ -10,12 +10,12 @@ namespace math
 {
 	// Linear interpolation between a start, an end and a ratio
 	// between 0 and 1
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType		Lerp(TValueType low, TValueType high, TValueType ratio) noexcept;
 
 
 	// Get the Lerp ratio from a lerp'd value and its bounds
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType		InverseLerp(TValueType val, TValueType low, TValueType high) noexcept;
 
 
@@ -26,7 +26,7 @@ namespace math
 
 // ---- Implementation ----
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Lerp(TValueType low, TValueType high, TValueType ratio) noexcept
 	{
 		if (ratio == 0.f)
@@ -40,7 +40,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType InverseLerp(TValueType val, TValueType low, TValueType high) noexcept
 	{
 		// Reverse lerp formula to get ratio (commonly referred to as t)
@@ -0,0 +1,916 @@
+#ifndef __INTERSECTION_H__
+#define __INTERSECTION_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "MathGeneric.hpp"
+#include "Arithmetic.hpp"
+#include "Simd.hpp"
+
+#include "Vector3.hpp"
+#include "Vector3Stream.hpp"
+#include "AABB.hpp"
+
+namespace math
+{
+    // Rays are origin + t * direction. The direction does not have to be
+    // normalized (but cannot be zero), distances are expressed in multiples
+    // of it. A ray hits for t in [0, maxDistance), surfaces are two-sided
+
+    // Moller-Trumbore ray / triangle test. On hit, u and v are the
+    // barycentric weights of b and c
+    template <CFloatingType TValueType> inline
+    bool            IntersectRayTriangle
+    (
+        const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+        const Vector3<TValueType>& a, const Vector3<TValueType>& b, const Vector3<TValueType>& c,
+        TValueType maxDistance, TValueType& distance, TValueType& u, TValueType& v
+    );
+
+    // Closest hit with a sphere, 0 if the origin is inside it
+    template <CFloatingType TValueType> inline
+    bool            IntersectRaySphere
+    (
+        const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+        const Vector3<TValueType>& center, TValueType radius,
+        TValueType maxDistance, TValueType& distance
+    );
+
+    // Plane of all points p such that normal . p = offset
+    // (the normal does not have to be normalized)
+    template <CFloatingType TValueType> inline
+    bool            IntersectRayPlane
+    (
+        const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+        const Vector3<TValueType>& normal, TValueType offset,
+        TValueType maxDistance, TValueType& distance
+    );
+
+    // Slab test, same rules as AABB::IntersectRay: the distance is
+    // 0 if the origin is inside the box
+    template <CFloatingType TValueType> inline
+    bool            IntersectRayBox
+    (
+        const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+        const AABB3<TValueType>& box, TValueType maxDistance, TValueType& distance
+    );
+
+    // Touching spheres overlap
+    template <CFloatingType TValueType> inline
+    bool            OverlapSpheres
+    (
+        const Vector3<TValueType>& firstCenter, TValueType firstRadius,
+        const Vector3<TValueType>& secondCenter, TValueType secondRadius
+    );
+
+    // Segment from start to end against triangle abc. On hit, fraction in
+    // [0, 1] is where the segment crosses it, u and v are the barycentric
+    // weights of b and c
+    template <CFloatingType TValueType> inline
+    bool            IntersectSegmentTriangle
+    (
+        const Vector3<TValueType>& start, const Vector3<TValueType>& end,
+        const Vector3<TValueType>& a, const Vector3<TValueType>& b, const Vector3<TValueType>& c,
+        TValueType& fraction, TValueType& u, TValueType& v
+    );
+
+
+    // Batch versions: one shape against a stream of rays (or segments,
+    // spheres), same rules as above. Rays are processed in packets of one
+    // SIMD register: 4 floats or 2 doubles with SSE, 8 floats or 4 doubles
+    // with AVX.
+    // distances[i] holds the max distance of ray i and is replaced by the
+    // hit distance when it hits, so testing several shapes in a row keeps
+    // the closest hit of each ray. All return the number of rays that hit
+
+    template <CFloatingType TValueType> inline
+    std::size_t     IntersectRayTriangle
+    (
+        const Vector3Stream<TValueType>& origins, const Vector3Stream<TValueType>& directions,
+        const Vector3<TValueType>& a, const Vector3<TValueType>& b, const Vector3<TValueType>& c,
+        std::type_identity_t<std::span<TValueType>> distances
+    );
+
+    template <CFloatingType TValueType> inline
+    std::size_t     IntersectRaySphere
+    (
+        const Vector3Stream<TValueType>& origins, const Vector3Stream<TValueType>& directions,
+        const Vector3<TValueType>& center, TValueType radius,
+        std::type_identity_t<std::span<TValueType>> distances
+    );
+
+    template <CFloatingType TValueType> inline
+    std::size_t     IntersectRayPlane
+    (
+        const Vector3Stream<TValueType>& origins, const Vector3Stream<TValueType>& directions,
+        const Vector3<TValueType>& normal, TValueType offset,
+        std::type_identity_t<std::span<TValueType>> distances
+    );
+
+    template <CFloatingType TValueType> inline
+    std::size_t     IntersectRayBox
+    (
+        const Vector3Stream<TValueType>& origins, const Vector3Stream<TValueType>& directions,
+        const AABB3<TValueType>& box, std::type_identity_t<std::span<TValueType>> distances
+    );
+
+    // fractions[i] holds the largest fraction accepted for segment i (1 to
+    // test all of it, included) and is replaced by the hit fraction
+    template <CFloatingType TValueType> inline
+    std::size_t     IntersectSegmentTriangle
+    (
+        const Vector3Stream<TValueType>& starts, const Vector3Stream<TValueType>& ends,
+        const Vector3<TValueType>& a, const Vector3<TValueType>& b, const Vector3<TValueType>& c,
+        std::type_identity_t<std::span<TValueType>> fractions
+    );
+
+    // out[i] = sphere overlaps the sphere of center centers[i] and radius radii[i]
+    template <CFloatingType TValueType> inline
+    std::size_t     OverlapSpheres
+    (
+        const Vector3Stream<TValueType>& centers, std::type_identity_t<std::span<const TValueType>> radii,
+        const Vector3<TValueType>& center, TValueType radius, std::span<uint8_t> out
+    );
+
+
+
+
+// ---- Implementation ----
+
+    namespace detail
+    {
+        // Register wrappers for the batch kernels. They all expose the same
+        // static operations so each kernel is written once, and runs on one
+        // value at a time for tails, long double and builds without SIMD.
+        // Masks compare like math::Min / Max: NaN lanes are false
+        template <CFloatingType TValueType>
+        struct ScalarPacket
+        {
+            using TRegister = TValueType;
+            using TMask = bool;
+
+            static constexpr std::size_t    Width = 1;
+
+            static TRegister    Load(const TValueType* values)                  { return *values; }
+            static void         Store(TValueType* values, TRegister value)      { *values = value; }
+            static TRegister    Set(TValueType value)                           { return value; }
+
+            static TRegister    Add(TRegister lhs, TRegister rhs)               { return lhs + rhs; }
+            static TRegister    Sub(TRegister lhs, TRegister rhs)               { return lhs - rhs; }
+            static TRegister    Mul(TRegister lhs, TRegister rhs)               { return lhs * rhs; }
+            static TRegister    Div(TRegister lhs, TRegister rhs)               { return lhs / rhs; }
+            static TRegister    Min(TRegister lhs, TRegister rhs)               { return math::Min(lhs, rhs); }
+            static TRegister    Max(TRegister lhs, TRegister rhs)               { return math::Max(lhs, rhs); }
+            static TRegister    Sqrt(TRegister value)                           { return SquareRoot(value); }
+
+            static TMask        Less(TRegister lhs, TRegister rhs)              { return lhs < rhs; }
+            static TMask        LessEqual(TRegister lhs, TRegister rhs)         { return lhs <= rhs; }
+            static TMask        Unordered(TRegister lhs, TRegister rhs)         { return lhs != lhs || rhs != rhs; }
+            static TMask        And(TMask lhs, TMask rhs)                       { return lhs & rhs; }
+            static TMask        Or(TMask lhs, TMask rhs)                        { return lhs | rhs; }
+
+            // mask ? lhs : rhs
+            static TRegister    Select(TMask mask, TRegister lhs, TRegister rhs) { return mask ? lhs : rhs; }
+
+            // One bit per lane
+            static uint32_t     Bits(TMask mask)                                { return mask; }
+        };
+
+#ifdef MTH_SIMD_SSE
+
+        struct FloatPacket4
+        {
+            using TRegister = __m128;
+            using TMask = __m128;
+
+            static constexpr std::size_t    Width = 4;
+
+            static TRegister    Load(const float* values)                       { return _mm_loadu_ps(values); }
+            static void         Store(float* values, TRegister value)           { _mm_storeu_ps(values, value); }
+            static TRegister    Set(float value)                                { return _mm_set1_ps(value); }
+
+            static TRegister    Add(TRegister lhs, TRegister rhs)               { return _mm_add_ps(lhs, rhs); }
+            static TRegister    Sub(TRegister lhs, TRegister rhs)               { return _mm_sub_ps(lhs, rhs); }
+            static TRegister    Mul(TRegister lhs, TRegister rhs)               { return _mm_mul_ps(lhs, rhs); }
+            static TRegister    Div(TRegister lhs, TRegister rhs)               { return _mm_div_ps(lhs, rhs); }
+            static TRegister    Min(TRegister lhs, TRegister rhs)               { return _mm_min_ps(lhs, rhs); }
+            static TRegister    Max(TRegister lhs, TRegister rhs)               { return _mm_max_ps(lhs, rhs); }
+            static TRegister    Sqrt(TRegister value)                           { return _mm_sqrt_ps(value); }
+
+            static TMask        Less(TRegister lhs, TRegister rhs)              { return _mm_cmplt_ps(lhs, rhs); }
+            static TMask        LessEqual(TRegister lhs, TRegister rhs)         { return _mm_cmple_ps(lhs, rhs); }
+            static TMask        Unordered(TRegister lhs, TRegister rhs)         { return _mm_cmpunord_ps(lhs, rhs); }
+            static TMask        And(TMask lhs, TMask rhs)                       { return _mm_and_ps(lhs, rhs); }
+            static TMask        Or(TMask lhs, TMask rhs)                        { return _mm_or_ps(lhs, rhs); }
+
+            static TRegister    Select(TMask mask, TRegister lhs, TRegister rhs)
+            {
+                return _mm_or_ps(_mm_and_ps(mask, lhs), _mm_andnot_ps(mask, rhs));
+            }
+
+            static uint32_t     Bits(TMask mask)                                { return _mm_movemask_ps(mask); }
+        };
+
+
+        struct DoublePacket2
+        {
+            using TRegister = __m128d;
+            using TMask = __m128d;
+
+            static constexpr std::size_t    Width = 2;
+
+            static TRegister    Load(const double* values)                      { return _mm_loadu_pd(values); }
+            static void         Store(double* values, TRegister value)          { _mm_storeu_pd(values, value); }
+            static TRegister    Set(double value)                               { return _mm_set1_pd(value); }
+
+            static TRegister    Add(TRegister lhs, TRegister rhs)               { return _mm_add_pd(lhs, rhs); }
+            static TRegister    Sub(TRegister lhs, TRegister rhs)               { return _mm_sub_pd(lhs, rhs); }
+            static TRegister    Mul(TRegister lhs, TRegister rhs)               { return _mm_mul_pd(lhs, rhs); }
+            static TRegister    Div(TRegister lhs, TRegister rhs)               { return _mm_div_pd(lhs, rhs); }
+            static TRegister    Min(TRegister lhs, TRegister rhs)               { return _mm_min_pd(lhs, rhs); }
+            static TRegister    Max(TRegister lhs, TRegister rhs)               { return _mm_max_pd(lhs, rhs); }
+            static TRegister    Sqrt(TRegister value)                           { return _mm_sqrt_pd(value); }
+
+            static TMask        Less(TRegister lhs, TRegister rhs)              { return _mm_cmplt_pd(lhs, rhs); }
+            static TMask        LessEqual(TRegister lhs, TRegister rhs)         { return _mm_cmple_pd(lhs, rhs); }
+            static TMask        Unordered(TRegister lhs, TRegister rhs)         { return _mm_cmpunord_pd(lhs, rhs); }
+            static TMask        And(TMask lhs, TMask rhs)                       { return _mm_and_pd(lhs, rhs); }
+            static TMask        Or(TMask lhs, TMask rhs)                        { return _mm_or_pd(lhs, rhs); }
+
+            static TRegister    Select(TMask mask, TRegister lhs, TRegister rhs)
+            {
+                return _mm_or_pd(_mm_and_pd(mask, lhs), _mm_andnot_pd(mask, rhs));
+            }
+
+            static uint32_t     Bits(TMask mask)                                { return _mm_movemask_pd(mask); }
+        };
+
+#endif
+
+#ifdef MTH_SIMD_AVX
+
+        struct FloatPacket8
+        {
+            using TRegister = __m256;
+            using TMask = __m256;
+
+            static constexpr std::size_t    Width = 8;
+
+            static TRegister    Load(const float* values)                       { return _mm256_loadu_ps(values); }
+            static void         Store(float* values, TRegister value)           { _mm256_storeu_ps(values, value); }
+            static TRegister    Set(float value)                                { return _mm256_set1_ps(value); }
+
+            static TRegister    Add(TRegister lhs, TRegister rhs)               { return _mm256_add_ps(lhs, rhs); }
+            static TRegister    Sub(TRegister lhs, TRegister rhs)               { return _mm256_sub_ps(lhs, rhs); }
+            static TRegister    Mul(TRegister lhs, TRegister rhs)               { return _mm256_mul_ps(lhs, rhs); }
+            static TRegister    Div(TRegister lhs, TRegister rhs)               { return _mm256_div_ps(lhs, rhs); }
+            static TRegister    Min(TRegister lhs, TRegister rhs)               { return _mm256_min_ps(lhs, rhs); }
+            static TRegister    Max(TRegister lhs, TRegister rhs)               { return _mm256_max_ps(lhs, rhs); }
+            static TRegister    Sqrt(TRegister value)                           { return _mm256_sqrt_ps(value); }
+
+            static TMask        Less(TRegister lhs, TRegister rhs)      { return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ); }
+            static TMask        LessEqual(TRegister lhs, TRegister rhs) { return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ); }
+            static TMask        Unordered(TRegister lhs, TRegister rhs) { return _mm256_cmp_ps(lhs, rhs, _CMP_UNORD_Q); }
+            static TMask        And(TMask lhs, TMask rhs)                       { return _mm256_and_ps(lhs, rhs); }
+            static TMask        Or(TMask lhs, TMask rhs)                        { return _mm256_or_ps(lhs, rhs); }
+
+            static TRegister    Select(TMask mask, TRegister lhs, TRegister rhs)
+            {
+                return _mm256_blendv_ps(rhs, lhs, mask);
+            }
+
+            static uint32_t     Bits(TMask mask)                                { return _mm256_movemask_ps(mask); }
+        };
+
+
+        struct DoublePacket4
+        {
+            using TRegister = __m256d;
+            using TMask = __m256d;
+
+            static constexpr std::size_t    Width = 4;
+
+            static TRegister    Load(const double* values)                      { return _mm256_loadu_pd(values); }
+            static void         Store(double* values, TRegister value)          { _mm256_storeu_pd(values, value); }
+            static TRegister    Set(double value)                               { return _mm256_set1_pd(value); }
+
+            static TRegister    Add(TRegister lhs, TRegister rhs)               { return _mm256_add_pd(lhs, rhs); }
+            static TRegister    Sub(TRegister lhs, TRegister rhs)               { return _mm256_sub_pd(lhs, rhs); }
+            static TRegister    Mul(TRegister lhs, TRegister rhs)               { return _mm256_mul_pd(lhs, rhs); }
+            static TRegister    Div(TRegister lhs, TRegister rhs)               { return _mm256_div_pd(lhs, rhs); }
+            static TRegister    Min(TRegister lhs, TRegister rhs)               { return _mm256_min_pd(lhs, rhs); }
+            static TRegister    Max(TRegister lhs, TRegister rhs)               { return _mm256_max_pd(lhs, rhs); }
+            static TRegister    Sqrt(TRegister value)                           { return _mm256_sqrt_pd(value); }
+
+            static TMask        Less(TRegister lhs, TRegister rhs)      { return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ); }
+            static TMask        LessEqual(TRegister lhs, TRegister rhs) { return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ); }
+            static TMask        Unordered(TRegister lhs, TRegister rhs) { return _mm256_cmp_pd(lhs, rhs, _CMP_UNORD_Q); }
+            static TMask        And(TMask lhs, TMask rhs)                       { return _mm256_and_pd(lhs, rhs); }
+            static TMask        Or(TMask lhs, TMask rhs)                        { return _mm256_or_pd(lhs, rhs); }
+
+            static TRegister    Select(TMask mask, TRegister lhs, TRegister rhs)
+            {
+                return _mm256_blendv_pd(rhs, lhs, mask);
+            }
+
+            static uint32_t     Bits(TMask mask)                                { return _mm256_movemask_pd(mask); }
+        };
+
+#endif
+
+        // Widest packet available for a value type
+        template <CFloatingType TValueType>
+        struct WidestPacket
+        {
+            using Type = ScalarPacket<TValueType>;
+        };
+
+#if defined(MTH_SIMD_AVX)
+
+        template <>
+        struct WidestPacket<float>
+        {
+            using Type = FloatPacket8;
+        };
+
+        template <>
+        struct WidestPacket<double>
+        {
+            using Type = DoublePacket4;
+        };
+
+#elif defined(MTH_SIMD_SSE)
+
+        template <>
+        struct WidestPacket<float>
+        {
+            using Type = FloatPacket4;
+        };
+
+        template <>
+        struct WidestPacket<double>
+        {
+            using Type = DoublePacket2;
+        };
+
+#endif
+
+        // Call kernel(packet, index) on full packets, then one value at a
+        // time on the rest, and sum the hit counts it returns.
+        // Kernels capture by copy (lane pointers, shape values) and are
+        // copied to a local, so the compiler knows output stores cannot
+        // change them and keeps them in registers
+        template <CFloatingType TValueType, typename TKernel> inline
+        std::size_t     RunPackets(std::size_t count, const TKernel& kernelValues)
+        {
+            using TPacket = typename WidestPacket<TValueType>::Type;
+
+            TKernel         kernel = kernelValues;
+            std::size_t     hits = 0;
+            std::size_t     index = 0;
+
+            if constexpr (TPacket::Width > 1)
+            {
+                for (; index + TPacket::Width <= count; index += TPacket::Width)
+                    hits += kernel(TPacket(), index);
+            }
+
+            for (; index < count; ++index)
+                hits += kernel(ScalarPacket<TValueType>(), index);
+
+            return hits;
+        }
+
+
+        // Lane pointers of a Vector3Stream
+        template <CFloatingType TValueType>
+        struct StreamLanes
+        {
+            const TValueType*   m_x;
+            const TValueType*   m_y;
+            const TValueType*   m_z;
+        };
+
+
+        template <CFloatingType TValueType> inline
+        StreamLanes<TValueType>     Lanes(const Vector3Stream<TValueType>& vectors)
+        {
+            return { vectors.X(), vectors.Y(), vectors.Z() };
+        }
+
+
+        // Three registers holding one component each, for the kernels
+        template <typename TPacket>
+        struct PacketVector3
+        {
+            typename TPacket::TRegister     m_x;
+            typename TPacket::TRegister     m_y;
+            typename TPacket::TRegister     m_z;
+        };
+
+
+        template <typename TPacket, CFloatingType TValueType> inline
+        PacketVector3<TPacket>  LoadPacket(const StreamLanes<TValueType>& lanes, std::size_t index)
+        {
+            return { TPacket::Load(lanes.m_x + index), TPacket::Load(lanes.m_y + index),
+                     TPacket::Load(lanes.m_z + index) };
+        }
+
+
+        template <typename TPacket, CFloatingType TValueType> inline
+        PacketVector3<TPacket>  SetPacket(const Vector3<TValueType>& vector)
+        {
+            return { TPacket::Set(vector.GetX()), TPacket::Set(vector.GetY()), TPacket::Set(vector.GetZ()) };
+        }
+
+
+        template <typename TPacket> inline
+        PacketVector3<TPacket>  SubPacket(const PacketVector3<TPacket>& lhs, const PacketVector3<TPacket>& rhs)
+        {
+            return { TPacket::Sub(lhs.m_x, rhs.m_x), TPacket::Sub(lhs.m_y, rhs.m_y), TPacket::Sub(lhs.m_z, rhs.m_z) };
+        }
+
+
+        template <typename TPacket> inline
+        typename TPacket::TRegister DotPacket(const PacketVector3<TPacket>& lhs, const PacketVector3<TPacket>& rhs)
+        {
+            return TPacket::Add(TPacket::Add(TPacket::Mul(lhs.m_x, rhs.m_x), TPacket::Mul(lhs.m_y, rhs.m_y)),
+                                TPacket::Mul(lhs.m_z, rhs.m_z));
+        }
+
+
+        template <typename TPacket> inline
+        PacketVector3<TPacket>  CrossPacket(const PacketVector3<TPacket>& lhs, const PacketVector3<TPacket>& rhs)
+        {
+            return
+            {
+                TPacket::Sub(TPacket::Mul(lhs.m_y, rhs.m_z), TPacket::Mul(lhs.m_z, rhs.m_y)),
+                TPacket::Sub(TPacket::Mul(lhs.m_z, rhs.m_x), TPacket::Mul(lhs.m_x, rhs.m_z)),
+                TPacket::Sub(TPacket::Mul(lhs.m_x, rhs.m_y), TPacket::Mul(lhs.m_y, rhs.m_x))
+            };
+        }
+
+
+        // Moller-Trumbore on a packet: get the mask of lanes whose line
+        // crosses the triangle, and the distance along each line.
+        // A zero determinant makes u and v infinite or NaN, which fails
+        // the barycentric tests without a branch
+        template <typename TPacket> inline
+        typename TPacket::TMask     CrossTrianglePacket(const PacketVector3<TPacket>& origin,
+                                                        const PacketVector3<TPacket>& direction,
+                                                        const PacketVector3<TPacket>& a,
+                                                        const PacketVector3<TPacket>& edge1,
+                                                        const PacketVector3<TPacket>& edge2,
+                                                        typename TPacket::TRegister& distance)
+        {
+            using TRegister = typename TPacket::TRegister;
+
+            const TRegister                 zero = TPacket::Set(0);
+            const TRegister                 one = TPacket::Set(1);
+
+            const PacketVector3<TPacket>    normalCross = CrossPacket(direction, edge2);
+            const TRegister                 invDeterminant = TPacket::Div(one, DotPacket(edge1, normalCross));
+
+            const PacketVector3<TPacket>    toOrigin = SubPacket(origin, a);
+            const PacketVector3<TPacket>    originCross = CrossPacket(toOrigin, edge1);
+
+            const TRegister                 u = TPacket::Mul(DotPacket(toOrigin, normalCross), invDeterminant);
+            const TRegister                 v = TPacket::Mul(DotPacket(direction, originCross), invDeterminant);
+
+            distance = TPacket::Mul(DotPacket(edge2, originCross), invDeterminant);
+
+            return TPacket::And(TPacket::And(TPacket::LessEqual(zero, u), TPacket::LessEqual(zero, v)),
+                                TPacket::LessEqual(TPacket::Add(u, v), one));
+        }
+
+
+        // Number of set bits in a packet mask (8 lanes at most). Cheaper
+        // than std::popcount, which is a library call without POPCNT
+        inline std::size_t  CountLanes(uint32_t bits)
+        {
+            bits = bits - ((bits >> 1) & 0x55u);
+            bits = (bits & 0x33u) + ((bits >> 2) & 0x33u);
+
+            return static_cast<std::size_t>((bits + (bits >> 4)) & 0x0Fu);
+        }
+
+
+        // Write a packet's hit values to out and get the number of hits
+        template <typename TPacket, CFloatingType TValueType> inline
+        std::size_t     StoreHits(typename TPacket::TMask hit, typename TPacket::TRegister value,
+                                  typename TPacket::TRegister previous, TValueType* out)
+        {
+            TPacket::Store(out, TPacket::Select(hit, value, previous));
+            return CountLanes(TPacket::Bits(hit));
+        }
+
+
+        // Moller-Trumbore: does the line through origin along direction
+        // cross triangle abc ? On success, distance is where along the line
+        // (any sign) and u, v are the barycentric weights of b and c
+        template <CFloatingType TValueType> inline
+        bool            CrossTriangle(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                                      const Vector3<TValueType>& a, const Vector3<TValueType>& b,
+                                      const Vector3<TValueType>& c, TValueType& distance,
+                                      TValueType& u, TValueType& v)
+        {
+            const Vector3<TValueType>   edge1 = b - a;
+            const Vector3<TValueType>   edge2 = c - a;
+            const Vector3<TValueType>   normalCross = direction.Cross(edge2);
+            const TValueType            determinant = edge1.Dot(normalCross);
+
+            // Line parallel to the triangle's plane
+            if (determinant == static_cast<TValueType>(0))
+                return false;
+
+            const TValueType            invDeterminant = static_cast<TValueType>(1) / determinant;
+            const Vector3<TValueType>   toOrigin = origin - a;
+
+            u = toOrigin.Dot(normalCross) * invDeterminant;
+
+            if (u < static_cast<TValueType>(0) || u > static_cast<TValueType>(1))
+                return false;
+
+            const Vector3<TValueType>   originCross = toOrigin.Cross(edge1);
+
+            v = direction.Dot(originCross) * invDeterminant;
+
+            if (v < static_cast<TValueType>(0) || u + v > static_cast<TValueType>(1))
+                return false;
+
+            distance = edge2.Dot(originCross) * invDeterminant;
+            return true;
+        }
+
+
+        template <CFloatingType TValueType> inline
+        void            CheckRayBatch(const Vector3Stream<TValueType>& origins,
+                                      const Vector3Stream<TValueType>& directions, std::size_t outSize)
+        {
+            if (directions.Size() != origins.Size())
+                throw std::logic_error("Vector3Stream size mismatch");
+
+            if (outSize != origins.Size())
+                throw std::logic_error("Output span size does not match input");
+        }
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool IntersectRayTriangle(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                              const Vector3<TValueType>& a, const Vector3<TValueType>& b,
+                              const Vector3<TValueType>& c, TValueType maxDistance,
+                              TValueType& distance, TValueType& u, TValueType& v)
+    {
+        TValueType      hitDistance, hitU, hitV;
+
+        if (!detail::CrossTriangle(origin, direction, a, b, c, hitDistance, hitU, hitV) ||
+            hitDistance < static_cast<TValueType>(0) || !(hitDistance < maxDistance))
+            return false;
+
+        distance = hitDistance;
+        u = hitU;
+        v = hitV;
+
+        return true;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool IntersectRaySphere(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                            const Vector3<TValueType>& center, TValueType radius,
+                            TValueType maxDistance, TValueType& distance)
+    {
+        // Solve |toCenter + t * direction|^2 = radius^2, with b halved
+        const Vector3<TValueType>   fromCenter = origin - center;
+        const TValueType            a = direction.Dot(direction);
+        const TValueType            b = fromCenter.Dot(direction);
+        const TValueType            c = fromCenter.Dot(fromCenter) - radius * radius;
+
+        // Outside and going away
+        if (c > static_cast<TValueType>(0) && b > static_cast<TValueType>(0))
+            return false;
+
+        const TValueType            discriminant = b * b - a * c;
+
+        if (discriminant < static_cast<TValueType>(0))
+            return false;
+
+        // Negative (first root behind) when the origin is inside
+        const TValueType            hitDistance = math::Max((-b - SquareRoot(discriminant)) / a,
+                                                            static_cast<TValueType>(0));
+
+        if (!(hitDistance < maxDistance))
+            return false;
+
+        distance = hitDistance;
+        return true;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool IntersectRayPlane(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                           const Vector3<TValueType>& normal, TValueType offset,
+                           TValueType maxDistance, TValueType& distance)
+    {
+        // Parallel rays give an infinite or NaN distance, rejected below
+        const TValueType            hitDistance = (offset - normal.Dot(origin)) / normal.Dot(direction);
+
+        if (!(hitDistance >= static_cast<TValueType>(0) && hitDistance < maxDistance))
+            return false;
+
+        distance = hitDistance;
+        return true;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool IntersectRayBox(const Vector3<TValueType>& origin, const Vector3<TValueType>& direction,
+                         const AABB3<TValueType>& box, TValueType maxDistance, TValueType& distance)
+    {
+        const Vector3<TValueType>   inverseDirection(static_cast<TValueType>(1) / direction.GetX(),
+                                                     static_cast<TValueType>(1) / direction.GetY(),
+                                                     static_cast<TValueType>(1) / direction.GetZ());
+        TValueType                  entry;
+
+        // The slab test accepts an entry at maxDistance
+        if (!box.IntersectRay(origin, inverseDirection, static_cast<TValueType>(0), maxDistance, entry) ||
+            !(entry < maxDistance))
+            return false;
+
+        distance = entry;
+        return true;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool OverlapSpheres(const Vector3<TValueType>& firstCenter, TValueType firstRadius,
+                        const Vector3<TValueType>& secondCenter, TValueType secondRadius)
+    {
+        const Vector3<TValueType>   offset = secondCenter - firstCenter;
+        const TValueType            radiusSum = firstRadius + secondRadius;
+
+        return offset.Dot(offset) <= radiusSum * radiusSum;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool IntersectSegmentTriangle(const Vector3<TValueType>& start, const Vector3<TValueType>& end,
+                                  const Vector3<TValueType>& a, const Vector3<TValueType>& b,
+                                  const Vector3<TValueType>& c, TValueType& fraction,
+                                  TValueType& u, TValueType& v)
+    {
+        TValueType      hitFraction, hitU, hitV;
+
+        // Unlike rays, the end point is included
+        if (!detail::CrossTriangle(start, end - start, a, b, c, hitFraction, hitU, hitV) ||
+            hitFraction < static_cast<TValueType>(0) || hitFraction > static_cast<TValueType>(1))
+            return false;
+
+        fraction = hitFraction;
+        u = hitU;
+        v = hitV;
+
+        return true;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t IntersectRayTriangle(const Vector3Stream<TValueType>& origins,
+                                     const Vector3Stream<TValueType>& directions,
+                                     const Vector3<TValueType>& a, const Vector3<TValueType>& b,
+                                     const Vector3<TValueType>& c,
+                                     std::type_identity_t<std::span<TValueType>> distances)
+    {
+        detail::CheckRayBatch(origins, directions, distances.size());
+
+        const auto                  originLanes = detail::Lanes(origins);
+        const auto                  directionLanes = detail::Lanes(directions);
+        const Vector3<TValueType>   edge1 = b - a;
+        const Vector3<TValueType>   edge2 = c - a;
+
+        return detail::RunPackets<TValueType>(origins.Size(), [=]<typename TPacket>(TPacket, std::size_t index)
+        {
+            using TRegister = typename TPacket::TRegister;
+
+            const TRegister     maxDistance = TPacket::Load(distances.data() + index);
+            TRegister           distance;
+
+            const auto          crosses =
+                detail::CrossTrianglePacket<TPacket>(detail::LoadPacket<TPacket>(originLanes, index),
+                                                     detail::LoadPacket<TPacket>(directionLanes, index),
+                                                     detail::SetPacket<TPacket>(a),
+                                                     detail::SetPacket<TPacket>(edge1),
+                                                     detail::SetPacket<TPacket>(edge2), distance);
+
+            const auto          hit = TPacket::And(crosses,
+                                                   TPacket::And(TPacket::LessEqual(TPacket::Set(0), distance),
+                                                                TPacket::Less(distance, maxDistance)));
+
+            return detail::StoreHits<TPacket>(hit, distance, maxDistance, distances.data() + index);
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t IntersectRaySphere(const Vector3Stream<TValueType>& origins,
+                                   const Vector3Stream<TValueType>& directions,
+                                   const Vector3<TValueType>& center, TValueType radius,
+                                   std::type_identity_t<std::span<TValueType>> distances)
+    {
+        detail::CheckRayBatch(origins, directions, distances.size());
+
+        const auto      originLanes = detail::Lanes(origins);
+        const auto      directionLanes = detail::Lanes(directions);
+
+        return detail::RunPackets<TValueType>(origins.Size(), [=]<typename TPacket>(TPacket, std::size_t index)
+        {
+            using TRegister = typename TPacket::TRegister;
+
+            const TRegister                         zero = TPacket::Set(0);
+            const TRegister                         maxDistance = TPacket::Load(distances.data() + index);
+
+            const detail::PacketVector3<TPacket>    direction = detail::LoadPacket<TPacket>(directionLanes, index);
+            const detail::PacketVector3<TPacket>    fromCenter =
+                detail::SubPacket(detail::LoadPacket<TPacket>(originLanes, index), detail::SetPacket<TPacket>(center));
+
+            const TRegister     a = detail::DotPacket(direction, direction);
+            const TRegister     b = detail::DotPacket(fromCenter, direction);
+            const TRegister     c = TPacket::Sub(detail::DotPacket(fromCenter, fromCenter),
+                                                 TPacket::Set(radius * radius));
+
+            const TRegister     discriminant = TPacket::Sub(TPacket::Mul(b, b), TPacket::Mul(a, c));
+
+            // Square root of a negative discriminant is NaN, those lanes
+            // are masked out below. Max clamps inner origins to 0
+            const TRegister     distance = TPacket::Max(TPacket::Div(TPacket::Sub(TPacket::Sub(zero, b),
+                                                                                  TPacket::Sqrt(discriminant)), a),
+                                                        zero);
+
+            const auto          hit = TPacket::And(TPacket::And(TPacket::LessEqual(zero, discriminant),
+                                                                TPacket::Or(TPacket::LessEqual(c, zero),
+                                                                            TPacket::LessEqual(b, zero))),
+                                                   TPacket::Less(distance, maxDistance));
+
+            return detail::StoreHits<TPacket>(hit, distance, maxDistance, distances.data() + index);
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t IntersectRayPlane(const Vector3Stream<TValueType>& origins,
+                                  const Vector3Stream<TValueType>& directions,
+                                  const Vector3<TValueType>& normal, TValueType offset,
+                                  std::type_identity_t<std::span<TValueType>> distances)
+    {
+        detail::CheckRayBatch(origins, directions, distances.size());
+
+        const auto      originLanes = detail::Lanes(origins);
+        const auto      directionLanes = detail::Lanes(directions);
+
+        return detail::RunPackets<TValueType>(origins.Size(), [=]<typename TPacket>(TPacket, std::size_t index)
+        {
+            using TRegister = typename TPacket::TRegister;
+
+            const TRegister                         maxDistance = TPacket::Load(distances.data() + index);
+            const detail::PacketVector3<TPacket>    planeNormal = detail::SetPacket<TPacket>(normal);
+            const detail::PacketVector3<TPacket>    origin = detail::LoadPacket<TPacket>(originLanes, index);
+            const detail::PacketVector3<TPacket>    direction = detail::LoadPacket<TPacket>(directionLanes, index);
+
+            const TRegister     distance = TPacket::Div(TPacket::Sub(TPacket::Set(offset),
+                                                                     detail::DotPacket(planeNormal, origin)),
+                                                        detail::DotPacket(planeNormal, direction));
+
+            const auto          hit = TPacket::And(TPacket::LessEqual(TPacket::Set(0), distance),
+                                                   TPacket::Less(distance, maxDistance));
+
+            return detail::StoreHits<TPacket>(hit, distance, maxDistance, distances.data() + index);
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t IntersectRayBox(const Vector3Stream<TValueType>& origins,
+                                const Vector3Stream<TValueType>& directions,
+                                const AABB3<TValueType>& box, std::type_identity_t<std::span<TValueType>> distances)
+    {
+        detail::CheckRayBatch(origins, directions, distances.size());
+
+        const TValueType*       originLanes[3] = { origins.X(), origins.Y(), origins.Z() };
+        const TValueType*       directionLanes[3] = { directions.X(), directions.Y(), directions.Z() };
+        const TValueType        boxMin[3] = { box.GetMin().GetX(), box.GetMin().GetY(), box.GetMin().GetZ() };
+        const TValueType        boxMax[3] = { box.GetMax().GetX(), box.GetMax().GetY(), box.GetMax().GetZ() };
+
+        return detail::RunPackets<TValueType>(origins.Size(), [=]<typename TPacket>(TPacket, std::size_t index)
+        {
+            using TRegister = typename TPacket::TRegister;
+
+            const TRegister     one = TPacket::Set(1);
+            const TRegister     maxDistance = TPacket::Load(distances.data() + index);
+
+            TRegister           entry = TPacket::Set(0);
+            TRegister           exit = maxDistance;
+
+            // Same slab test as AABB::IntersectRay: NaN slabs (origin on a
+            // slab plane and parallel to it) leave entry and exit unchanged
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const TRegister     origin = TPacket::Load(originLanes[axis] + index);
+                const TRegister     inverseDirection = TPacket::Div(one,
+                                                                    TPacket::Load(directionLanes[axis] + index));
+
+                const TRegister     first = TPacket::Mul(TPacket::Sub(TPacket::Set(boxMin[axis]), origin),
+                                                         inverseDirection);
+                const TRegister     second = TPacket::Mul(TPacket::Sub(TPacket::Set(boxMax[axis]), origin),
+                                                          inverseDirection);
+
+                const auto          ignored = TPacket::Unordered(first, second);
+
+                entry = TPacket::Select(ignored, entry, TPacket::Max(TPacket::Min(first, second), entry));
+                exit = TPacket::Select(ignored, exit, TPacket::Min(TPacket::Max(first, second), exit));
+            }
+
+            const auto          hit = TPacket::And(TPacket::LessEqual(entry, exit),
+                                                   TPacket::Less(entry, maxDistance));
+
+            return detail::StoreHits<TPacket>(hit, entry, maxDistance, distances.data() + index);
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t IntersectSegmentTriangle(const Vector3Stream<TValueType>& starts,
+                                         const Vector3Stream<TValueType>& ends,
+                                         const Vector3<TValueType>& a, const Vector3<TValueType>& b,
+                                         const Vector3<TValueType>& c,
+                                         std::type_identity_t<std::span<TValueType>> fractions)
+    {
+        detail::CheckRayBatch(starts, ends, fractions.size());
+
+        const auto                  startLanes = detail::Lanes(starts);
+        const auto                  endLanes = detail::Lanes(ends);
+        const Vector3<TValueType>   edge1 = b - a;
+        const Vector3<TValueType>   edge2 = c - a;
+
+        return detail::RunPackets<TValueType>(starts.Size(), [=]<typename TPacket>(TPacket, std::size_t index)
+        {
+            using TRegister = typename TPacket::TRegister;
+
+            const TRegister                         maxFraction = TPacket::Load(fractions.data() + index);
+            const detail::PacketVector3<TPacket>    start = detail::LoadPacket<TPacket>(startLanes, index);
+            const detail::PacketVector3<TPacket>    end = detail::LoadPacket<TPacket>(endLanes, index);
+            TRegister                               fraction;
+
+            const auto          crosses =
+                detail::CrossTrianglePacket<TPacket>(start, detail::SubPacket(end, start),
+                                                     detail::SetPacket<TPacket>(a),
+                                                     detail::SetPacket<TPacket>(edge1),
+                                                     detail::SetPacket<TPacket>(edge2), fraction);
+
+            const auto          hit = TPacket::And(crosses,
+                                                   TPacket::And(TPacket::LessEqual(TPacket::Set(0), fraction),
+                                                                TPacket::LessEqual(fraction, maxFraction)));
+
+            return detail::StoreHits<TPacket>(hit, fraction, maxFraction, fractions.data() + index);
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t OverlapSpheres(const Vector3Stream<TValueType>& centers,
+                               std::type_identity_t<std::span<const TValueType>> radii,
+                               const Vector3<TValueType>& center, TValueType radius, std::span<uint8_t> out)
+    {
+        if (radii.size() != centers.Size() || out.size() != centers.Size())
+            throw std::logic_error("Output span size does not match input");
+
+        const auto      centerLanes = detail::Lanes(centers);
+
+        return detail::RunPackets<TValueType>(centers.Size(), [=]<typename TPacket>(TPacket, std::size_t index)
+        {
+            using TRegister = typename TPacket::TRegister;
+
+            const detail::PacketVector3<TPacket>    offset =
+                detail::SubPacket(detail::LoadPacket<TPacket>(centerLanes, index), detail::SetPacket<TPacket>(center));
+
+            const TRegister     radiusSum = TPacket::Add(TPacket::Load(radii.data() + index), TPacket::Set(radius));
+            const uint32_t      bits = TPacket::Bits(TPacket::LessEqual(detail::DotPacket(offset, offset),
+                                                                        TPacket::Mul(radiusSum, radiusSum)));
+
+            for (std::size_t lane = 0; lane < TPacket::Width; ++lane)
+                out[index + lane] = static_cast<uint8_t>((bits >> lane) & 1u);
+
+            return detail::CountLanes(bits);
+        });
+    }
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
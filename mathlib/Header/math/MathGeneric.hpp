@@ -57,13 +57,13 @@ namespace math
 
 
     template <CUnsignedType TEvaluatedType>
-    bool unsignedAdditionOverflow(TEvaluatedType a, TEvaluatedType b)
+    constexpr bool unsignedAdditionOverflow(TEvaluatedType a, TEvaluatedType b)
     {
         return b > std::numeric_limits<TEvaluatedType>::max() - a;
     }
 
     template <CUnsignedType TEvaluatedType>
-    bool uSubtractionOverflow(TEvaluatedType a, TEvaluatedType b)
+    constexpr bool uSubtractionOverflow(TEvaluatedType a, TEvaluatedType b)
     {
         return b < std::numeric_limits<TEvaluatedType>::min() + a;
     }
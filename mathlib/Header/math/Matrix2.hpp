@@ -25,59 +25,59 @@ namespace math
 
           // Constructor / destructor
 
-        inline          Matrix(void) = default;
-        inline          Matrix(const TValueType diag);
+        constexpr          Matrix(void) = default;
+        constexpr          Matrix(const TValueType diag);
 
-        inline          Matrix(TValueType a, TValueType b, TValueType c, TValueType d);
+        constexpr          Matrix(TValueType a, TValueType b, TValueType c, TValueType d);
 
-        inline          Matrix(const TValueType vals[]);
-        inline          Matrix(const Matrix& other);
+        constexpr          Matrix(const TValueType vals[]);
+        constexpr          Matrix(const Matrix& other);
 
                         ~Matrix(void) = default;
 
         // Calculate matrix determinant
-        inline TValueType      Determinant(void)                   const;
+        constexpr TValueType      Determinant(void)                   const;
 
         // Turn this matrix into an identity matrix of a given diagonal
-        inline void            Identity(TValueType diag = static_cast<TValueType>(1));
+        constexpr void            Identity(TValueType diag = static_cast<TValueType>(1));
 
         // Get transposed matrix of cofactors
-        inline TMatrixType         Adjugate(void)                      const;
+        constexpr TMatrixType         Adjugate(void)                      const;
 
         // Get inverse of this matrix
-        inline TMatrixType         Inverse(void)                       const;
+        constexpr TMatrixType         Inverse(void)                       const;
 
         // Get transposed copy of this matrix
-        inline TMatrixType         Transpose(void)                     const;
+        constexpr TMatrixType         Transpose(void)                     const;
 
-        inline TMatrixType&        operator=(const TMatrixType& rhs);
+        constexpr TMatrixType&        operator=(const TMatrixType& rhs);
 
         // TMatrixType / matrix operators
 
-        inline TMatrixType         operator+(const TMatrixType& rhs)      const;
-        inline TMatrixType         operator-(const TMatrixType& rhs)      const;
-        inline TMatrixType         operator*(const TMatrixType& rhs)      const;
+        constexpr TMatrixType         operator+(const TMatrixType& rhs)      const;
+        constexpr TMatrixType         operator-(const TMatrixType& rhs)      const;
+        constexpr TMatrixType         operator*(const TMatrixType& rhs)      const;
 
         // Multiply all numbers of a copy of this matrix by a scalar factor
-        inline TMatrixType         operator*(TValueType factor)            const;
+        constexpr TMatrixType         operator*(TValueType factor)            const;
 
         // TMatrixType / matrix assignment operators
 
-        inline TMatrixType&        operator+=(const TMatrixType& rhs);
-        inline TMatrixType&        operator-=(const TMatrixType& rhs);
-        inline TMatrixType&        operator*=(const TMatrixType& rhs);
+        constexpr TMatrixType&        operator+=(const TMatrixType& rhs);
+        constexpr TMatrixType&        operator-=(const TMatrixType& rhs);
+        constexpr TMatrixType&        operator*=(const TMatrixType& rhs);
 
-        inline bool            operator==(const TMatrixType& rhs)     const;
-        inline bool            operator!=(const TMatrixType& rhs)     const;
+        constexpr bool            operator==(const TMatrixType& rhs)     const;
+        constexpr bool            operator!=(const TMatrixType& rhs)     const;
 
         // Access a row (no bound checking)
-        inline TRowType&    operator[](int index);
+        constexpr TRowType&    operator[](int index);
 
         // Access a row (no bound checking)
-        inline TRowType    operator[](int index)              const;
+        constexpr TRowType    operator[](int index)              const;
 
         // Get a 2x2 rotation matrix from an angle in radians
-        inline static TMatrixType  Rotate(Radian<TValueType> angle);
+        constexpr static TMatrixType  Rotate(Radian<TValueType> angle);
 
 
 
@@ -95,7 +95,7 @@ namespace math
     // ---- Implementations ----
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>::Matrix(TValueType a, TValueType b, TValueType c, TValueType d)
     {
         m_values[0][0] = a;
@@ -105,7 +105,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>::Matrix(const TValueType diag)
     {
         m_values[0][0] = diag;
@@ -116,7 +116,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>::Matrix(const TValueType vals[])
     {
         m_values[0][0] = vals[0];
@@ -126,7 +126,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>::Matrix(const Matrix<2, TValueType>& other)
     {
         m_values[0][0] = other.m_values[0][0];
@@ -136,7 +136,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     TValueType Matrix<2, TValueType>::Determinant(void)    const
     {
         return (m_values[0][0] * m_values[1][1]) -
@@ -144,7 +144,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     void Matrix<2, TValueType>::Identity(TValueType diag)
     {
         m_values[0][0] = diag;
@@ -154,7 +154,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::Adjugate(void) const
     {
         if constexpr (std::is_unsigned<TValueType>::value)
@@ -169,7 +169,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::Inverse(void) const
     {
         TValueType       det = Determinant();
@@ -184,7 +184,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::Transpose(void) const
     {
         // Switch non-diagonal values
@@ -197,7 +197,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>& Matrix<2, TValueType>::operator=(const Matrix<2, TValueType>& rhs)
     {
         m_values[0][0] = rhs[0][0];
@@ -210,7 +210,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::operator+(const Matrix<2, TValueType>& rhs) const
     {
         // Add components
@@ -223,7 +223,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::operator-(const Matrix<2, TValueType>& rhs) const
     {
         // Subtract components
@@ -236,7 +236,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::operator*(const Matrix<2, TValueType>& rhs) const
     {
         // TODO: doule check
@@ -252,7 +252,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::operator*(TValueType factor) const
     {
         // Multiply by a scalar
@@ -265,7 +265,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>& Matrix<2, TValueType>::operator+=(const Matrix<2, TValueType>& rhs)
     {
         *this = *this + rhs;
@@ -275,7 +275,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>& Matrix<2, TValueType>::operator-=(const Matrix<2, TValueType>& rhs)
     {
         *this = *this - rhs;
@@ -285,7 +285,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType>& Matrix<2, TValueType>::operator*=(const Matrix<2, TValueType>& rhs)
     {
         *this = *this * rhs;
@@ -295,7 +295,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool  Matrix<2, TValueType>::operator==(const Matrix<2, TValueType>& rhs) const
     {
         // Check if all componenents are almost equal
@@ -306,7 +306,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     bool Matrix<2, TValueType>::operator!=(const Matrix<2, TValueType>& rhs) const
     {
         return !(*this == rhs);
@@ -314,7 +314,7 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Vector2<TValueType>&
     Matrix<2, TValueType>::operator[](int index)
     {
@@ -322,7 +322,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Vector2<TValueType>
     Matrix<2, TValueType>::operator[](int index) const
     {
@@ -330,7 +330,7 @@ namespace math
     }
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
     Matrix<2, TValueType> Matrix<2, TValueType>::Rotate(Radian<TValueType> angle)
     {
         if constexpr (std::is_unsigned<TValueType>::value)
@@ -338,7 +338,9 @@ namespace math
 
         else
         {
-            TValueType   cosAngle = Cos(angle), sinAngle = Sin(angle);
+            TValueType   cosAngle, sinAngle;
+
+            SinCos(angle, sinAngle, cosAngle);
 
             // Create z axis rotation matrix (non-homogenized)
             return Matrix<2, TValueType>
@@ -359,4 +361,16 @@ namespace math
 namespace LibMath = math;
 namespace lm = math;
 
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class Matrix<2, float>;
+    extern template class Matrix<2, double>;
+    extern template class Matrix<2, int32_t>;
+}
+
+#endif
+
 #endif
\ No newline at end of file
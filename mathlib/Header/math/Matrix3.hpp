@@ -22,82 +22,83 @@ namespace math
 
         // Constructors / destructor
 
-    inline                   Matrix(void) = default;
-    inline                   Matrix(const TValueType diag);
-    inline                   Matrix(const TValueType vals[][3]);
-    inline                   Matrix(const TValueType vals[]);
-    inline                   Matrix(const TMatrixType& other);
+    constexpr                   Matrix(void) = default;
+    constexpr                   Matrix(const TValueType diag);
+    constexpr                   Matrix(const TValueType vals[][3]);
+    constexpr                   Matrix(const TValueType vals[]);
+    constexpr                   Matrix(const TMatrixType& other);
 
-    inline                   ~Matrix(void) = default;
+    constexpr                   ~Matrix(void) = default;
 
         // Get this matrix' determinant
-    inline    TValueType      Determinant(void)                   const;
+    constexpr    TValueType      Determinant(void)                   const;
 
         // Turn this matrix into an identity matrix with a given diagonal
-    inline    void            Identity( TValueType diag =
+    constexpr    void            Identity( TValueType diag =
                                         static_cast<TValueType>(1)
                                        );
 
         // Get this matrix' transposed cofactor matrix
-    inline   TMatrixType         Adjugate(void)                      const;
+    constexpr   TMatrixType         Adjugate(void)                      const;
 
         // Get a matrix of all 2x2 submatrices' determinants within
         // this matrix
-    inline   TMatrixType         Minor(void)                         const;
+    constexpr   TMatrixType         Minor(void)                         const;
 
         // Get a matrix of this matrix' cofactors taken from all 2x2
         // matrices within it
-    inline   TMatrixType         Cofactor(void)                      const;
+    constexpr   TMatrixType         Cofactor(void)                      const;
 
         // Get inverse of this matrix
-    inline   TMatrixType         Inverse(void)                       const;
+    constexpr   TMatrixType         Inverse(void)                       const;
 
         // Get a transposed copy of this matrix
-    inline   TMatrixType         Transpose(void)                     const;
+    constexpr   TMatrixType         Transpose(void)                     const;
 
         // Get this matrix stripped of a row and a column
-    inline
+    constexpr
     Matrix2<TValueType>  SubMatrix(int row, int column)    const;
 
-    inline   TMatrixType&        operator=(const TMatrixType& rhs);
-    inline   TMatrixType&        operator=(const TValueType rhs[][3]);
-    inline   TMatrixType&        operator=(const TValueType rhs[9]);
+    constexpr   TMatrixType&        operator=(const TMatrixType& rhs);
+    constexpr   TMatrixType&        operator=(const TValueType rhs[][3]);
+    constexpr   TMatrixType&        operator=(const TValueType rhs[9]);
 
         // Matrix / matrix operators
 
-    inline   TMatrixType         operator+(const TMatrixType& rhs)      const;
-    inline   TMatrixType         operator-(const TMatrixType& rhs)      const;
-    inline   TMatrixType         operator*(const TMatrixType& rhs)      const;
+    constexpr   TMatrixType         operator+(const TMatrixType& rhs)      const;
+    constexpr   TMatrixType         operator-(const TMatrixType& rhs)      const;
+    constexpr   TMatrixType         operator*(const TMatrixType& rhs)      const;
 
-    inline    Vector3<TValueType>
+        // Multiply a vector 3D by this matrix (matrix * column vector)
+    constexpr    Vector3<TValueType>
     operator*(const Vector3<TValueType>& rhs)                      const;
 
         // Multiply all numbers of a copy of this matrix by a scalar factor
-    inline   TMatrixType         operator*(TValueType factor)         const;
+    constexpr   TMatrixType         operator*(TValueType factor)         const;
 
         // Divide all numbers of a copy of this matrix by a scalar factor
-    inline  TMatrixType         operator/(TValueType factor)          const;
+    constexpr  TMatrixType         operator/(TValueType factor)          const;
 
         // Matrix / matrix assignment operators
 
-     inline   TMatrixType&        operator+=(const TMatrixType& rhs);
-     inline   TMatrixType&        operator-=(const TMatrixType& rhs);
-     inline   TMatrixType&        operator*=(const TMatrixType& rhs);
+     constexpr   TMatrixType&        operator+=(const TMatrixType& rhs);
+     constexpr   TMatrixType&        operator-=(const TMatrixType& rhs);
+     constexpr   TMatrixType&        operator*=(const TMatrixType& rhs);
 
         // Multiply all numbers of a copy of this matrix by a scalar factor
-    inline   TMatrixType&        operator*=(TValueType factor);
+    constexpr   TMatrixType&        operator*=(TValueType factor);
 
         // Divide all numbers of a copy of this matrix by a scalar factor
-    inline   TMatrixType&        operator/=(TValueType factor);
+    constexpr   TMatrixType&        operator/=(TValueType factor);
 
-    inline    bool            operator==(const TMatrixType& rhs)     const;
-    inline    bool            operator!=(const TMatrixType& rhs)     const;
+    constexpr    bool            operator==(const TMatrixType& rhs)     const;
+    constexpr    bool            operator!=(const TMatrixType& rhs)     const;
 
         // Access a row (no bound checking)
-    inline    TColumnType&   operator[](int index);
+    constexpr    TColumnType&   operator[](int index);
 
         // Access a row (no bound checking)
-    inline    TColumnType    operator[](int index)                const;
+    constexpr    TColumnType    operator[](int index)                const;
 
 
     private:
@@ -121,14 +122,14 @@ namespace math
 
 
 
-    template <CScalarType TValueType> inline
+    template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>::Matrix(const TValueType diag)
  {
  	Identity(diag);
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>::Matrix(const TValueType vals[][3])
  {
  	// Copy 3x3 array into matix
@@ -143,7 +144,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>::Matrix(const TValueType vals[])
  {
  	int		arrayIndex = 0;
@@ -161,7 +162,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>::Matrix(const Matrix<3, TValueType>& other)
  {
  	int		maxSize = 3;
@@ -178,7 +179,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  TValueType Matrix<3, TValueType>::Determinant(void) const
  {
  	// Add multiplied left-right diagonals together
@@ -202,7 +203,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  void Matrix<3, TValueType>::Identity(TValueType diag)
  {
  	int		maxSize = 3;
@@ -219,7 +220,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::Adjugate(void) const
  {
  	Matrix<3, TValueType>			result;
@@ -248,7 +249,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::Minor(void) const
  {
  	Matrix<3, TValueType>		result;
@@ -268,7 +269,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::Cofactor(void) const
  {
  	Matrix<3, TValueType>			result;
@@ -295,7 +296,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::Inverse(void) const
  {
  	// Perform only one division
@@ -327,7 +328,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::Transpose(void) const
  {
  	Matrix<3, TValueType>		result;
@@ -347,7 +348,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix2<TValueType> Matrix<3, TValueType>::SubMatrix(int row, int column) const
  {
  	Matrix2<TValueType>		minor;
@@ -376,7 +377,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator=(const Matrix<3, TValueType>& rhs)
  {
      for (uint8_t row = 0; row < 3; ++row)
@@ -387,7 +388,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator=(const TValueType rhs[][3])
  {
  	// Copy double array
@@ -404,7 +405,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator=(const TValueType rhs[9])
  {
  	int		arrayIndex = 0;
@@ -423,7 +424,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::operator+(const Matrix<3, TValueType>& rhs) const
  {
  	Matrix<3, TValueType>		result;
@@ -442,7 +443,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::operator-(const Matrix<3, TValueType>& rhs) const
  {
  	Matrix<3, TValueType>		result;
@@ -461,7 +462,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::operator*(const Matrix<3, TValueType>& rhs) const
  {
  	Matrix<3, TValueType>		result;
@@ -490,7 +491,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::operator*(TValueType rhs) const
  {
  	Matrix<3, TValueType>		result;
@@ -508,31 +509,16 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Vector3<TValueType>  Matrix<3, TValueType>::operator*(const Vector3<TValueType>& rhs) const
  {
- 	Vector3<TValueType>		result(static_cast<TValueType>(0));
- 	TValueType				num;
-
- 	// Multiply vector by *this object
- 	for (int row = 0; row < 3; ++row)
- 	{
- 		// Accumulator
- 		num = static_cast<TValueType>(0);
-
- 		for (int column = 0; column < 3; ++column)
- 		{
- 			num += m_values[row][column] * rhs[column];
- 		}
-
- 		result[row] = num;
- 	}
-
- 	return result;
+ 	// Columns weighted by the vector's components, same column-major
+ 	// convention as the matrix product
+ 	return m_values[0] * rhs.GetX() + m_values[1] * rhs.GetY() + m_values[2] * rhs.GetZ();
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType> Matrix<3, TValueType>::operator/(TValueType rhs) const
  {
  	// Multiply by one over divisor
@@ -540,7 +526,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator+=(const Matrix<3, TValueType>& rhs)
  {
  	// Add and assign
@@ -557,7 +543,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator-=(const Matrix<3, TValueType>& rhs)
  {
  	//Subtract and assign
@@ -574,7 +560,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator*=(const Matrix<3, TValueType>& rhs)
  {
  	Matrix<3, TValueType>		result;
@@ -606,7 +592,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator*=(TValueType rhs)
  {
  	// Multiply by scalar
@@ -622,7 +608,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Matrix<3, TValueType>& Matrix<3, TValueType>::operator/=(TValueType rhs)
  {
  	// Multiply by one over divisor
@@ -633,7 +619,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  bool Matrix<3, TValueType>::operator==(const Matrix<3, TValueType>& rhs) const
  {
  	// Check all components for equality
@@ -654,7 +640,7 @@ namespace math
 
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  bool Matrix<3, TValueType>::operator!=(const Matrix<3, TValueType>& rhs) const
  {
  	// Return opposite of equality
@@ -662,7 +648,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Vector3<TValueType>&    Matrix<3, TValueType>::operator[](int index)
  {
  	// Return row
@@ -670,7 +656,7 @@ namespace math
  }
 
 
- template <CScalarType TValueType> inline
+ template <CScalarType TValueType> constexpr
  Vector3<TValueType>  Matrix<3, TValueType>::operator[](int index) const
  {
  	// Return row
@@ -681,4 +667,16 @@ namespace math
 namespace lm = math;
 namespace LibMath = math;
 
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class Matrix<3, float>;
+    extern template class Matrix<3, double>;
+    extern template class Matrix<3, int32_t>;
+}
+
+#endif
+
 #endif
\ No newline at end of file
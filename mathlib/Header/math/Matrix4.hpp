@@ -1,15 +1,24 @@
 #ifndef __MATRIX4_H__
 #define __MATRIX4_H__
 
+#include <span>
+#include <type_traits>
+
 #include "MathGeneric.hpp"
 #include "MatrixGeneric.hpp"
 
 #include "Matrix3.hpp"
 #include "Vector4.hpp"
 #include "Vector3.hpp"
+#include "Simd.hpp"
 
 namespace math
 {
+	// Defined in Quaternion.hpp, only needed to build TRS matrices
+	template <CFloatingType TValueType>
+	class Quaternion;
+
+
 	template <CScalarType TValueType>
 	class Matrix<4, TValueType>
 	{
@@ -22,51 +31,58 @@ namespace math
 
 		// Constructors / destructor
 
-	inline					Matrix(void) = default;
-	inline					Matrix(const TValueType diag);
-	inline					Matrix(const TValueType vals[][4]);
-	inline					Matrix(const TValueType vals[]);
-	inline					Matrix(const Matrix<4, TValueType>& other);
+	constexpr					Matrix(void) = default;
+	constexpr					Matrix(const TValueType diag);
+	constexpr					Matrix(const TValueType vals[][4]);
+	constexpr					Matrix(const TValueType vals[]);
+	constexpr					Matrix(const Matrix<4, TValueType>& other);
 
-	explicit				Matrix(const Matrix3<TValueType>& mat3);
+	explicit constexpr		Matrix(const Matrix3<TValueType>& mat3);
 
-	inline					~Matrix(void) = default;
+	constexpr					~Matrix(void) = default;
 
 		// Get this matrix' determinant
-	inline	TValueType           Determinant(void)                   const;
+	constexpr	TValueType           Determinant(void)                   const;
 
 		// Turn this matrix into an identity matrix with a given diagonal
-	inline	void            Identity(TValueType diag = static_cast<TValueType>(1));
+	constexpr	void            Identity(TValueType diag = static_cast<TValueType>(1));
 
 		// Get this matrix' transposed cofactor matrix
-	inline	TMatrixType         Adjugate(void)                      const;
+	constexpr	TMatrixType         Adjugate(void)                      const;
 
 		// Get a matrix of all 3x3 submatrices' determinants within
 		// this matrix
-	inline	TMatrixType         Minor(void)                         const;
+	constexpr	TMatrixType         Minor(void)                         const;
 
 		// Get a matrix of this matrix' cofactors taken from all 3x3
 		// matrices within it
-	inline	TMatrixType         Cofactor(void)                      const;
+	constexpr	TMatrixType         Cofactor(void)                      const;
 
 		// Get inverse of this matrix
-	inline	TMatrixType         Inverse(void)                       const;
+	constexpr	TMatrixType         Inverse(void)                       const;
+
+		// Get inverse of an affine matrix (last row is 0, 0, 0, 1)
+	constexpr	TMatrixType         InverseAffine(void)                 const;
+
+		// Get inverse of a rigid transform (orthonormal rotation
+		// and translation only)
+	constexpr	TMatrixType         InverseOrthonormal(void)            const;
 
 		// Get a transposed copy of this matrix
-	inline	TMatrixType         Transpose(void)                     const;
+	constexpr	TMatrixType         Transpose(void)                     const;
 
 		// Get this matrix stripped of a row and a column
-	inline	Matrix3<TValueType>         SubMatrix(int row, int column)    const;
+	constexpr	Matrix3<TValueType>         SubMatrix(int row, int column)    const;
 
 		// Change the position to a matrix
-	static inline Matrix4<TValueType>	PositionMatrix(const Vector3<TValueType>& position);	
+	static constexpr Matrix4<TValueType>	PositionMatrix(const Vector3<TValueType>& position);	
 
 		// Change the scale to a matrix
-	static inline Matrix4<TValueType>	ScaleMatrix(const Vector3<TValueType>& scale);
+	static constexpr Matrix4<TValueType>	ScaleMatrix(const Vector3<TValueType>& scale);
 
 
 	// Get rotation matrix from three angles (column-major)
-	static inline TMatrixType			RotationMatrix(
+	static constexpr TMatrixType			RotationMatrix(
 			Radian<TValueType> angleX,
 			Radian<TValueType> angleY,
 			Radian<TValueType> angle
@@ -74,53 +90,74 @@ namespace math
 
 
 	// Get rotation matrix from three angles stored in a vector (column-major)
-	static inline Matrix4<TValueType> RotationMatrix(Vector3<TValueType> angles);
+	static constexpr Matrix4<TValueType> RotationMatrix(Vector3<TValueType> angles);
+
+	// Get position * rotation * scale, written directly without
+	// building and multiplying three matrices (Quaternion.hpp required)
+	template <CFloatingType TRotationType>
+	static TMatrixType					TRS(
+			const Vector3<TValueType>& position,
+			const Quaternion<TRotationType>& rotation,
+			const Vector3<TValueType>& scale
+	);
+
+	// Get position * rotation * scale from three angles stored in a vector
+	static constexpr TMatrixType			TRS(
+			const Vector3<TValueType>& position,
+			const Vector3<TValueType>& angles,
+			const Vector3<TValueType>& scale
+	);
 
-	inline	TMatrixType&		operator=(const TMatrixType& rhs);
-	inline	TMatrixType&		operator=(const TValueType rhs[][4]);
-	inline	TMatrixType&		operator=(const TValueType rhs[16]);
+	constexpr	TMatrixType&		operator=(const TMatrixType& rhs);
+	constexpr	TMatrixType&		operator=(const TValueType rhs[][4]);
+	constexpr	TMatrixType&		operator=(const TValueType rhs[16]);
 
 
 		// Matrix / matrix operators
 
-	inline	TMatrixType         operator+(const TMatrixType& rhs)      const;
-	inline	TMatrixType         operator-(const TMatrixType& rhs)      const;
-	inline	TMatrixType         operator*(const TMatrixType& rhs)      const;
+	constexpr	TMatrixType         operator+(const TMatrixType& rhs)      const;
+	constexpr	TMatrixType         operator-(const TMatrixType& rhs)      const;
+	constexpr	TMatrixType         operator*(const TMatrixType& rhs)      const;
 
-		// Multiply a vector 4D by this matrix
-	inline	Vector4<TValueType>				operator*(const Vector4<TValueType>& rhs)      const;
+		// Multiply a vector 4D by this matrix (matrix * column vector)
+	constexpr	Vector4<TValueType>				operator*(const Vector4<TValueType>& rhs)      const;
 
 
 		// Multiply all numbers of a copy of this matrix by a scalar factor
-	inline	TMatrixType         operator*(TValueType factor)            const;
+	constexpr	TMatrixType         operator*(TValueType factor)            const;
 
 		// Divide all numbers of a copy of this matrix by a scalar factor
-	inline	TMatrixType         operator/(TValueType factor)            const;
+	constexpr	TMatrixType         operator/(TValueType factor)            const;
 
 
 		// Matrix / matrix assignment operators
 
 
-	inline	TMatrixType&		operator+=(const TMatrixType& rhs);
-	inline	TMatrixType&		operator-=(const TMatrixType& rhs);
-	inline	TMatrixType&		operator*=(const TMatrixType& rhs);
+	constexpr	TMatrixType&		operator+=(const TMatrixType& rhs);
+	constexpr	TMatrixType&		operator-=(const TMatrixType& rhs);
+	constexpr	TMatrixType&		operator*=(const TMatrixType& rhs);
 
 		// Multiply all numbers of a copy of this matrix by a scalar factor
-	inline	TMatrixType&		operator*=(TValueType factor);
+	constexpr	TMatrixType&		operator*=(TValueType factor);
 
 		// Divide all numbers of a copy of this matrix by a scalar factor
-	inline	TMatrixType&		operator/=(TValueType factor);
+	constexpr	TMatrixType&		operator/=(TValueType factor);
 
-	inline	bool				operator==(const TMatrixType& rhs)     const;
-	inline	bool				operator!=(const TMatrixType& rhs)     const;
+	constexpr	bool				operator==(const TMatrixType& rhs)     const;
+	constexpr	bool				operator!=(const TMatrixType& rhs)     const;
 
 		// Access a row (no bound checking)
-	inline	TRowType&		operator[](int index);
+	constexpr	TRowType&		operator[](int index);
 
 		// Access a row (no bound checking)
-	inline	TRowType		operator[](int index)              const;
+	constexpr	TRowType		operator[](int index)              const;
 
-	operator Matrix3<TValueType>(void)		const;
+		// Get a pointer to all 16 values, stored contiguously
+		// column after column
+	inline	TValueType*			Data(void);
+	inline	const TValueType*	Data(void)						const;
+
+	constexpr	operator Matrix3<TValueType>(void)		const;
 
 
 	private:
@@ -130,21 +167,115 @@ namespace math
 	};
 
 
+	// Batch transforms, computed as matrix * vector (column-major) with the
+	// matrix columns kept in registers. Output spans must be as large as
+	// the input and may be the same memory
 
+	// Transform points (w = 1)
+	template <CScalarType TValueType> inline
+	void		TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+		std::type_identity_t<std::span<Vector3<TValueType>>> out
+	);
 
+	// Transform points (w = 1) in place
+	template <CScalarType TValueType> inline
+	void		TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector3<TValueType>>> points
+	);
 
+	// Transform points (w = 1) into homogeneous coordinates,
+	// without perspective divide (e.g. to clip space)
+	template <CScalarType TValueType> inline
+	void		TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+		std::type_identity_t<std::span<Vector4<TValueType>>> out
+	);
 
+	// Transform 4D vectors
+	template <CScalarType TValueType> inline
+	void		TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector4<TValueType>>> vectors,
+		std::type_identity_t<std::span<Vector4<TValueType>>> out
+	);
 
-// ---- Implementations ----
+	// Transform 4D vectors in place
+	template <CScalarType TValueType> inline
+	void		TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector4<TValueType>>> vectors
+	);
+
+	// Transform directions (w = 0, translation is ignored)
+	template <CScalarType TValueType> inline
+	void		TransformDirections
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> directions,
+		std::type_identity_t<std::span<Vector3<TValueType>>> out
+	);
+
+	// Transform directions (w = 0) in place
+	template <CScalarType TValueType> inline
+	void		TransformDirections
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector3<TValueType>>> directions
+	);
+
+	// Transform points (w = 1) and divide results by their w
+	template <CScalarType TValueType> inline
+	void		TransformPointsProjective
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+		std::type_identity_t<std::span<Vector3<TValueType>>> out
+	);
 
+	// Transform points (w = 1) and divide results by their w in place
 	template <CScalarType TValueType> inline
+	void		TransformPointsProjective
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector3<TValueType>>> points
+	);
+
+	// Build one TRS matrix per position, rotation and scale
+	// (Quaternion.hpp required)
+	template <CFloatingType TValueType> inline
+	void		TRS
+	(
+		std::type_identity_t<std::span<const Vector3<TValueType>>> positions,
+		std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> scales,
+		std::type_identity_t<std::span<Matrix4<TValueType>>> out
+	);
+
+
+
+
+
+
+
+// ---- Implementations ----
+
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>::Matrix(const TValueType diag)
 	{
 		Identity(diag);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>::Matrix(const TValueType vals[][4])
 	{
 		for (int row = 0; row < 4; ++row)
@@ -157,7 +288,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>::Matrix(const TValueType vals[])
 	{
 		int		arrayIndex = 0;
@@ -172,7 +303,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>::Matrix(const Matrix<4, TValueType>& other)
 	{
 		int		maxSize = 4;
@@ -187,7 +318,7 @@ namespace math
 	}
 
 	template<CScalarType TValueType>
-	inline Matrix<4, TValueType>::Matrix(const Matrix3<TValueType>& mat3)
+	constexpr Matrix<4, TValueType>::Matrix(const Matrix3<TValueType>& mat3)
 	{
 		m_values[0][0] = mat3[0][0];
 		m_values[0][1] = mat3[0][1];
@@ -211,27 +342,43 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Matrix<4, TValueType>::Determinant(void) const
 	{
-		Matrix3<TValueType>     minor;
-
-		TValueType		result = static_cast<TValueType>(0), minusOne = static_cast<TValueType>(-1);
-		int				stripedRow = 0;
-
-		for (unsigned int cofactor = 0; cofactor < 4; ++cofactor)
+#ifdef MTH_SIMD_SSE
+		if constexpr (std::is_same_v<TValueType, float>)
 		{
-			minor = SubMatrix(stripedRow, cofactor);
-			result += m_values[stripedRow][cofactor] * minor.Determinant() * Pow(minusOne, cofactor);
-
+			if (!std::is_constant_evaluated())
+				return simd::DeterminantMatrix4(Data());
 		}
-
-		return result;
-
+#endif
+
+		const TValueType		a00 = m_values[0].GetX(), a01 = m_values[0].GetY(), a02 = m_values[0].GetZ(), a03 = m_values[0].GetW();
+		const TValueType		a10 = m_values[1].GetX(), a11 = m_values[1].GetY(), a12 = m_values[1].GetZ(), a13 = m_values[1].GetW();
+		const TValueType		a20 = m_values[2].GetX(), a21 = m_values[2].GetY(), a22 = m_values[2].GetZ(), a23 = m_values[2].GetW();
+		const TValueType		a30 = m_values[3].GetX(), a31 = m_values[3].GetY(), a32 = m_values[3].GetZ(), a33 = m_values[3].GetW();
+
+		// Laplace expansion over the 2x2 minors of the two upper
+		// and two lower rows, each one paired with its complement
+		const TValueType		s0 = a00 * a11 - a10 * a01;
+		const TValueType		s1 = a00 * a12 - a10 * a02;
+		const TValueType		s2 = a00 * a13 - a10 * a03;
+		const TValueType		s3 = a01 * a12 - a11 * a02;
+		const TValueType		s4 = a01 * a13 - a11 * a03;
+		const TValueType		s5 = a02 * a13 - a12 * a03;
+
+		const TValueType		c5 = a22 * a33 - a32 * a23;
+		const TValueType		c4 = a21 * a33 - a31 * a23;
+		const TValueType		c3 = a21 * a32 - a31 * a22;
+		const TValueType		c2 = a20 * a33 - a30 * a23;
+		const TValueType		c1 = a20 * a32 - a30 * a22;
+		const TValueType		c0 = a20 * a31 - a30 * a21;
+
+		return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Matrix<4, TValueType>::Identity(TValueType diag)
 	{
 		int		maxSize = 4;
@@ -246,7 +393,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::Adjugate(void) const
 	{
 		if constexpr (std::is_unsigned<TValueType>::value)
@@ -255,42 +402,88 @@ namespace math
 		else
 		{
 			Matrix<4, TValueType>			result;
+			const Matrix<4, TValueType>		minors = Minor();
 
-			TValueType			minusOne = -1;
+			// Transposed cofactors
+			result.m_values[0][0] =  minors.m_values[0].GetX();
+			result.m_values[0][1] = -minors.m_values[1].GetX();
+			result.m_values[0][2] =  minors.m_values[2].GetX();
+			result.m_values[0][3] = -minors.m_values[3].GetX();
 
-			for (unsigned int row = 0; row < 4; ++row)
-			{
-				for (unsigned int column = 0; column < 4; ++column)
-				{
-					result[column][row] = SubMatrix(row, column).Determinant();
+			result.m_values[1][0] = -minors.m_values[0].GetY();
+			result.m_values[1][1] =  minors.m_values[1].GetY();
+			result.m_values[1][2] = -minors.m_values[2].GetY();
+			result.m_values[1][3] =  minors.m_values[3].GetY();
 
-					result[column][row] *= Pow(minusOne, row + column);
-				}
-			}
+			result.m_values[2][0] =  minors.m_values[0].GetZ();
+			result.m_values[2][1] = -minors.m_values[1].GetZ();
+			result.m_values[2][2] =  minors.m_values[2].GetZ();
+			result.m_values[2][3] = -minors.m_values[3].GetZ();
+
+			result.m_values[3][0] = -minors.m_values[0].GetW();
+			result.m_values[3][1] =  minors.m_values[1].GetW();
+			result.m_values[3][2] = -minors.m_values[2].GetW();
+			result.m_values[3][3] =  minors.m_values[3].GetW();
 
 			return result;
 		}
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::Minor(void) const
 	{
 		Matrix<4, TValueType>		result;
 
-		for (int row = 0; row < 4; ++row)
-		{
-			for (int column = 0; column < 4; ++column)
-			{
-				result[row][column] = SubMatrix(row, column).Determinant();
-			}
-		}
+		// Every 3x3 determinant is built from the 12 2x2 minors of the
+		// two upper and two lower rows instead of 16 SubMatrix() calls.
+		// result[i][j] is the determinant of SubMatrix(i, j)
+		const TValueType		a00 = m_values[0].GetX(), a01 = m_values[0].GetY(), a02 = m_values[0].GetZ(), a03 = m_values[0].GetW();
+		const TValueType		a10 = m_values[1].GetX(), a11 = m_values[1].GetY(), a12 = m_values[1].GetZ(), a13 = m_values[1].GetW();
+		const TValueType		a20 = m_values[2].GetX(), a21 = m_values[2].GetY(), a22 = m_values[2].GetZ(), a23 = m_values[2].GetW();
+		const TValueType		a30 = m_values[3].GetX(), a31 = m_values[3].GetY(), a32 = m_values[3].GetZ(), a33 = m_values[3].GetW();
+
+		// Upper 2x2 minors
+		const TValueType		s0 = a00 * a11 - a10 * a01;
+		const TValueType		s1 = a00 * a12 - a10 * a02;
+		const TValueType		s2 = a00 * a13 - a10 * a03;
+		const TValueType		s3 = a01 * a12 - a11 * a02;
+		const TValueType		s4 = a01 * a13 - a11 * a03;
+		const TValueType		s5 = a02 * a13 - a12 * a03;
+
+		// Lower 2x2 minors
+		const TValueType		c5 = a22 * a33 - a32 * a23;
+		const TValueType		c4 = a21 * a33 - a31 * a23;
+		const TValueType		c3 = a21 * a32 - a31 * a22;
+		const TValueType		c2 = a20 * a33 - a30 * a23;
+		const TValueType		c1 = a20 * a32 - a30 * a22;
+		const TValueType		c0 = a20 * a31 - a30 * a21;
+
+		result.m_values[0][0] = a11 * c5 - a12 * c4 + a13 * c3;
+		result.m_values[0][1] = a10 * c5 - a12 * c2 + a13 * c1;
+		result.m_values[0][2] = a10 * c4 - a11 * c2 + a13 * c0;
+		result.m_values[0][3] = a10 * c3 - a11 * c1 + a12 * c0;
+
+		result.m_values[1][0] = a01 * c5 - a02 * c4 + a03 * c3;
+		result.m_values[1][1] = a00 * c5 - a02 * c2 + a03 * c1;
+		result.m_values[1][2] = a00 * c4 - a01 * c2 + a03 * c0;
+		result.m_values[1][3] = a00 * c3 - a01 * c1 + a02 * c0;
+
+		result.m_values[2][0] = a31 * s5 - a32 * s4 + a33 * s3;
+		result.m_values[2][1] = a30 * s5 - a32 * s2 + a33 * s1;
+		result.m_values[2][2] = a30 * s4 - a31 * s2 + a33 * s0;
+		result.m_values[2][3] = a30 * s3 - a31 * s1 + a32 * s0;
+
+		result.m_values[3][0] = a21 * s5 - a22 * s4 + a23 * s3;
+		result.m_values[3][1] = a20 * s5 - a22 * s2 + a23 * s1;
+		result.m_values[3][2] = a20 * s4 - a21 * s2 + a23 * s0;
+		result.m_values[3][3] = a20 * s3 - a21 * s1 + a22 * s0;
 
 		return result;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::Cofactor(void) const
 	{
 		if constexpr (std::is_unsigned<TValueType>::value)
@@ -299,25 +492,35 @@ namespace math
 		else
 		{
 			Matrix<4, TValueType>			result;
+			const Matrix<4, TValueType>		minors = Minor();
 
-			TValueType			minusOne = -1;
+			// Checkerboard signs
+			result.m_values[0][0] =  minors.m_values[0].GetX();
+			result.m_values[0][1] = -minors.m_values[0].GetY();
+			result.m_values[0][2] =  minors.m_values[0].GetZ();
+			result.m_values[0][3] = -minors.m_values[0].GetW();
 
-			for (unsigned int row = 0; row < 4; ++row)
-			{
-				for (unsigned int column = 0; column < 4; ++column)
-				{
-					result[row][column] = SubMatrix(row, column).Determinant();
+			result.m_values[1][0] = -minors.m_values[1].GetX();
+			result.m_values[1][1] =  minors.m_values[1].GetY();
+			result.m_values[1][2] = -minors.m_values[1].GetZ();
+			result.m_values[1][3] =  minors.m_values[1].GetW();
 
-					result[row][column] *= Pow(minusOne, row + column);
-				}
-			}
+			result.m_values[2][0] =  minors.m_values[2].GetX();
+			result.m_values[2][1] = -minors.m_values[2].GetY();
+			result.m_values[2][2] =  minors.m_values[2].GetZ();
+			result.m_values[2][3] = -minors.m_values[2].GetW();
+
+			result.m_values[3][0] = -minors.m_values[3].GetX();
+			result.m_values[3][1] =  minors.m_values[3].GetY();
+			result.m_values[3][2] = -minors.m_values[3].GetZ();
+			result.m_values[3][3] =  minors.m_values[3].GetW();
 
 			return result;
 		}
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::Inverse(void) const
 	{
 		if constexpr (std::is_unsigned<TValueType>::value)
@@ -325,28 +528,126 @@ namespace math
 
 		else
 		{
-			TValueType						invDeterminant = static_cast<TValueType>(1) / Determinant();
 			Matrix<4, TValueType>			result;
-			TValueType						minusOne = -1;
 
-			for (unsigned int row = 0; row < 4; ++row)
+#ifdef MTH_SIMD_SSE
+			if constexpr (std::is_same_v<TValueType, float>)
 			{
-				for (unsigned int column = 0; column < 4; ++column)
+				if (!std::is_constant_evaluated())
 				{
-					result[column][row] = SubMatrix(row, column).Determinant();
-
-					result[column][row] *= Pow(minusOne, row + column);
-					result[column][row] *= invDeterminant;
-
+					simd::InverseMatrix4(Data(), result.Data());
+					return result;
 				}
 			}
+#endif
+
+			// Same shared minors as Minor(). Works for both layouts
+			// as inverse(transpose(M)) is transpose(inverse(M))
+			const Matrix<4, TValueType>		minors = Minor();
+
+			// Expand along the first row, then perform only one division
+			const TValueType		invDeterminant = static_cast<TValueType>(1) /
+			(
+				m_values[0].GetX() * minors.m_values[0].GetX() - m_values[0].GetY() * minors.m_values[0].GetY() +
+				m_values[0].GetZ() * minors.m_values[0].GetZ() - m_values[0].GetW() * minors.m_values[0].GetW()
+			);
+
+			// Transposed cofactors (adjugate) scaled by 1 / determinant
+			result.m_values[0][0] =  minors.m_values[0].GetX() * invDeterminant;
+			result.m_values[0][1] = -minors.m_values[1].GetX() * invDeterminant;
+			result.m_values[0][2] =  minors.m_values[2].GetX() * invDeterminant;
+			result.m_values[0][3] = -minors.m_values[3].GetX() * invDeterminant;
+
+			result.m_values[1][0] = -minors.m_values[0].GetY() * invDeterminant;
+			result.m_values[1][1] =  minors.m_values[1].GetY() * invDeterminant;
+			result.m_values[1][2] = -minors.m_values[2].GetY() * invDeterminant;
+			result.m_values[1][3] =  minors.m_values[3].GetY() * invDeterminant;
+
+			result.m_values[2][0] =  minors.m_values[0].GetZ() * invDeterminant;
+			result.m_values[2][1] = -minors.m_values[1].GetZ() * invDeterminant;
+			result.m_values[2][2] =  minors.m_values[2].GetZ() * invDeterminant;
+			result.m_values[2][3] = -minors.m_values[3].GetZ() * invDeterminant;
+
+			result.m_values[3][0] = -minors.m_values[0].GetW() * invDeterminant;
+			result.m_values[3][1] =  minors.m_values[1].GetW() * invDeterminant;
+			result.m_values[3][2] = -minors.m_values[2].GetW() * invDeterminant;
+			result.m_values[3][3] =  minors.m_values[3].GetW() * invDeterminant;
 
 			return result;
 		}
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
+	Matrix<4, TValueType> Matrix<4, TValueType>::InverseAffine(void) const
+	{
+		if constexpr (std::is_unsigned<TValueType>::value)
+			throw std::logic_error("Cannot compute unsigned inverse matrix");
+
+		else
+		{
+			// Linear part columns and translation
+			const Vector3<TValueType>	column0(m_values[0].GetX(), m_values[0].GetY(), m_values[0].GetZ());
+			const Vector3<TValueType>	column1(m_values[1].GetX(), m_values[1].GetY(), m_values[1].GetZ());
+			const Vector3<TValueType>	column2(m_values[2].GetX(), m_values[2].GetY(), m_values[2].GetZ());
+			const Vector3<TValueType>	translation(m_values[3].GetX(), m_values[3].GetY(), m_values[3].GetZ());
+
+			// Rows of the inverse linear part are the cross products
+			// of the other two columns divided by the determinant
+			Vector3<TValueType>			row0 = column1.Cross(column2);
+			Vector3<TValueType>			row1 = column2.Cross(column0);
+			Vector3<TValueType>			row2 = column0.Cross(column1);
+
+			const TValueType			invDeterminant = static_cast<TValueType>(1) / column0.Dot(row0);
+
+			row0 *= invDeterminant;
+			row1 *= invDeterminant;
+			row2 *= invDeterminant;
+
+			Matrix<4, TValueType>		result;
+
+			result.m_values[0] = TRowType(row0.GetX(), row1.GetX(), row2.GetX(), static_cast<TValueType>(0));
+			result.m_values[1] = TRowType(row0.GetY(), row1.GetY(), row2.GetY(), static_cast<TValueType>(0));
+			result.m_values[2] = TRowType(row0.GetZ(), row1.GetZ(), row2.GetZ(), static_cast<TValueType>(0));
+
+			// Undo translation in the inverted basis
+			result.m_values[3] = TRowType(-row0.Dot(translation), -row1.Dot(translation),
+										  -row2.Dot(translation), static_cast<TValueType>(1));
+
+			return result;
+		}
+	}
+
+
+	template <CScalarType TValueType> constexpr
+	Matrix<4, TValueType> Matrix<4, TValueType>::InverseOrthonormal(void) const
+	{
+		if constexpr (std::is_unsigned<TValueType>::value)
+			throw std::logic_error("Cannot compute unsigned inverse matrix");
+
+		else
+		{
+			const Vector3<TValueType>	column0(m_values[0].GetX(), m_values[0].GetY(), m_values[0].GetZ());
+			const Vector3<TValueType>	column1(m_values[1].GetX(), m_values[1].GetY(), m_values[1].GetZ());
+			const Vector3<TValueType>	column2(m_values[2].GetX(), m_values[2].GetY(), m_values[2].GetZ());
+			const Vector3<TValueType>	translation(m_values[3].GetX(), m_values[3].GetY(), m_values[3].GetZ());
+
+			Matrix<4, TValueType>		result;
+
+			// Inverse rotation is the transposed rotation
+			result.m_values[0] = TRowType(column0.GetX(), column1.GetX(), column2.GetX(), static_cast<TValueType>(0));
+			result.m_values[1] = TRowType(column0.GetY(), column1.GetY(), column2.GetY(), static_cast<TValueType>(0));
+			result.m_values[2] = TRowType(column0.GetZ(), column1.GetZ(), column2.GetZ(), static_cast<TValueType>(0));
+
+			result.m_values[3] = TRowType(-column0.Dot(translation), -column1.Dot(translation),
+										  -column2.Dot(translation), static_cast<TValueType>(1));
+
+			return result;
+		}
+	}
+
+
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::Transpose(void) const
 	{
 		Matrix<4, TValueType> result;
@@ -364,7 +665,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix3<TValueType> Matrix<4, TValueType>::SubMatrix(int row, int column) const
 	{
 		Matrix3<TValueType> minor;
@@ -389,7 +690,7 @@ namespace math
 	}
 
 	template<CScalarType TValueType>
-	inline Matrix4<TValueType> 
+	constexpr Matrix4<TValueType> 
 	Matrix<4, TValueType>::PositionMatrix(const Vector3<TValueType>& position)
 	{
 		TMatrixType positionMatrix;
@@ -404,7 +705,7 @@ namespace math
 	}
 
 	template<CScalarType TValueType>
-	inline Matrix <4, TValueType> 
+	constexpr Matrix <4, TValueType> 
 	Matrix<4, TValueType>::ScaleMatrix(const Vector3<TValueType>& scale)
 	{
 		TMatrixType scaleMatrix;
@@ -419,7 +720,7 @@ namespace math
 	}
 
 	template<CScalarType TValueType>
-	inline Matrix<4, TValueType> Matrix<4, TValueType>::RotationMatrix(
+	constexpr Matrix<4, TValueType> Matrix<4, TValueType>::RotationMatrix(
 		Radian<TValueType> angleX,
 		Radian<TValueType> angleY,
 		Radian<TValueType> angleZ
@@ -431,9 +732,11 @@ namespace math
 
 		else
 		{
-			TValueType				cosYaw = Cos(angleZ), sinYaw = Sin(angleZ);
-			TValueType				cosPitch = Cos(angleX), sinPitch = Sin(angleX);
-			TValueType				cosRoll = Cos(angleY), sinRoll = Sin(angleY);
+			TValueType				cosYaw, sinYaw, cosPitch, sinPitch, cosRoll, sinRoll;
+
+			SinCos(angleZ, sinYaw, cosYaw);
+			SinCos(angleX, sinPitch, cosPitch);
+			SinCos(angleY, sinRoll, cosRoll);
 
 			TMatrixType				rotationMatrix;
 
@@ -466,7 +769,7 @@ namespace math
 	}
 
 	template<CScalarType TValueType>
-	inline Matrix4<TValueType>
+	constexpr Matrix4<TValueType>
 	Matrix<4, TValueType>::RotationMatrix(Vector3<TValueType> angles)
 	{
 		Radian<TValueType>		angleX(angles.X()),
@@ -477,8 +780,95 @@ namespace math
 	}
 
 
+	template <CScalarType TValueType>
+	template <CFloatingType TRotationType> inline
+	Matrix<4, TValueType> Matrix<4, TValueType>::TRS(
+		const Vector3<TValueType>& position,
+		const Quaternion<TRotationType>& rotation,
+		const Vector3<TValueType>& scale
+	)
+	{
+		static_assert(std::is_same_v<TRotationType, TValueType>, "Rotation and matrix must have the same value type");
 
-	template <CScalarType TValueType> inline
+		const TValueType		w = rotation.GetW(), x = rotation.GetX(), y = rotation.GetY(), z = rotation.GetZ();
+		const TValueType		zero = static_cast<TValueType>(0), one = static_cast<TValueType>(1);
+		const TValueType		two = static_cast<TValueType>(2);
+
+		const TValueType		xx = x * x, yy = y * y, zz = z * z;
+		const TValueType		xy = x * y, xz = x * z, yz = y * z;
+		const TValueType		wx = w * x, wy = w * y, wz = w * z;
+
+		const TValueType		scaleX = scale.GetX(), scaleY = scale.GetY(), scaleZ = scale.GetZ();
+
+		TMatrixType				result;
+
+		// Rotation columns (same terms as Quaternion::RotationMatrix) times scale
+		result.m_values[0] = TRowType((one - two * (yy + zz)) * scaleX, two * (xy + wz) * scaleX, two * (xz - wy) * scaleX, zero);
+		result.m_values[1] = TRowType(two * (xy - wz) * scaleY, (one - two * (xx + zz)) * scaleY, two * (yz + wx) * scaleY, zero);
+		result.m_values[2] = TRowType(two * (xz + wy) * scaleZ, two * (yz - wx) * scaleZ, (one - two * (xx + yy)) * scaleZ, zero);
+		result.m_values[3] = TRowType(position.GetX(), position.GetY(), position.GetZ(), one);
+
+		return result;
+	}
+
+
+	template <CScalarType TValueType> constexpr
+	Matrix<4, TValueType> Matrix<4, TValueType>::TRS(
+		const Vector3<TValueType>& position,
+		const Vector3<TValueType>& angles,
+		const Vector3<TValueType>& scale
+	)
+	{
+		if constexpr (std::is_unsigned_v<TValueType> || std::is_integral_v<TValueType>)
+			throw std::logic_error("Cannot compute unsigned or integral rotation matrix");
+
+		else
+		{
+			TValueType				cosYaw, sinYaw, cosPitch, sinPitch, cosRoll, sinRoll;
+
+			SinCos(Radian<TValueType>(angles.GetZ()), sinYaw, cosYaw);
+			SinCos(Radian<TValueType>(angles.GetX()), sinPitch, cosPitch);
+			SinCos(Radian<TValueType>(angles.GetY()), sinRoll, cosRoll);
+
+			const TValueType		zero = static_cast<TValueType>(0);
+			const TValueType		scaleX = scale.GetX(), scaleY = scale.GetY(), scaleZ = scale.GetZ();
+
+			TMatrixType				result;
+
+			// RotationMatrix(angles) columns times scale
+			result.m_values[0] = TRowType
+			(
+				(cosYaw * cosRoll + sinYaw * sinPitch * sinRoll) * scaleX,
+				sinRoll * cosPitch * scaleX,
+				(-sinYaw * cosRoll + cosYaw * sinPitch * sinRoll) * scaleX,
+				zero
+			);
+
+			result.m_values[1] = TRowType
+			(
+				(-cosYaw * sinRoll + sinYaw * sinPitch * cosRoll) * scaleY,
+				cosRoll * cosPitch * scaleY,
+				(sinRoll * sinYaw + cosYaw * sinPitch * cosRoll) * scaleY,
+				zero
+			);
+
+			result.m_values[2] = TRowType
+			(
+				sinYaw * cosPitch * scaleZ,
+				-sinPitch * scaleZ,
+				cosYaw * cosPitch * scaleZ,
+				zero
+			);
+
+			result.m_values[3] = TRowType(position.GetX(), position.GetY(), position.GetZ(), static_cast<TValueType>(1));
+
+			return result;
+		}
+	}
+
+
+
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& Matrix<4, TValueType>::operator=(const Matrix<4, TValueType>& rhs)
 	{
 		for (uint8_t row = 0; row < 4; ++row)
@@ -488,7 +878,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& Matrix<4, TValueType>::operator=(const TValueType rhs[][4])
 	{
 		for (int row = 0; row < 4; ++row)
@@ -503,7 +893,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& Matrix<4, TValueType>::operator=(const TValueType rhs[16])
 	{
 		int		arrayIndex = 0;
@@ -520,7 +910,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::operator+(const Matrix<4, TValueType>& rhs) const
 	{
 		Matrix<4, TValueType>		result;
@@ -537,7 +927,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::operator-(const Matrix<4, TValueType>& rhs) const
 	{
 		Matrix<4, TValueType> result;
@@ -554,53 +944,58 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::operator*(const Matrix<4, TValueType>& rhs) const
 	{
 		Matrix<4, TValueType>		result;
 
-		for (int thisRow = 0; thisRow < 4; thisRow++)
+		// SIMD kernels are runtime only, constant evaluation uses the loop
+		if (!std::is_constant_evaluated())
 		{
-			for (int rightColumn = 0; rightColumn < 4; rightColumn++)
+#ifdef MTH_SIMD_SSE
+			// Run on 128-bit lanes, one column per register
+			if constexpr (std::is_same_v<TValueType, float>)
 			{
-				TValueType	currentNum = static_cast<TValueType>(0);
-
-				for (int rightRow = 0; rightRow < 4; rightRow++)
-				{
-					currentNum += m_values[rightRow][thisRow] * rhs[rightColumn][rightRow];
-				}
+				simd::MultiplyMatrix4(Data(), rhs.Data(), result.Data());
+				return result;
+			}
+#endif
 
-				result.m_values[rightColumn][thisRow] = currentNum;
+#ifdef MTH_SIMD_AVX
+			// Run on 256-bit lanes, one column per register
+			if constexpr (std::is_same_v<TValueType, double>)
+			{
+				simd::MultiplyMatrix4(Data(), rhs.Data(), result.Data());
+				return result;
 			}
+#endif
+		}
+
+		// Each result column is a combination of this matrix' columns,
+		// so whole columns are computed without indexed (checked) access
+		for (int rightColumn = 0; rightColumn < 4; rightColumn++)
+		{
+			const TRowType&	factors = rhs.m_values[rightColumn];
+
+			result.m_values[rightColumn] = m_values[0] * factors.GetX() + m_values[1] * factors.GetY() +
+										   m_values[2] * factors.GetZ() + m_values[3] * factors.GetW();
 		}
 
 		return result;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector4<TValueType> Matrix<4, TValueType>::operator*(const Vector4<TValueType>& rhs) const
 	{
-		Vector4<TValueType>		result;
-		TValueType				num;
-
-		for (int row = 0; row < 4; ++row)
-		{
-			num = static_cast<TValueType>(0);
-
-			for (int column = 0; column < 4; ++column)
-			{
-				num += m_values[row][column] * rhs[column];
-			}
-
-			result[row] = num;
-		}
-
-		return result;
+		// Columns weighted by the vector's components, same column-major
+		// convention as the matrix product and TransformPoints
+		return m_values[0] * rhs.GetX() + m_values[1] * rhs.GetY() +
+			   m_values[2] * rhs.GetZ() + m_values[3] * rhs.GetW();
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::operator*(TValueType rhs) const
 	{
 		Matrix<4, TValueType>		result;
@@ -617,14 +1012,14 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType> Matrix<4, TValueType>::operator/(TValueType rhs) const
 	{
 		return *this * (static_cast<TValueType>(1) / rhs);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& math::Matrix<4, TValueType>::operator+=(const Matrix<4, TValueType>& rhs)
 	{
 		for (int row = 0; row < 4; ++row)
@@ -639,7 +1034,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& math::Matrix<4, TValueType>::operator-=(const Matrix<4, TValueType>& rhs)
 	{
 		for (int row = 0; row < 4; ++row)
@@ -654,33 +1049,19 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& Matrix<4, TValueType>::operator*=(const Matrix<4, TValueType>& rhs)
 	{
-		Matrix<4, TValueType>		result;
-
-		for (int thisRow = 0; thisRow < 4; thisRow++)
-		{
-			for (int rightColumn = 0; rightColumn < 4; rightColumn++)
-			{
-				TValueType	currentNum = static_cast<TValueType>(0);
-
-				for (int rightRow = 0; rightRow < 4; rightRow++)
-				{
-					currentNum += m_values[thisRow][rightRow] * rhs[rightRow][rightColumn];
-				}
-
-				result.m_values[thisRow][rightColumn] = currentNum;
-			}
-		}
-
-		*this = result;
+		// Row-by-column product of this and rhs, which is
+		// rhs * this in column-major terms. Reuse operator*
+		// so this also goes through the SIMD path
+		*this = rhs * (*this);
 
 		return *this;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& Matrix<4, TValueType>::operator*=(TValueType rhs)
 	{
 		for (int row = 0; row < 4; ++row)
@@ -695,7 +1076,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Matrix<4, TValueType>& Matrix<4, TValueType>::operator/=(TValueType rhs)
 	{
 		*this *= (static_cast<TValueType>(1) / rhs);
@@ -704,7 +1085,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Matrix<4, TValueType>::operator==(const Matrix<4, TValueType>& rhs) const
 	{
 		for (int row = 0; row < 4; ++row)
@@ -720,29 +1101,47 @@ namespace math
 		return true;
 	}
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Matrix<4, TValueType>::operator!=(const Matrix<4, TValueType>& rhs) const
 	{
 		return !(*this == rhs);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Matrix<4, TValueType>::operator[](int index)
 	{
 		return m_values[index];
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Matrix<4, TValueType>::operator[](int index) const
 	{
 		return m_values[index];
 	}
 
 
+	template <CScalarType TValueType> inline
+	TValueType* Matrix<4, TValueType>::Data(void)
+	{
+		static_assert(sizeof(TRowType) == 4 * sizeof(TValueType), "Matrix4 rows must be tightly packed");
+
+		return reinterpret_cast<TValueType*>(m_values);
+	}
+
+
+	template <CScalarType TValueType> inline
+	const TValueType* Matrix<4, TValueType>::Data(void) const
+	{
+		static_assert(sizeof(TRowType) == 4 * sizeof(TValueType), "Matrix4 rows must be tightly packed");
+
+		return reinterpret_cast<const TValueType*>(m_values);
+	}
+
+
 	template<CScalarType TValueType>
-	inline  Matrix<4, TValueType>::operator Matrix3<TValueType>(void) const
+	constexpr  Matrix<4, TValueType>::operator Matrix3<TValueType>(void) const
 	{
 		Matrix3<TValueType> mat3;
 
@@ -761,9 +1160,283 @@ namespace math
 		return mat3;
 	}
 
+
+	template <CScalarType TValueType> inline
+	void TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+		std::type_identity_t<std::span<Vector3<TValueType>>> out
+	)
+	{
+		if (out.size() != points.size())
+			throw std::logic_error("Output span size does not match input");
+
+#ifdef MTH_SIMD_SSE
+		if constexpr (std::is_same_v<TValueType, float>)
+		{
+			static_assert(sizeof(Vector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+			simd::TransformVectors3(matrix.Data(), reinterpret_cast<const float*>(points.data()),
+									reinterpret_cast<float*>(out.data()), points.size(), 1.f);
+			return;
+		}
+#endif
+
+		// Column-major: values[column * 4 + row]
+		const TValueType*		values = matrix.Data();
+
+		for (std::size_t index = 0; index < points.size(); ++index)
+		{
+			const TValueType	x = points[index].GetX(), y = points[index].GetY(), z = points[index].GetZ();
+
+			out[index] = Vector3<TValueType>
+			(
+				values[0] * x + values[4] * y + values[8] * z + values[12],
+				values[1] * x + values[5] * y + values[9] * z + values[13],
+				values[2] * x + values[6] * y + values[10] * z + values[14]
+			);
+		}
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector3<TValueType>>> points
+	)
+	{
+		TransformPoints(matrix, std::span<const Vector3<TValueType>>(points), points);
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+		std::type_identity_t<std::span<Vector4<TValueType>>> out
+	)
+	{
+		if (out.size() != points.size())
+			throw std::logic_error("Output span size does not match input");
+
+#ifdef MTH_SIMD_SSE
+		if constexpr (std::is_same_v<TValueType, float>)
+		{
+			static_assert(sizeof(Vector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+			static_assert(sizeof(Vector4<float>) == 4 * sizeof(float), "Vector4 must be tightly packed");
+
+			simd::TransformPointsHomogeneous3(matrix.Data(), reinterpret_cast<const float*>(points.data()),
+											  reinterpret_cast<float*>(out.data()), points.size());
+			return;
+		}
+#endif
+
+		const TValueType*		values = matrix.Data();
+
+		for (std::size_t index = 0; index < points.size(); ++index)
+		{
+			const TValueType	x = points[index].GetX(), y = points[index].GetY(), z = points[index].GetZ();
+
+			out[index] = Vector4<TValueType>
+			(
+				values[0] * x + values[4] * y + values[8] * z + values[12],
+				values[1] * x + values[5] * y + values[9] * z + values[13],
+				values[2] * x + values[6] * y + values[10] * z + values[14],
+				values[3] * x + values[7] * y + values[11] * z + values[15]
+			);
+		}
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector4<TValueType>>> vectors,
+		std::type_identity_t<std::span<Vector4<TValueType>>> out
+	)
+	{
+		if (out.size() != vectors.size())
+			throw std::logic_error("Output span size does not match input");
+
+#ifdef MTH_SIMD_SSE
+		if constexpr (std::is_same_v<TValueType, float>)
+		{
+			static_assert(sizeof(Vector4<float>) == 4 * sizeof(float), "Vector4 must be tightly packed");
+
+			simd::TransformVectors4(matrix.Data(), reinterpret_cast<const float*>(vectors.data()),
+									reinterpret_cast<float*>(out.data()), vectors.size());
+			return;
+		}
+#endif
+
+		const TValueType*		values = matrix.Data();
+
+		for (std::size_t index = 0; index < vectors.size(); ++index)
+		{
+			const TValueType	x = vectors[index].GetX(), y = vectors[index].GetY();
+			const TValueType	z = vectors[index].GetZ(), w = vectors[index].GetW();
+
+			out[index] = Vector4<TValueType>
+			(
+				values[0] * x + values[4] * y + values[8] * z + values[12] * w,
+				values[1] * x + values[5] * y + values[9] * z + values[13] * w,
+				values[2] * x + values[6] * y + values[10] * z + values[14] * w,
+				values[3] * x + values[7] * y + values[11] * z + values[15] * w
+			);
+		}
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformPoints
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector4<TValueType>>> vectors
+	)
+	{
+		TransformPoints(matrix, std::span<const Vector4<TValueType>>(vectors), vectors);
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformDirections
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> directions,
+		std::type_identity_t<std::span<Vector3<TValueType>>> out
+	)
+	{
+		if (out.size() != directions.size())
+			throw std::logic_error("Output span size does not match input");
+
+#ifdef MTH_SIMD_SSE
+		if constexpr (std::is_same_v<TValueType, float>)
+		{
+			static_assert(sizeof(Vector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+			simd::TransformVectors3(matrix.Data(), reinterpret_cast<const float*>(directions.data()),
+									reinterpret_cast<float*>(out.data()), directions.size(), 0.f);
+			return;
+		}
+#endif
+
+		const TValueType*		values = matrix.Data();
+
+		for (std::size_t index = 0; index < directions.size(); ++index)
+		{
+			const TValueType	x = directions[index].GetX(), y = directions[index].GetY();
+			const TValueType	z = directions[index].GetZ();
+
+			// Skip translation column
+			out[index] = Vector3<TValueType>
+			(
+				values[0] * x + values[4] * y + values[8] * z,
+				values[1] * x + values[5] * y + values[9] * z,
+				values[2] * x + values[6] * y + values[10] * z
+			);
+		}
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformDirections
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector3<TValueType>>> directions
+	)
+	{
+		TransformDirections(matrix, std::span<const Vector3<TValueType>>(directions), directions);
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformPointsProjective
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+		std::type_identity_t<std::span<Vector3<TValueType>>> out
+	)
+	{
+		if (out.size() != points.size())
+			throw std::logic_error("Output span size does not match input");
+
+#ifdef MTH_SIMD_SSE
+		if constexpr (std::is_same_v<TValueType, float>)
+		{
+			static_assert(sizeof(Vector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+			simd::TransformPointsProjective3(matrix.Data(), reinterpret_cast<const float*>(points.data()),
+											 reinterpret_cast<float*>(out.data()), points.size());
+			return;
+		}
+#endif
+
+		const TValueType*		values = matrix.Data();
+
+		for (std::size_t index = 0; index < points.size(); ++index)
+		{
+			const TValueType	x = points[index].GetX(), y = points[index].GetY(), z = points[index].GetZ();
+
+			// Perspective divide, only divide once
+			const TValueType	invW = static_cast<TValueType>(1) /
+			(values[3] * x + values[7] * y + values[11] * z + values[15]);
+
+			out[index] = Vector3<TValueType>
+			(
+				(values[0] * x + values[4] * y + values[8] * z + values[12]) * invW,
+				(values[1] * x + values[5] * y + values[9] * z + values[13]) * invW,
+				(values[2] * x + values[6] * y + values[10] * z + values[14]) * invW
+			);
+		}
+	}
+
+
+	template <CScalarType TValueType> inline
+	void TransformPointsProjective
+	(
+		const Matrix4<TValueType>& matrix,
+		std::type_identity_t<std::span<Vector3<TValueType>>> points
+	)
+	{
+		TransformPointsProjective(matrix, std::span<const Vector3<TValueType>>(points), points);
+	}
+
+
+	template <CFloatingType TValueType> inline
+	void TRS
+	(
+		std::type_identity_t<std::span<const Vector3<TValueType>>> positions,
+		std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+		std::type_identity_t<std::span<const Vector3<TValueType>>> scales,
+		std::type_identity_t<std::span<Matrix4<TValueType>>> out
+	)
+	{
+		if (positions.size() != out.size() || rotations.size() != out.size() || scales.size() != out.size())
+			throw std::logic_error("Input span sizes do not match output");
+
+		for (std::size_t index = 0; index < out.size(); ++index)
+			out[index] = Matrix4<TValueType>::TRS(positions[index], rotations[index], scales[index]);
+	}
+
 }
 
 namespace lm = math;
 namespace LibMath = lm;
 
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+	extern template class Matrix<4, float>;
+	extern template class Matrix<4, double>;
+	extern template class Matrix<4, int32_t>;
+}
+
+#endif
+
 #endif
\ No newline at end of file
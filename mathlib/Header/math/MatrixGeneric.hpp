@@ -39,6 +39,15 @@ namespace math
     using Matrix4d = Matrix4<double>;
     using Matrix4i = Matrix4<int32_t>;
 
+
+    // 6x6 matrix (e.g. spatial inertia or covariance), implemented by
+    // the generic square matrix in MatrixN.hpp
+    template <CScalarType TValueType>
+    using Matrix6 = Matrix<6, TValueType>;
+
+    using Matrix6f = Matrix6<float>;
+    using Matrix6d = Matrix6<double>;
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,351 @@
+#ifndef __MATRIX_N_H__
+#define __MATRIX_N_H__
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "MathGeneric.hpp"
+#include "MatrixGeneric.hpp"
+#include "Arithmetic.hpp"
+
+#include "VectorN.hpp"
+#include "RectMatrix.hpp"
+
+namespace math
+{
+    // Generic square matrix, used for every size without a hand-written
+    // specialization (Matrix2, Matrix3 and Matrix4 keep theirs). Shares the
+    // storage and operators of RectMatrix, and adds the square-only ones
+    template <uint8_t TDimensions, CScalarType TValueType>
+    class Matrix : public RectMatrix<TDimensions, TDimensions, TValueType>
+    {
+    private:
+
+        using TBase = RectMatrix<TDimensions, TDimensions, TValueType>;
+        using TMatrixType = Matrix<TDimensions, TValueType>;
+
+        // Determinant and inverse need divisions, done in floating point
+        // for integral matrices
+        using TWorkType = std::conditional_t<std::is_floating_point_v<TValueType>, TValueType, double>;
+
+    public:
+
+        using TBase::TBase;
+
+        // Constructors / destructor
+
+        constexpr                   Matrix(void) = default;
+        constexpr                   Matrix(const TBase& other);
+        constexpr                   Matrix(const Matrix& other) = default;
+
+        constexpr                   ~Matrix(void) = default;
+
+        // Get this matrix' determinant (LU decomposition with partial pivoting)
+        constexpr TValueType        Determinant(void)                           const;
+
+        // Turn this matrix into an identity matrix with a given diagonal
+        constexpr void              Identity(TValueType diag = static_cast<TValueType>(1));
+
+        // Get inverse of this matrix (Gauss-Jordan elimination with partial
+        // pivoting). A singular matrix has no inverse, a zero matrix is returned
+        constexpr TMatrixType       Inverse(void)                               const;
+
+        // Get a transposed copy of this matrix
+        constexpr TMatrixType       Transpose(void)                             const;
+
+        constexpr TMatrixType&      operator=(const TMatrixType& rhs) = default;
+
+        // Matrix / matrix operators
+
+        using TBase::operator*;
+
+        constexpr TMatrixType       operator+(const TMatrixType& rhs)           const;
+        constexpr TMatrixType       operator-(const TMatrixType& rhs)           const;
+        constexpr TMatrixType       operator*(const TMatrixType& rhs)           const;
+
+        // Multiply all numbers of a copy of this matrix by a scalar factor
+        constexpr TMatrixType       operator*(TValueType factor)                const;
+
+        // Divide all numbers of a copy of this matrix by a scalar factor
+        constexpr TMatrixType       operator/(TValueType factor)                const;
+
+        // Matrix / matrix assignment operators
+
+        constexpr TMatrixType&      operator+=(const TMatrixType& rhs);
+        constexpr TMatrixType&      operator-=(const TMatrixType& rhs);
+        constexpr TMatrixType&      operator*=(const TMatrixType& rhs);
+
+        // Multiply all numbers of this matrix by a scalar factor
+        constexpr TMatrixType&      operator*=(TValueType factor);
+
+        // Divide all numbers of this matrix by a scalar factor
+        constexpr TMatrixType&      operator/=(TValueType factor);
+    };
+
+
+    // Multiply all numbers of a copy of a matrix by a scalar factor
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType>  operator*(TValueType lhs, const Matrix<TDimensions, TValueType>& rhs)
+        requires (TDimensions > 4);
+
+
+    // ---- Implementation ---
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType>::Matrix(const TBase& other)
+        : TBase(other)
+    {
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Matrix<TDimensions, TValueType>::Determinant(void) const
+    {
+        TWorkType       lu[TDimensions][TDimensions];
+        TWorkType       determinant = static_cast<TWorkType>(1);
+
+        for (int row = 0; row < TDimensions; ++row)
+        {
+            for (int column = 0; column < TDimensions; ++column)
+                lu[row][column] = static_cast<TWorkType>((*this)(row, column));
+        }
+
+        for (int pivot = 0; pivot < TDimensions; ++pivot)
+        {
+            // Largest value in this column to limit rounding errors
+            int     pivotRow = pivot;
+
+            for (int row = pivot + 1; row < TDimensions; ++row)
+            {
+                if (Absolute(lu[row][pivot]) > Absolute(lu[pivotRow][pivot]))
+                    pivotRow = row;
+            }
+
+            if (lu[pivotRow][pivot] == static_cast<TWorkType>(0))
+                return static_cast<TValueType>(0);
+
+            // Each row swap flips the determinant's sign
+            if (pivotRow != pivot)
+            {
+                std::swap(lu[pivotRow], lu[pivot]);
+                determinant = -determinant;
+            }
+
+            determinant *= lu[pivot][pivot];
+
+            const TWorkType     invPivot = static_cast<TWorkType>(1) / lu[pivot][pivot];
+
+            for (int row = pivot + 1; row < TDimensions; ++row)
+            {
+                const TWorkType     factor = lu[row][pivot] * invPivot;
+
+                for (int column = pivot + 1; column < TDimensions; ++column)
+                    lu[row][column] -= factor * lu[pivot][column];
+            }
+        }
+
+        // The determinant of an integral matrix is an integer, so round the
+        // floating point result instead of truncating it (4.9999 -> 5)
+        if constexpr (std::is_integral_v<TValueType>)
+        {
+            const TWorkType     half = static_cast<TWorkType>(0.5);
+
+            return static_cast<TValueType>(determinant < 0 ? determinant - half : determinant + half);
+        }
+
+        return static_cast<TValueType>(determinant);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    void Matrix<TDimensions, TValueType>::Identity(TValueType diag)
+    {
+        *this = Matrix(diag);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> Matrix<TDimensions, TValueType>::Inverse(void) const
+    {
+        if constexpr (std::is_unsigned<TValueType>::value)
+            throw std::logic_error("Cannot compute unsigned inverse matrix");
+
+        else
+        {
+            // Reduce [this | identity] to [identity | inverse], row by row
+            TWorkType       left[TDimensions][TDimensions];
+            TWorkType       right[TDimensions][TDimensions];
+
+            for (int row = 0; row < TDimensions; ++row)
+            {
+                for (int column = 0; column < TDimensions; ++column)
+                {
+                    left[row][column] = static_cast<TWorkType>((*this)(row, column));
+                    right[row][column] = static_cast<TWorkType>(row == column);
+                }
+            }
+
+            for (int pivot = 0; pivot < TDimensions; ++pivot)
+            {
+                int     pivotRow = pivot;
+
+                for (int row = pivot + 1; row < TDimensions; ++row)
+                {
+                    if (Absolute(left[row][pivot]) > Absolute(left[pivotRow][pivot]))
+                        pivotRow = row;
+                }
+
+                // Do not divide by zero
+                if (left[pivotRow][pivot] == static_cast<TWorkType>(0))
+                    return Matrix();
+
+                if (pivotRow != pivot)
+                {
+                    std::swap(left[pivotRow], left[pivot]);
+                    std::swap(right[pivotRow], right[pivot]);
+                }
+
+                // Only divide once per pivot
+                const TWorkType     invPivot = static_cast<TWorkType>(1) / left[pivot][pivot];
+
+                for (int column = 0; column < TDimensions; ++column)
+                {
+                    left[pivot][column] *= invPivot;
+                    right[pivot][column] *= invPivot;
+                }
+
+                for (int row = 0; row < TDimensions; ++row)
+                {
+                    const TWorkType     factor = left[row][pivot];
+
+                    if (row == pivot || factor == static_cast<TWorkType>(0))
+                        continue;
+
+                    for (int column = 0; column < TDimensions; ++column)
+                    {
+                        left[row][column] -= factor * left[pivot][column];
+                        right[row][column] -= factor * right[pivot][column];
+                    }
+                }
+            }
+
+            Matrix          result;
+
+            for (int row = 0; row < TDimensions; ++row)
+            {
+                for (int column = 0; column < TDimensions; ++column)
+                    result(row, column) = static_cast<TValueType>(right[row][column]);
+            }
+
+            return result;
+        }
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> Matrix<TDimensions, TValueType>::Transpose(void) const
+    {
+        return TBase::Transpose();
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> Matrix<TDimensions, TValueType>::operator+(const TMatrixType& rhs) const
+    {
+        return TBase::operator+(rhs);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> Matrix<TDimensions, TValueType>::operator-(const TMatrixType& rhs) const
+    {
+        return TBase::operator-(rhs);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> Matrix<TDimensions, TValueType>::operator*(const TMatrixType& rhs) const
+    {
+        return TBase::operator*(static_cast<const TBase&>(rhs));
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> Matrix<TDimensions, TValueType>::operator*(TValueType factor) const
+    {
+        return TBase::operator*(factor);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> Matrix<TDimensions, TValueType>::operator/(TValueType factor) const
+    {
+        return TBase::operator/(factor);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType>& Matrix<TDimensions, TValueType>::operator+=(const TMatrixType& rhs)
+    {
+        TBase::operator+=(rhs);
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType>& Matrix<TDimensions, TValueType>::operator-=(const TMatrixType& rhs)
+    {
+        TBase::operator-=(rhs);
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType>& Matrix<TDimensions, TValueType>::operator*=(const TMatrixType& rhs)
+    {
+        // The product reads this matrix, write it back once done
+        return *this = *this * rhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType>& Matrix<TDimensions, TValueType>::operator*=(TValueType factor)
+    {
+        TBase::operator*=(factor);
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType>& Matrix<TDimensions, TValueType>::operator/=(TValueType factor)
+    {
+        TBase::operator/=(factor);
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Matrix<TDimensions, TValueType> operator*(TValueType lhs, const Matrix<TDimensions, TValueType>& rhs)
+        requires (TDimensions > 4)
+    {
+        return rhs * lhs;
+    }
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class Matrix<6, float>;
+    extern template class Matrix<6, double>;
+    extern template class Matrix<6, int32_t>;
+}
+
+#endif
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
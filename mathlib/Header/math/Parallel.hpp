@@ -0,0 +1,495 @@
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "MathGeneric.hpp"
+
+#include "Vector3.hpp"
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+#include "Quaternion.hpp"
+#include "Affine3.hpp"
+#include "DualQuaternion.hpp"
+
+// Task-parallel layer for batch functions. Work is cut into fixed chunks
+// of grain elements ([0, grain), [grain, 2 * grain)...), and threads take
+// the next free chunk until none is left. Chunk boundaries only depend on
+// the grain, and every batch function computes each element on its own,
+// so results are the same whatever the number of threads
+
+namespace math::parallel
+{
+    // Elements per chunk when none is given. Large enough to hide the cost
+    // of handing out a chunk, small enough to balance the load
+    constexpr std::size_t       DefaultGrain = 1024;
+
+
+    // Fixed set of worker threads. The thread calling For also works on
+    // the chunks, then waits for the workers to finish theirs
+    class ThreadPool
+    {
+    public:
+
+        // threadCount includes the calling thread, 1 runs everything inline
+        explicit                ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency());
+                                ThreadPool(const ThreadPool&) = delete;
+
+                                ~ThreadPool(void);
+
+        // Call function(begin, end) for each chunk of [0, count).
+        // Blocks until all chunks are done. The first exception thrown
+        // by function is rethrown here, remaining chunks are skipped.
+        // Calls from inside a chunk run inline on the current thread
+        template <typename TFunction>
+        void                    For(std::size_t count, std::size_t grain, TFunction&& function);
+
+        // Number of threads working on each call, including the caller
+        std::size_t             ThreadCount(void)                           const;
+
+        // Shared pool with one thread per hardware thread
+        static ThreadPool&      Default(void);
+
+        ThreadPool&             operator=(const ThreadPool&) = delete;
+
+    private:
+
+        struct Job
+        {
+            void                        (*m_invoke)(void*, std::size_t, std::size_t);
+            void*                       m_function;
+            std::size_t                 m_count;
+            std::size_t                 m_grain;
+            std::atomic<std::size_t>    m_next{ 0 };
+
+            std::mutex                  m_errorMutex;
+            std::exception_ptr          m_error;
+        };
+
+        void                    WorkerLoop(void);
+        void                    Run(Job& job);
+
+        // Wake the workers up to exit and join them
+        void                    Stop(void);
+
+        static bool&            InsideChunk(void);
+
+        std::vector<std::thread>        m_workers;
+
+        // Only one job at a time
+        std::mutex                      m_submitMutex;
+
+        std::mutex                      m_mutex;
+        std::condition_variable         m_wake;
+        std::condition_variable         m_done;
+
+        Job*                            m_job = nullptr;
+        std::uint64_t                   m_generation = 0;
+        std::size_t                     m_running = 0;
+        bool                            m_stop = false;
+    };
+
+
+    // ThreadPool::Default().For
+    template <typename TFunction>
+    void                For(std::size_t count, std::size_t grain, TFunction&& function);
+
+
+    // Parallel versions of batch functions, see the serial ones for details.
+    // Sizes are checked before any work is started
+
+    template <CScalarType TValueType>
+    void                TransformPoints(const Matrix4<TValueType>& matrix,
+                                        std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+                                        std::type_identity_t<std::span<Vector3<TValueType>>> out,
+                                        std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+    template <CScalarType TValueType>
+    void                TransformDirections(const Matrix4<TValueType>& matrix,
+                                            std::type_identity_t<std::span<const Vector3<TValueType>>> directions,
+                                            std::type_identity_t<std::span<Vector3<TValueType>>> out,
+                                            std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+    template <CFloatingType TValueType>
+    void                RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                         std::type_identity_t<std::span<Matrix3<TValueType>>> out,
+                                         std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+    template <CFloatingType TValueType>
+    void                RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                         std::type_identity_t<std::span<Matrix4<TValueType>>> out,
+                                         std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+    template <CFloatingType TValueType>
+    void                RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                         std::type_identity_t<std::span<Affine3<TValueType>>> out,
+                                         std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+    template <CFloatingType TValueType>
+    void                TransformMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                          std::type_identity_t<std::span<const Vector3<TValueType>>> translations,
+                                          std::type_identity_t<std::span<Affine3<TValueType>>> out,
+                                          std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+    template <CFloatingType TValueType>
+    void                TRS(std::type_identity_t<std::span<const Vector3<TValueType>>> positions,
+                            std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                            std::type_identity_t<std::span<const Vector3<TValueType>>> scales,
+                            std::type_identity_t<std::span<Matrix4<TValueType>>> out,
+                            std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+    // Dual quaternion skinning, grain is a number of vertices
+    template <CFloatingType TValueType>
+    void                Blend(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> palette,
+                              std::span<const std::uint32_t> indices,
+                              std::type_identity_t<std::span<const TValueType>> weights,
+                              std::type_identity_t<std::span<DualQuaternion<TValueType>>> out,
+                              std::size_t grain = DefaultGrain, ThreadPool& pool = ThreadPool::Default());
+
+
+    inline ThreadPool::ThreadPool(std::size_t threadCount)
+    {
+        // hardware_concurrency may be unknown (0)
+        const std::size_t       workerCount = (threadCount > 1) ? threadCount - 1 : 0;
+
+        m_workers.reserve(workerCount);
+
+        // Workers already started must be joined if creating another one
+        // fails, destroying a joinable thread terminates the program
+        try
+        {
+            for (std::size_t worker = 0; worker < workerCount; ++worker)
+                m_workers.emplace_back([this] { WorkerLoop(); });
+        }
+        catch (...)
+        {
+            Stop();
+            throw;
+        }
+    }
+
+
+    inline ThreadPool::~ThreadPool(void)
+    {
+        Stop();
+    }
+
+
+    inline void ThreadPool::Stop(void)
+    {
+        {
+            std::lock_guard     lock(m_mutex);
+
+            m_stop = true;
+        }
+
+        m_wake.notify_all();
+
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+
+    template <typename TFunction> inline
+    void ThreadPool::For(std::size_t count, std::size_t grain, TFunction&& function)
+    {
+        if (count == 0)
+            return;
+
+        if (grain == 0)
+            throw std::logic_error("Grain size must not be zero");
+
+        // Nothing to share, or already inside a chunk of this or another
+        // pool (waiting on a pool from one of its workers could deadlock).
+        // Same chunks, in order on this thread
+        if (m_workers.empty() || count <= grain || InsideChunk())
+        {
+            for (std::size_t begin = 0; begin < count; begin += grain)
+                function(begin, std::min(begin + grain, count));
+
+            return;
+        }
+
+        using TFunctionType = std::remove_reference_t<TFunction>;
+
+        Job     job;
+
+        job.m_invoke = [](void* callable, std::size_t begin, std::size_t end)
+        {
+            (*static_cast<TFunctionType*>(callable))(begin, end);
+        };
+
+        job.m_function = const_cast<void*>(static_cast<const void*>(std::addressof(function)));
+        job.m_count = count;
+        job.m_grain = grain;
+
+        std::lock_guard     submitLock(m_submitMutex);
+
+        {
+            std::lock_guard     lock(m_mutex);
+
+            m_job = &job;
+            m_running = m_workers.size();
+            ++m_generation;
+        }
+
+        m_wake.notify_all();
+        Run(job);
+
+        {
+            // The job lives on this stack, wait until no worker uses it
+            std::unique_lock    lock(m_mutex);
+
+            m_done.wait(lock, [this] { return m_running == 0; });
+            m_job = nullptr;
+        }
+
+        if (job.m_error)
+            std::rethrow_exception(job.m_error);
+    }
+
+
+    inline std::size_t ThreadPool::ThreadCount(void) const
+    {
+        return m_workers.size() + 1;
+    }
+
+
+    inline ThreadPool& ThreadPool::Default(void)
+    {
+        static ThreadPool       pool;
+
+        return pool;
+    }
+
+
+    inline void ThreadPool::WorkerLoop(void)
+    {
+        std::uint64_t       generation = 0;
+
+        for (;;)
+        {
+            Job*    job;
+
+            {
+                std::unique_lock    lock(m_mutex);
+
+                m_wake.wait(lock, [&] { return m_stop || m_generation != generation; });
+
+                if (m_stop)
+                    return;
+
+                generation = m_generation;
+                job = m_job;
+            }
+
+            Run(*job);
+
+            {
+                std::lock_guard     lock(m_mutex);
+
+                if (--m_running == 0)
+                    m_done.notify_one();
+            }
+        }
+    }
+
+
+    inline void ThreadPool::Run(Job& job)
+    {
+        bool&       insideChunk = InsideChunk();
+
+        insideChunk = true;
+
+        for (;;)
+        {
+            const std::size_t   begin = job.m_next.fetch_add(job.m_grain, std::memory_order_relaxed);
+
+            if (begin >= job.m_count)
+                break;
+
+            try
+            {
+                job.m_invoke(job.m_function, begin, std::min(begin + job.m_grain, job.m_count));
+            }
+            catch (...)
+            {
+                std::lock_guard     lock(job.m_errorMutex);
+
+                if (!job.m_error)
+                    job.m_error = std::current_exception();
+
+                // Do not hand out any more chunks
+                job.m_next.store(job.m_count, std::memory_order_relaxed);
+            }
+        }
+
+        insideChunk = false;
+    }
+
+
+    inline bool& ThreadPool::InsideChunk(void)
+    {
+        thread_local bool       insideChunk = false;
+
+        return insideChunk;
+    }
+
+
+    template <typename TFunction> inline
+    void For(std::size_t count, std::size_t grain, TFunction&& function)
+    {
+        ThreadPool::Default().For(count, grain, std::forward<TFunction>(function));
+    }
+
+
+    template <CScalarType TValueType> inline
+    void TransformPoints(const Matrix4<TValueType>& matrix,
+                         std::type_identity_t<std::span<const Vector3<TValueType>>> points,
+                         std::type_identity_t<std::span<Vector3<TValueType>>> out,
+                         std::size_t grain, ThreadPool& pool)
+    {
+        if (points.size() != out.size())
+            throw std::logic_error("Output span size does not match input");
+
+        pool.For(out.size(), grain, [&](std::size_t begin, std::size_t end)
+        {
+            math::TransformPoints(matrix, points.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        });
+    }
+
+
+    template <CScalarType TValueType> inline
+    void TransformDirections(const Matrix4<TValueType>& matrix,
+                             std::type_identity_t<std::span<const Vector3<TValueType>>> directions,
+                             std::type_identity_t<std::span<Vector3<TValueType>>> out,
+                             std::size_t grain, ThreadPool& pool)
+    {
+        if (directions.size() != out.size())
+            throw std::logic_error("Output span size does not match input");
+
+        pool.For(out.size(), grain, [&](std::size_t begin, std::size_t end)
+        {
+            math::TransformDirections(matrix, directions.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        });
+    }
+
+
+    namespace detail
+    {
+        // Same split for all matrix types
+        template <CFloatingType TValueType, typename TMatrixType> inline
+        void RotationMatrices(std::span<const Quaternion<TValueType>> rotations, std::span<TMatrixType> out,
+                              std::size_t grain, ThreadPool& pool)
+        {
+            if (rotations.size() != out.size())
+                throw std::logic_error("Output span size does not match input");
+
+            pool.For(out.size(), grain, [&](std::size_t begin, std::size_t end)
+            {
+                math::RotationMatrices<TValueType>(rotations.subspan(begin, end - begin),
+                                                   out.subspan(begin, end - begin));
+            });
+        }
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                          std::type_identity_t<std::span<Matrix3<TValueType>>> out, std::size_t grain, ThreadPool& pool)
+    {
+        detail::RotationMatrices(rotations, out, grain, pool);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                          std::type_identity_t<std::span<Matrix4<TValueType>>> out, std::size_t grain, ThreadPool& pool)
+    {
+        detail::RotationMatrices(rotations, out, grain, pool);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                          std::type_identity_t<std::span<Affine3<TValueType>>> out, std::size_t grain, ThreadPool& pool)
+    {
+        detail::RotationMatrices(rotations, out, grain, pool);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                           std::type_identity_t<std::span<const Vector3<TValueType>>> translations,
+                           std::type_identity_t<std::span<Affine3<TValueType>>> out,
+                           std::size_t grain, ThreadPool& pool)
+    {
+        if (rotations.size() != out.size() || translations.size() != out.size())
+            throw std::logic_error("Input span sizes do not match output");
+
+        pool.For(out.size(), grain, [&](std::size_t begin, std::size_t end)
+        {
+            math::TransformMatrices<TValueType>(rotations.subspan(begin, end - begin),
+                                                translations.subspan(begin, end - begin),
+                                                out.subspan(begin, end - begin));
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TRS(std::type_identity_t<std::span<const Vector3<TValueType>>> positions,
+             std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+             std::type_identity_t<std::span<const Vector3<TValueType>>> scales,
+             std::type_identity_t<std::span<Matrix4<TValueType>>> out, std::size_t grain, ThreadPool& pool)
+    {
+        if (positions.size() != out.size() || rotations.size() != out.size() || scales.size() != out.size())
+            throw std::logic_error("Input span sizes do not match output");
+
+        pool.For(out.size(), grain, [&](std::size_t begin, std::size_t end)
+        {
+            const std::size_t   size = end - begin;
+
+            math::TRS<TValueType>(positions.subspan(begin, size), rotations.subspan(begin, size),
+                                  scales.subspan(begin, size), out.subspan(begin, size));
+        });
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void Blend(std::type_identity_t<std::span<const DualQuaternion<TValueType>>> palette,
+               std::span<const std::uint32_t> indices,
+               std::type_identity_t<std::span<const TValueType>> weights,
+               std::type_identity_t<std::span<DualQuaternion<TValueType>>> out, std::size_t grain, ThreadPool& pool)
+    {
+        const std::size_t   influences = out.empty() ? 0 : weights.size() / out.size();
+
+        if (indices.size() != weights.size() || weights.size() != out.size() * influences ||
+            (!out.empty() && influences == 0))
+            throw std::logic_error("Input span sizes do not match output");
+
+        pool.For(out.size(), grain, [&](std::size_t begin, std::size_t end)
+        {
+            const std::size_t   size = end - begin;
+
+            math::Blend<TValueType>(palette, indices.subspan(begin * influences, size * influences),
+                                    weights.subspan(begin * influences, size * influences), out.subspan(begin, size));
+        });
+    }
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -2,10 +2,12 @@
 #define __QUATERNION_H__
 
 #include <numeric>
+#include <span>
 
 #include "Vector3.hpp"
 #include "MathGeneric.hpp"
 #include "Arithmetic.hpp"
+#include "FastMath.hpp"
 #include "Matrix4.hpp"
 #include "Trigonometry.hpp"
 #include "Interpolation.hpp"
@@ -42,9 +44,20 @@ namespace math
 
         void		Normalize(void);
 
+        // Approximate Normalize from a reciprocal square root estimate,
+        // see FastMath.hpp for precision tiers
+        template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+        void		NormalizeFast(void);
+
+        template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+        Quaternion	NormalizedFast(void)	const;
+
         
         Matrix4<TValueType> RotationMatrix(void)	const;
 
+        // Upper 3x3 part of RotationMatrix
+        Matrix3<TValueType> RotationMatrix3(void)	const;
+
 
         Vector3<TValueType> Rotate(const Vector3<TValueType>& vector)   const;
         Vector3<TValueType> EulerAngles(void) const;
@@ -71,8 +84,24 @@ namespace math
         Quaternion	operator-(void)					  const;
 
         static Quaternion  Slerp(const Quaternion& q1, const Quaternion& q2, TValueType ration);
+
+        // Normalized lerp along the shortest path, constant speed is not kept
+        static Quaternion  Nlerp(const Quaternion& q1, const Quaternion& q2, TValueType ratio);
+
+        // Slerp without trigonometry, for ratio in [0, 1]. The weights are
+        // polynomials in cos(angle) (Eberly, "A Fast and Accurate Algorithm
+        // for Computing SLERP"), within 3e-5 of Slerp
+        static Quaternion  SlerpFast(const Quaternion& q1, const Quaternion& q2, TValueType ratio);
         static Quaternion  Identity(void);
 
+        // Get rotation from the columns of an orthonormal basis (Shepperd's method)
+        static Quaternion  FromAxes(const Vector3<TValueType>& axisX, const Vector3<TValueType>& axisY,
+                                    const Vector3<TValueType>& axisZ);
+
+        // Get rotation from the upper 3x3 part of a rotation matrix (no scale)
+        static Quaternion  FromRotationMatrix(const Matrix3<TValueType>& matrix);
+        static Quaternion  FromRotationMatrix(const Matrix4<TValueType>& matrix);
+
 
         TValueType	GetW() const { return m_w; }
         TValueType	GetX() const { return m_x; }
@@ -106,9 +135,71 @@ namespace math
     template <CFloatingType TValueType>
     Matrix4<TValueType> TransformMatrix(const Quaternion<TValueType>& rotation, const Vector3<TValueType>& translation, const Vector3<TValueType>& scale);
 
+    // Split a TRS matrix into translation, rotation and scale. Negative
+    // determinants are given a negative X scale, shear is not supported
+    template <CFloatingType TValueType>
+    void                Decompose(const Matrix4<TValueType>& matrix, Vector3<TValueType>& translation,
+                                  Quaternion<TValueType>& rotation, Vector3<TValueType>& scale);
+
     template <CFloatingType TValueType>
     TValueType			Dot(const Quaternion<TValueType>& q1, const Quaternion<TValueType>& q2);
 
+    // Blend two arrays of quaternions with the same ratio, see Quaternion::Nlerp.
+    // All spans must have the same size, out may be the same memory as from or to
+    template <CFloatingType TValueType>
+    void                Nlerp(std::type_identity_t<std::span<const Quaternion<TValueType>>> from,
+                              std::type_identity_t<std::span<const Quaternion<TValueType>>> to,
+                              TValueType ratio, std::type_identity_t<std::span<Quaternion<TValueType>>> out);
+
+    // Blend two arrays of quaternions with the same ratio, see Quaternion::SlerpFast
+    template <CFloatingType TValueType>
+    void                SlerpFast(std::type_identity_t<std::span<const Quaternion<TValueType>>> from,
+                                  std::type_identity_t<std::span<const Quaternion<TValueType>>> to,
+                                  TValueType ratio, std::type_identity_t<std::span<Quaternion<TValueType>>> out);
+
+    // Convert an array of quaternions to rotation matrices (see RotationMatrix).
+    // Both spans must have the same size. The type is deduced from the output
+    // span, the float and double overloads also take containers directly
+    template <CFloatingType TValueType>
+    void                RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                         std::span<Matrix3<TValueType>> out);
+
+    template <CFloatingType TValueType>
+    void                RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                                         std::span<Matrix4<TValueType>> out);
+
+    inline void         RotationMatrices(std::span<const Quaternion<float>> rotations, std::span<Matrix3<float>> out);
+    inline void         RotationMatrices(std::span<const Quaternion<double>> rotations, std::span<Matrix3<double>> out);
+    inline void         RotationMatrices(std::span<const Quaternion<float>> rotations, std::span<Matrix4<float>> out);
+    inline void         RotationMatrices(std::span<const Quaternion<double>> rotations, std::span<Matrix4<double>> out);
+
+    // Rotate an array of vectors by the same quaternion. Large arrays are
+    // rotated by its matrix instead (see TransformDirections).
+    // out may be the same memory as vectors
+    template <CFloatingType TValueType>
+    void                Rotate(const Quaternion<TValueType>& rotation,
+                               std::type_identity_t<std::span<const Vector3<TValueType>>> vectors,
+                               std::type_identity_t<std::span<Vector3<TValueType>>> out);
+
+    // Rotate an array of vectors in place
+    template <CFloatingType TValueType>
+    void                Rotate(const Quaternion<TValueType>& rotation,
+                               std::type_identity_t<std::span<Vector3<TValueType>>> vectors);
+
+    namespace fast
+    {
+        // Renormalize every quaternion of an array in place, see NormalizeFast.
+        // The float and double overloads take spans or containers directly
+        template <EPrecision TPrecision = EPrecision::MEDIUM, CFloatingType TValueType>
+        void			Normalize(std::type_identity_t<std::span<Quaternion<TValueType>>> quaternions);
+
+        template <EPrecision TPrecision = EPrecision::MEDIUM>
+        void			Normalize(std::span<Quaternion<float>> quaternions);
+
+        template <EPrecision TPrecision = EPrecision::MEDIUM>
+        void			Normalize(std::span<Quaternion<double>> quaternions);
+    }
+
     using Quatf = Quaternion<float>;
     using Quatd = Quaternion<double>;
 
@@ -146,9 +237,11 @@ namespace math
         angleY *= (TValueType) 0.5;
         angleZ *= (TValueType) 0.5;
 
-        TValueType cosX = Cos(angleX), sinX = Sin(angleX);
-        TValueType cosY = Cos(angleY), sinY = Sin(angleY);
-        TValueType cosZ = Cos(angleZ), sinZ = Sin(angleZ);
+        TValueType cosX, sinX, cosY, sinY, cosZ, sinZ;
+
+        SinCos(angleX, sinX, cosX);
+        SinCos(angleY, sinY, cosY);
+        SinCos(angleZ, sinZ, cosZ);
 
         m_w = cosX * cosY * cosZ + sinX * sinY * sinZ;
         m_x = sinX * cosY * cosZ - cosX * sinY * sinZ;
@@ -195,37 +288,68 @@ namespace math
     }
 
     template<CFloatingType TValueType>
-    inline Matrix4<TValueType> Quaternion<TValueType>::RotationMatrix(void) const
+    template<fast::EPrecision TPrecision>
+    inline void Quaternion<TValueType>::NormalizeFast(void)
     {
+        TValueType lengthDiv = fast::InverseSquareRoot<TPrecision>(LengthSquared());
 
-        Matrix4<TValueType> mat;
-        TValueType	 xSqr = m_x * m_x, ySqr = m_y * m_y, zSqr = m_z * m_z;
-        TValueType	 wSqr = m_w * m_w;
+        m_w *= lengthDiv;
+        m_x *= lengthDiv;
+        m_y *= lengthDiv;
+        m_z *= lengthDiv;
+    }
 
-        mat[0][0] = wSqr + xSqr - ySqr - zSqr;
-        mat[0][1] = 2 * (m_x * m_y) + 2 * (m_w * m_z);
-        mat[0][2] = 2 * (m_x * m_z) - 2 * (m_w * m_y);
-        mat[0][3] = 0.f;
+    template<CFloatingType TValueType>
+    template<fast::EPrecision TPrecision>
+    inline Quaternion<TValueType> Quaternion<TValueType>::NormalizedFast(void) const
+    {
+        Quaternion<TValueType>		copy(*this);
 
-        mat[1][0] = 2 * (m_x * m_y) - 2 * (m_w * m_z);
-        mat[1][1] = wSqr - xSqr + ySqr - zSqr;
-        mat[1][2] = 2 * (m_y * m_z) + 2 * (m_w * m_x);
-        mat[1][3] = 0.f;
+        copy.template NormalizeFast<TPrecision>();
+        return copy;
+    }
 
-        mat[2][0] = 2 * (m_x * m_z) + 2 * (m_w * m_y);
-        mat[2][1] = 2 * (m_y * m_z) - 2 * (m_w * m_x);
-        mat[2][2] = wSqr - xSqr - ySqr + zSqr;
-        mat[2][3] = 0.f;
+    template<CFloatingType TValueType>
+    inline Matrix4<TValueType> Quaternion<TValueType>::RotationMatrix(void) const
+    {
+        const TValueType    zero = static_cast<TValueType>(0), one = static_cast<TValueType>(1);
+        const TValueType    two = static_cast<TValueType>(2);
 
-        mat[3][0] = 0.f;
-        mat[3][1] = 0.f;
-        mat[3][2] = 0.f;
-        mat[3][3] = 1.f;
+        const TValueType    ww = m_w * m_w, xx = m_x * m_x, yy = m_y * m_y, zz = m_z * m_z;
+        const TValueType    xy = m_x * m_y, xz = m_x * m_z, yz = m_y * m_z;
+        const TValueType    wx = m_w * m_x, wy = m_w * m_y, wz = m_w * m_z;
+
+        Matrix4<TValueType> mat;
+
+        // Whole columns, element access is bound checked
+        mat[0] = Vector4<TValueType>(ww + xx - yy - zz, two * (xy + wz), two * (xz - wy), zero);
+        mat[1] = Vector4<TValueType>(two * (xy - wz), ww - xx + yy - zz, two * (yz + wx), zero);
+        mat[2] = Vector4<TValueType>(two * (xz + wy), two * (yz - wx), ww - xx - yy + zz, zero);
+        mat[3] = Vector4<TValueType>(zero, zero, zero, one);
 
         return mat;
     }
 
 
+    template<CFloatingType TValueType>
+    inline Matrix3<TValueType> Quaternion<TValueType>::RotationMatrix3(void) const
+    {
+        const TValueType    two = static_cast<TValueType>(2);
+
+        const TValueType    ww = m_w * m_w, xx = m_x * m_x, yy = m_y * m_y, zz = m_z * m_z;
+        const TValueType    xy = m_x * m_y, xz = m_x * m_z, yz = m_y * m_z;
+        const TValueType    wx = m_w * m_x, wy = m_w * m_y, wz = m_w * m_z;
+
+        Matrix3<TValueType> matrix;
+
+        // Same terms as RotationMatrix
+        matrix[0] = Vector3<TValueType>(ww + xx - yy - zz, two * (xy + wz), two * (xz - wy));
+        matrix[1] = Vector3<TValueType>(two * (xy - wz), ww - xx + yy - zz, two * (yz + wx));
+        matrix[2] = Vector3<TValueType>(two * (xz + wy), two * (yz - wx), ww - xx - yy + zz);
+
+        return matrix;
+    }
+
 
     template<CFloatingType TValueType>
     inline Vector3<TValueType> Quaternion<TValueType>::Rotate(const Vector3<TValueType>& vector) const
@@ -327,12 +451,151 @@ namespace math
 
     }
 
+    template<CFloatingType TValueType>
+    inline Quaternion<TValueType> Quaternion<TValueType>::Nlerp(const Quaternion<TValueType>& q1, const Quaternion<TValueType>& q2, TValueType ratio)
+    {
+        const TValueType coefQ2 = (Dot(q1, q2) < static_cast<TValueType>(0)) ? -ratio : ratio;
+        const TValueType coefQ1 = static_cast<TValueType>(1) - ratio;
+
+        return Quaternion<TValueType>(
+            coefQ1 * q1.m_w + coefQ2 * q2.m_w,
+            coefQ1 * q1.m_x + coefQ2 * q2.m_x,
+            coefQ1 * q1.m_y + coefQ2 * q2.m_y,
+            coefQ1 * q1.m_z + coefQ2 * q2.m_z
+        ).Normalized();
+    }
+
+    template<CFloatingType TValueType>
+    inline Quaternion<TValueType> Quaternion<TValueType>::SlerpFast(const Quaternion<TValueType>& q1, const Quaternion<TValueType>& q2, TValueType ratio)
+    {
+        // sin(t a) / sin(a) = t (1 + b1 (1 + b2 (1 + ...))) with
+        // bi = (ui t^2 - vi) (cos(a) - 1), ui = 1 / (i (2i + 1)), vi = i / (2i + 1).
+        // Eight terms, the last one scaled by mu to absorb the truncation
+        constexpr TValueType mu = static_cast<TValueType>(1.85298109240830);
+
+        constexpr TValueType u[8] =
+        {
+            static_cast<TValueType>(1) / (1 * 3), static_cast<TValueType>(1) / (2 * 5),
+            static_cast<TValueType>(1) / (3 * 7), static_cast<TValueType>(1) / (4 * 9),
+            static_cast<TValueType>(1) / (5 * 11), static_cast<TValueType>(1) / (6 * 13),
+            static_cast<TValueType>(1) / (7 * 15), mu / (8 * 17)
+        };
+
+        constexpr TValueType v[8] =
+        {
+            static_cast<TValueType>(1) / 3, static_cast<TValueType>(2) / 5,
+            static_cast<TValueType>(3) / 7, static_cast<TValueType>(4) / 9,
+            static_cast<TValueType>(5) / 11, static_cast<TValueType>(6) / 13,
+            static_cast<TValueType>(7) / 15, mu * 8 / 17
+        };
+
+        const TValueType one = static_cast<TValueType>(1);
+
+        TValueType cosAngle = Dot(q1, q2);
+
+        const TValueType sign = (cosAngle < static_cast<TValueType>(0)) ? -one : one;
+
+        cosAngle *= sign;
+
+        const TValueType cosMinusOne = cosAngle - one;
+        const TValueType inverseRatio = one - ratio;
+        const TValueType ratioSquared = ratio * ratio, inverseSquared = inverseRatio * inverseRatio;
+
+        TValueType seriesQ1 = one, seriesQ2 = one;
+
+        for (int term = 7; term >= 0; --term)
+        {
+            seriesQ1 = one + (u[term] * inverseSquared - v[term]) * cosMinusOne * seriesQ1;
+            seriesQ2 = one + (u[term] * ratioSquared - v[term]) * cosMinusOne * seriesQ2;
+        }
+
+        const TValueType coefQ1 = inverseRatio * seriesQ1;
+        const TValueType coefQ2 = ratio * seriesQ2 * sign;
+
+        return Quaternion<TValueType>(
+            coefQ1 * q1.m_w + coefQ2 * q2.m_w,
+            coefQ1 * q1.m_x + coefQ2 * q2.m_x,
+            coefQ1 * q1.m_y + coefQ2 * q2.m_y,
+            coefQ1 * q1.m_z + coefQ2 * q2.m_z
+        );
+    }
+
     template<CFloatingType TValueType>
     inline Quaternion<TValueType> Quaternion<TValueType>::Identity(void)
     {
         return Quaternion(1.f, 0.f, 0.f, 0.f);
     }
 
+    template<CFloatingType TValueType>
+    inline Quaternion<TValueType> Quaternion<TValueType>::FromAxes(const Vector3<TValueType>& axisX,
+                                                                   const Vector3<TValueType>& axisY,
+                                                                   const Vector3<TValueType>& axisZ)
+    {
+        // Shepperd's method: take the square root of the largest of
+        // 4w^2, 4x^2, 4y^2 and 4z^2 so the divisions stay well conditioned,
+        // then get the other components from off-diagonal sums and differences
+        const TValueType    m00 = axisX.GetX(), m11 = axisY.GetY(), m22 = axisZ.GetZ();
+        const TValueType    one = static_cast<TValueType>(1), half = static_cast<TValueType>(0.5);
+        const TValueType    trace = m00 + m11 + m22;
+
+        if (trace > m00 && trace > m11 && trace > m22)
+        {
+            const TValueType    root = SquareRoot(trace + one);
+            const TValueType    factor = half / root;
+
+            return Quaternion<TValueType>(root * half,
+                                          (axisY.GetZ() - axisZ.GetY()) * factor,
+                                          (axisZ.GetX() - axisX.GetZ()) * factor,
+                                          (axisX.GetY() - axisY.GetX()) * factor);
+        }
+
+        if (m00 > m11 && m00 > m22)
+        {
+            const TValueType    root = SquareRoot(one + m00 - m11 - m22);
+            const TValueType    factor = half / root;
+
+            return Quaternion<TValueType>((axisY.GetZ() - axisZ.GetY()) * factor,
+                                          root * half,
+                                          (axisX.GetY() + axisY.GetX()) * factor,
+                                          (axisZ.GetX() + axisX.GetZ()) * factor);
+        }
+
+        if (m11 > m22)
+        {
+            const TValueType    root = SquareRoot(one - m00 + m11 - m22);
+            const TValueType    factor = half / root;
+
+            return Quaternion<TValueType>((axisZ.GetX() - axisX.GetZ()) * factor,
+                                          (axisX.GetY() + axisY.GetX()) * factor,
+                                          root * half,
+                                          (axisY.GetZ() + axisZ.GetY()) * factor);
+        }
+
+        const TValueType    root = SquareRoot(one - m00 - m11 + m22);
+        const TValueType    factor = half / root;
+
+        return Quaternion<TValueType>((axisX.GetY() - axisY.GetX()) * factor,
+                                      (axisZ.GetX() + axisX.GetZ()) * factor,
+                                      (axisY.GetZ() + axisZ.GetY()) * factor,
+                                      root * half);
+    }
+
+    template<CFloatingType TValueType>
+    inline Quaternion<TValueType> Quaternion<TValueType>::FromRotationMatrix(const Matrix3<TValueType>& matrix)
+    {
+        return FromAxes(matrix[0], matrix[1], matrix[2]);
+    }
+
+    template<CFloatingType TValueType>
+    inline Quaternion<TValueType> Quaternion<TValueType>::FromRotationMatrix(const Matrix4<TValueType>& matrix)
+    {
+        const Vector4<TValueType>   columnX = matrix[0], columnY = matrix[1], columnZ = matrix[2];
+
+        return FromAxes(Vector3<TValueType>(columnX.GetX(), columnX.GetY(), columnX.GetZ()),
+                        Vector3<TValueType>(columnY.GetX(), columnY.GetY(), columnY.GetZ()),
+                        Vector3<TValueType>(columnZ.GetX(), columnZ.GetY(), columnZ.GetZ()));
+    }
+
     template<CFloatingType TValueType>
     inline bool Quaternion<TValueType>::IsUnit(void) const
     {
@@ -476,6 +739,28 @@ namespace math
         return positionMatrix * (scaleMatrix * rotationMatrix);
     }
 
+    template<CFloatingType TValueType>
+    void Decompose(const Matrix4<TValueType>& matrix, Vector3<TValueType>& translation,
+                   Quaternion<TValueType>& rotation, Vector3<TValueType>& scale)
+    {
+        const Vector4<TValueType>   column0 = matrix[0], column1 = matrix[1];
+        const Vector4<TValueType>   column2 = matrix[2], column3 = matrix[3];
+
+        const Vector3<TValueType>   columnX(column0.GetX(), column0.GetY(), column0.GetZ());
+        const Vector3<TValueType>   columnY(column1.GetX(), column1.GetY(), column1.GetZ());
+        const Vector3<TValueType>   columnZ(column2.GetX(), column2.GetY(), column2.GetZ());
+
+        translation = Vector3<TValueType>(column3.GetX(), column3.GetY(), column3.GetZ());
+        scale = Vector3<TValueType>(columnX.Magnitude(), columnY.Magnitude(), columnZ.Magnitude());
+
+        // A mirrored basis cannot be a rotation, flip one axis
+        if (columnX.Dot(columnY.Cross(columnZ)) < static_cast<TValueType>(0))
+            scale.X() = -scale.GetX();
+
+        rotation = Quaternion<TValueType>::FromAxes(columnX / scale.GetX(), columnY / scale.GetY(),
+                                                    columnZ / scale.GetZ());
+    }
+
     template<CFloatingType TValueType>
     TValueType Dot(const Quaternion<TValueType>& q1, const Quaternion<TValueType>& q2)
     {
@@ -483,6 +768,155 @@ namespace math
     }
 
 
+    template <CFloatingType TValueType> inline
+    void Nlerp(std::type_identity_t<std::span<const Quaternion<TValueType>>> from,
+               std::type_identity_t<std::span<const Quaternion<TValueType>>> to,
+               TValueType ratio, std::type_identity_t<std::span<Quaternion<TValueType>>> out)
+    {
+        if (from.size() != out.size() || to.size() != out.size())
+            throw std::logic_error("Input span sizes do not match output");
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float), "Quaternion must be tightly packed");
+
+            simd::NlerpQuaternions(reinterpret_cast<const float*>(from.data()), reinterpret_cast<const float*>(to.data()),
+                                   reinterpret_cast<float*>(out.data()), out.size(), ratio);
+            return;
+        }
+#endif
+
+        for (std::size_t index = 0; index < out.size(); ++index)
+            out[index] = Quaternion<TValueType>::Nlerp(from[index], to[index], ratio);
+    }
+
+    template <CFloatingType TValueType> inline
+    void SlerpFast(std::type_identity_t<std::span<const Quaternion<TValueType>>> from,
+                   std::type_identity_t<std::span<const Quaternion<TValueType>>> to,
+                   TValueType ratio, std::type_identity_t<std::span<Quaternion<TValueType>>> out)
+    {
+        if (from.size() != out.size() || to.size() != out.size())
+            throw std::logic_error("Input span sizes do not match output");
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float), "Quaternion must be tightly packed");
+
+            simd::SlerpQuaternions(reinterpret_cast<const float*>(from.data()), reinterpret_cast<const float*>(to.data()),
+                                   reinterpret_cast<float*>(out.data()), out.size(), ratio);
+            return;
+        }
+#endif
+
+        for (std::size_t index = 0; index < out.size(); ++index)
+            out[index] = Quaternion<TValueType>::SlerpFast(from[index], to[index], ratio);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                          std::span<Matrix3<TValueType>> out)
+    {
+        if (rotations.size() != out.size())
+            throw std::logic_error("Output span size does not match input");
+
+        for (std::size_t index = 0; index < out.size(); ++index)
+            out[index] = rotations[index].RotationMatrix3();
+    }
+
+    template <CFloatingType TValueType> inline
+    void RotationMatrices(std::type_identity_t<std::span<const Quaternion<TValueType>>> rotations,
+                          std::span<Matrix4<TValueType>> out)
+    {
+        if (rotations.size() != out.size())
+            throw std::logic_error("Output span size does not match input");
+
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float), "Quaternion must be tightly packed");
+            static_assert(sizeof(Matrix4<float>) == 16 * sizeof(float), "Matrix4 must be tightly packed");
+
+            simd::QuaternionsToMatrices4(reinterpret_cast<const float*>(rotations.data()),
+                                         reinterpret_cast<float*>(out.data()), out.size());
+            return;
+        }
+#endif
+
+        const TValueType    zero = static_cast<TValueType>(0), one = static_cast<TValueType>(1);
+        const TValueType    two = static_cast<TValueType>(2);
+
+        for (std::size_t index = 0; index < out.size(); ++index)
+        {
+            const TValueType    w = rotations[index].GetW(), x = rotations[index].GetX();
+            const TValueType    y = rotations[index].GetY(), z = rotations[index].GetZ();
+
+            const TValueType    ww = w * w, xx = x * x, yy = y * y, zz = z * z;
+            const TValueType    xy = x * y, xz = x * z, yz = y * z;
+            const TValueType    wx = w * x, wy = w * y, wz = w * z;
+
+            // Same terms as Quaternion::RotationMatrix, written in place
+            TValueType*         values = out[index].Data();
+
+            values[0] = ww + xx - yy - zz;  values[1] = two * (xy + wz);    values[2] = two * (xz - wy);    values[3] = zero;
+            values[4] = two * (xy - wz);    values[5] = ww - xx + yy - zz;  values[6] = two * (yz + wx);    values[7] = zero;
+            values[8] = two * (xz + wy);    values[9] = two * (yz - wx);    values[10] = ww - xx - yy + zz; values[11] = zero;
+            values[12] = zero;              values[13] = zero;              values[14] = zero;              values[15] = one;
+        }
+    }
+
+    inline void RotationMatrices(std::span<const Quaternion<float>> rotations, std::span<Matrix3<float>> out)
+    {
+        RotationMatrices<float>(rotations, out);
+    }
+
+    inline void RotationMatrices(std::span<const Quaternion<double>> rotations, std::span<Matrix3<double>> out)
+    {
+        RotationMatrices<double>(rotations, out);
+    }
+
+    inline void RotationMatrices(std::span<const Quaternion<float>> rotations, std::span<Matrix4<float>> out)
+    {
+        RotationMatrices<float>(rotations, out);
+    }
+
+    inline void RotationMatrices(std::span<const Quaternion<double>> rotations, std::span<Matrix4<double>> out)
+    {
+        RotationMatrices<double>(rotations, out);
+    }
+
+    template <CFloatingType TValueType> inline
+    void Rotate(const Quaternion<TValueType>& rotation,
+                std::type_identity_t<std::span<const Vector3<TValueType>>> vectors,
+                std::type_identity_t<std::span<Vector3<TValueType>>> out)
+    {
+        if (vectors.size() != out.size())
+            throw std::logic_error("Output span size does not match input");
+
+        // Building the matrix costs about as much as rotating two vectors,
+        // and a matrix product is cheaper than two cross products
+        constexpr std::size_t   matrixThreshold = 4;
+
+        if (out.size() < matrixThreshold)
+        {
+            for (std::size_t index = 0; index < out.size(); ++index)
+                out[index] = rotation.Rotate(vectors[index]);
+
+            return;
+        }
+
+        TransformDirections(rotation.RotationMatrix(), vectors, out);
+    }
+
+    template <CFloatingType TValueType> inline
+    void Rotate(const Quaternion<TValueType>& rotation, std::type_identity_t<std::span<Vector3<TValueType>>> vectors)
+    {
+        Rotate(rotation, std::span<const Vector3<TValueType>>(vectors), vectors);
+    }
+
+
     template <CFloatingType TValueType> inline
     std::ostream& operator<<(std::ostream& os, Quaternion<TValueType> const& vector)
     {
@@ -505,7 +939,49 @@ namespace math
         return is;
     }
 
+    template <fast::EPrecision TPrecision, CFloatingType TValueType> inline
+    void fast::Normalize(std::type_identity_t<std::span<Quaternion<TValueType>>> quaternions)
+    {
+#ifdef MTH_SIMD_SSE
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float), "Quaternion must be tightly packed");
+
+            simd::NormalizeVectors4(reinterpret_cast<float*>(quaternions.data()), quaternions.size(),
+                                    static_cast<unsigned int>(TPrecision));
+            return;
+        }
+#endif
+
+        for (Quaternion<TValueType>& quaternion : quaternions)
+            quaternion.template NormalizeFast<TPrecision>();
+    }
+
+
+    template <fast::EPrecision TPrecision> inline
+    void fast::Normalize(std::span<Quaternion<float>> quaternions)
+    {
+        Normalize<TPrecision, float>(quaternions);
+    }
+
+
+    template <fast::EPrecision TPrecision> inline
+    void fast::Normalize(std::span<Quaternion<double>> quaternions)
+    {
+        Normalize<TPrecision, double>(quaternions);
+    }
+
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class Quaternion<float>;
+    extern template class Quaternion<double>;
 }
 
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,433 @@
+#ifndef __RECT_MATRIX_H__
+#define __RECT_MATRIX_H__
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+
+#include "MathGeneric.hpp"
+#include "Arithmetic.hpp"
+
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "VectorN.hpp"
+
+namespace math
+{
+    // Generic fixed-size matrix with TRows rows and TColumns columns.
+    // Values are stored column after column like Matrix4, and work on
+    // each column is unrolled at compile time. Also used as the base of
+    // square matrices without a hand-written specialization (MatrixN.hpp)
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType>
+    class RectMatrix
+    {
+        static_assert(TRows > 0 && TColumns > 0, "Matrix must have at least one row and one column");
+
+    public:
+
+        using TColumnType = Vector<TRows, TValueType>;
+        using TRowType = Vector<TColumns, TValueType>;
+
+        // Constructors / destructor
+
+        constexpr                   RectMatrix(void) = default;
+
+        // Set diagonal values, all others are 0
+        constexpr explicit          RectMatrix(TValueType diag);
+
+        // Values stored column after column (TRows * TColumns values)
+        constexpr explicit          RectMatrix(const TValueType vals[]);
+
+        // One vector per column
+        template <typename... TArgs>
+            requires (sizeof...(TArgs) == TColumns && (std::same_as<TArgs, TColumnType> && ...))
+        constexpr                   RectMatrix(const TArgs&... columns);
+
+        constexpr                   RectMatrix(const RectMatrix& other) = default;
+
+        constexpr                   ~RectMatrix(void) = default;
+
+        // Get a transposed copy of this matrix
+        constexpr RectMatrix<TColumns, TRows, TValueType>  Transpose(void)  const;
+
+        constexpr TColumnType       GetColumn(int column)                       const;
+        constexpr TRowType          GetRow(int row)                             const;
+
+        constexpr void              SetColumn(int column, const TColumnType& values);
+        constexpr void              SetRow(int row, const TRowType& values);
+
+        static constexpr uint8_t    Rows(void) { return TRows; }
+        static constexpr uint8_t    Columns(void) { return TColumns; }
+
+        // Get a pointer to all values, stored contiguously
+        // column after column
+        constexpr TValueType*       Data(void)                                  { return m_values; }
+        constexpr const TValueType* Data(void)                                  const { return m_values; }
+
+
+        constexpr RectMatrix&       operator=(const RectMatrix& rhs) = default;
+
+        // Access a value (no bound checking)
+        constexpr TValueType&       operator()(int row, int column)             { return m_values[column * TRows + row]; }
+        constexpr TValueType        operator()(int row, int column)             const { return m_values[column * TRows + row]; }
+
+        // Matrix / matrix operators
+
+        constexpr RectMatrix        operator+(const RectMatrix& rhs)            const;
+        constexpr RectMatrix        operator-(const RectMatrix& rhs)            const;
+
+        // (TRows x TColumns) * (TColumns x TOtherColumns)
+        template <uint8_t TOtherColumns> constexpr
+        RectMatrix<TRows, TOtherColumns, TValueType>
+                                    operator*(const RectMatrix<TColumns, TOtherColumns, TValueType>& rhs) const;
+
+        // Multiply a column vector by this matrix
+        constexpr TColumnType       operator*(const TRowType& rhs)              const;
+
+        // Multiply all numbers of a copy of this matrix by a scalar factor
+        constexpr RectMatrix        operator*(TValueType factor)                const;
+
+        // Divide all numbers of a copy of this matrix by a scalar factor
+        constexpr RectMatrix        operator/(TValueType factor)                const;
+
+        // Matrix / matrix assignment operators
+
+        constexpr RectMatrix&       operator+=(const RectMatrix& rhs);
+        constexpr RectMatrix&       operator-=(const RectMatrix& rhs);
+
+        // Multiply all numbers of this matrix by a scalar factor
+        constexpr RectMatrix&       operator*=(TValueType factor);
+
+        // Divide all numbers of this matrix by a scalar factor
+        constexpr RectMatrix&       operator/=(TValueType factor);
+
+        constexpr bool              operator==(const RectMatrix& rhs)           const;
+        constexpr bool              operator!=(const RectMatrix& rhs)           const;
+
+    protected:
+
+        static constexpr int        Count = static_cast<int>(TRows) * TColumns;
+
+        TValueType                  m_values[Count]{};
+    };
+
+
+    // Multiply all numbers of a copy of a matrix by a scalar factor
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>  operator*(TValueType lhs, const RectMatrix<TRows, TColumns, TValueType>& rhs);
+
+    // Get column * row^T (e.g. to accumulate a covariance matrix)
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>  OuterProduct(const Vector<TRows, TValueType>& column,
+                                                          const Vector<TColumns, TValueType>& row);
+
+    // Pass values to stream, row after row
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> inline
+    std::ostream&               operator<<(std::ostream& os, const RectMatrix<TRows, TColumns, TValueType>& matrix);
+
+
+    // ---- Implementation ---
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>::RectMatrix(TValueType diag)
+    {
+        detail::Unroll<(TRows < TColumns) ? TRows : TColumns>([&](std::size_t index)
+        {
+            m_values[index * TRows + index] = diag;
+        });
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>::RectMatrix(const TValueType vals[])
+    {
+        detail::Unroll<Count>([&](std::size_t index)
+        {
+            m_values[index] = vals[index];
+        });
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType>
+    template <typename... TArgs>
+        requires (sizeof...(TArgs) == TColumns && (std::same_as<TArgs, Vector<TRows, TValueType>> && ...))
+    constexpr RectMatrix<TRows, TColumns, TValueType>::RectMatrix(const TArgs&... columns)
+    {
+        int         column = 0;
+
+        (SetColumn(column++, columns), ...);
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TColumns, TRows, TValueType> RectMatrix<TRows, TColumns, TValueType>::Transpose(void) const
+    {
+        RectMatrix<TColumns, TRows, TValueType>     result;
+
+        for (int column = 0; column < TColumns; ++column)
+        {
+            detail::Unroll<TRows>([&](std::size_t row)
+            {
+                result(column, static_cast<int>(row)) = m_values[column * TRows + row];
+            });
+        }
+
+        return result;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    Vector<TRows, TValueType> RectMatrix<TRows, TColumns, TValueType>::GetColumn(int column) const
+    {
+        TColumnType     result;
+
+        detail::Unroll<TRows>([&](std::size_t row)
+        {
+            result[static_cast<int>(row)] = m_values[column * TRows + row];
+        });
+
+        return result;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    Vector<TColumns, TValueType> RectMatrix<TRows, TColumns, TValueType>::GetRow(int row) const
+    {
+        TRowType        result;
+
+        detail::Unroll<TColumns>([&](std::size_t column)
+        {
+            result[static_cast<int>(column)] = m_values[column * TRows + row];
+        });
+
+        return result;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    void RectMatrix<TRows, TColumns, TValueType>::SetColumn(int column, const TColumnType& values)
+    {
+        detail::Unroll<TRows>([&](std::size_t row)
+        {
+            m_values[column * TRows + row] = values[static_cast<int>(row)];
+        });
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    void RectMatrix<TRows, TColumns, TValueType>::SetRow(int row, const TRowType& values)
+    {
+        detail::Unroll<TColumns>([&](std::size_t column)
+        {
+            m_values[column * TRows + row] = values[static_cast<int>(column)];
+        });
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>
+    RectMatrix<TRows, TColumns, TValueType>::operator+(const RectMatrix& rhs) const
+    {
+        RectMatrix      result = *this;
+
+        return result += rhs;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>
+    RectMatrix<TRows, TColumns, TValueType>::operator-(const RectMatrix& rhs) const
+    {
+        RectMatrix      result = *this;
+
+        return result -= rhs;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType>
+    template <uint8_t TOtherColumns> constexpr
+    RectMatrix<TRows, TOtherColumns, TValueType>
+    RectMatrix<TRows, TColumns, TValueType>::operator*(const RectMatrix<TColumns, TOtherColumns, TValueType>& rhs) const
+    {
+        RectMatrix<TRows, TOtherColumns, TValueType>    result;
+
+        // Each result column is a linear combination of this matrix'
+        // columns, so the innermost loop walks contiguous values.
+        // Accumulate in a local column so it can stay in registers
+        for (int resultColumn = 0; resultColumn < TOtherColumns; ++resultColumn)
+        {
+            TValueType      sum[TRows]{};
+
+            for (int column = 0; column < TColumns; ++column)
+            {
+                const TValueType    factor = rhs(column, resultColumn);
+
+                detail::Unroll<TRows>([&](std::size_t row)
+                {
+                    sum[row] += m_values[column * TRows + row] * factor;
+                });
+            }
+
+            detail::Unroll<TRows>([&](std::size_t row)
+            {
+                result(static_cast<int>(row), resultColumn) = sum[row];
+            });
+        }
+
+        return result;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    Vector<TRows, TValueType> RectMatrix<TRows, TColumns, TValueType>::operator*(const TRowType& rhs) const
+    {
+        TValueType      result[TRows]{};
+
+        for (int column = 0; column < TColumns; ++column)
+        {
+            const TValueType    factor = rhs[column];
+
+            detail::Unroll<TRows>([&](std::size_t row)
+            {
+                result[row] += m_values[column * TRows + row] * factor;
+            });
+        }
+
+        return [&]<std::size_t... TIndices>(std::index_sequence<TIndices...>)
+        {
+            return TColumnType(result[TIndices]...);
+        }
+        (std::make_index_sequence<TRows>{});
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>
+    RectMatrix<TRows, TColumns, TValueType>::operator*(TValueType factor) const
+    {
+        RectMatrix      result = *this;
+
+        return result *= factor;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>
+    RectMatrix<TRows, TColumns, TValueType>::operator/(TValueType factor) const
+    {
+        RectMatrix      result = *this;
+
+        return result /= factor;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>&
+    RectMatrix<TRows, TColumns, TValueType>::operator+=(const RectMatrix& rhs)
+    {
+        detail::Unroll<Count>([&](std::size_t index) { m_values[index] += rhs.m_values[index]; });
+        return *this;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>&
+    RectMatrix<TRows, TColumns, TValueType>::operator-=(const RectMatrix& rhs)
+    {
+        detail::Unroll<Count>([&](std::size_t index) { m_values[index] -= rhs.m_values[index]; });
+        return *this;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>&
+    RectMatrix<TRows, TColumns, TValueType>::operator*=(TValueType factor)
+    {
+        detail::Unroll<Count>([&](std::size_t index) { m_values[index] *= factor; });
+        return *this;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType>&
+    RectMatrix<TRows, TColumns, TValueType>::operator/=(TValueType factor)
+    {
+        // Only divide once for floating point types
+        if constexpr (std::is_floating_point_v<TValueType>)
+            return *this *= static_cast<TValueType>(1) / factor;
+
+        else
+        {
+            detail::Unroll<Count>([&](std::size_t index) { m_values[index] /= factor; });
+            return *this;
+        }
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    bool RectMatrix<TRows, TColumns, TValueType>::operator==(const RectMatrix& rhs) const
+    {
+        bool        equal = true;
+
+        detail::Unroll<Count>([&](std::size_t index)
+        {
+            equal = equal && AlmostEqual(m_values[index], rhs.m_values[index]);
+        });
+
+        return equal;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    bool RectMatrix<TRows, TColumns, TValueType>::operator!=(const RectMatrix& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType> operator*(TValueType lhs, const RectMatrix<TRows, TColumns, TValueType>& rhs)
+    {
+        return rhs * lhs;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> constexpr
+    RectMatrix<TRows, TColumns, TValueType> OuterProduct(const Vector<TRows, TValueType>& column,
+                                                         const Vector<TColumns, TValueType>& row)
+    {
+        RectMatrix<TRows, TColumns, TValueType>     result;
+
+        for (int index = 0; index < TColumns; ++index)
+            result.SetColumn(index, column * row[index]);
+
+        return result;
+    }
+
+
+    template <uint8_t TRows, uint8_t TColumns, CScalarType TValueType> inline
+    std::ostream& operator<<(std::ostream& os, const RectMatrix<TRows, TColumns, TValueType>& matrix)
+    {
+        os << '{';
+
+        for (int row = 0; row < TRows; ++row)
+        {
+            os << (row ? ",{" : "{");
+
+            for (int column = 0; column < TColumns; ++column)
+                os << (column ? "," : "") << matrix(row, column);
+
+            os << '}';
+        }
+
+        return os << '}';
+    }
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -0,0 +1,762 @@
+#ifndef __SIMD_H__
+#define __SIMD_H__
+
+// Compile-time SIMD detection. Code paths are picked from the
+// instruction sets enabled for the current translation unit
+// (e.g. -mavx or /arch:AVX). Define MTH_NO_SIMD before including
+// any math header to force the generic scalar implementations
+
+#ifndef MTH_NO_SIMD
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MTH_SIMD_SSE
+#endif
+
+#if defined(MTH_SIMD_SSE) && defined(__AVX__)
+#define MTH_SIMD_AVX
+#endif
+
+#endif
+
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(MTH_SIMD_AVX)
+#include <immintrin.h>
+
+#elif defined(MTH_SIMD_SSE)
+#include <emmintrin.h>
+#endif
+
+
+namespace math::simd
+{
+    // Kernels below work on raw column-major 4x4 arrays
+    // (16 contiguous values, column after column)
+
+#ifdef MTH_SIMD_SSE
+
+    // result = lhs * rhs, one column of the result per register.
+    // result may alias lhs or rhs
+    inline void     MultiplyMatrix4(const float* lhs, const float* rhs, float* result) noexcept
+    {
+        // Keep all left-hand columns in registers
+        const __m128    column0 = _mm_loadu_ps(lhs);
+        const __m128    column1 = _mm_loadu_ps(lhs + 4);
+        const __m128    column2 = _mm_loadu_ps(lhs + 8);
+        const __m128    column3 = _mm_loadu_ps(lhs + 12);
+
+        __m128          results[4];
+
+        for (int column = 0; column < 4; ++column)
+        {
+            const float*    rhsColumn = rhs + column * 4;
+
+            // Linear combination of lhs columns weighted by rhs column
+            __m128      sum = _mm_mul_ps(column0, _mm_set1_ps(rhsColumn[0]));
+
+            sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(rhsColumn[1])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(rhsColumn[2])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(column3, _mm_set1_ps(rhsColumn[3])));
+
+            results[column] = sum;
+        }
+
+        // Store last so rhs can safely alias result
+        for (int column = 0; column < 4; ++column)
+            _mm_storeu_ps(result + column * 4, results[column]);
+    }
+
+
+    // Build a shuffle mask, lanes listed from first to last
+#define MTH_SHUFFLE_MASK(x, y, z, w)        ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+    // Lanes (x, y, z, w) taken from vec1, vec1, vec2, vec2
+#define MTH_SHUFFLE(vec1, vec2, x, y, z, w)  _mm_shuffle_ps(vec1, vec2, MTH_SHUFFLE_MASK(x, y, z, w))
+
+    // Reorder lanes of a single register
+#define MTH_SWIZZLE(vec, x, y, z, w)        MTH_SHUFFLE(vec, vec, x, y, z, w)
+
+
+    // 2x2 blocks below are stored as (m00, m01, m10, m11)
+
+    // lhs * rhs
+    inline __m128   MultiplyMatrix2(__m128 lhs, __m128 rhs) noexcept
+    {
+        return _mm_add_ps(_mm_mul_ps(lhs, MTH_SWIZZLE(rhs, 0, 3, 0, 3)),
+                          _mm_mul_ps(MTH_SWIZZLE(lhs, 1, 0, 3, 2), MTH_SWIZZLE(rhs, 2, 1, 2, 1)));
+    }
+
+    // adjugate(lhs) * rhs
+    inline __m128   AdjugateMultiplyMatrix2(__m128 lhs, __m128 rhs) noexcept
+    {
+        return _mm_sub_ps(_mm_mul_ps(MTH_SWIZZLE(lhs, 3, 3, 0, 0), rhs),
+                          _mm_mul_ps(MTH_SWIZZLE(lhs, 1, 1, 2, 2), MTH_SWIZZLE(rhs, 2, 3, 0, 1)));
+    }
+
+    // lhs * adjugate(rhs)
+    inline __m128   MultiplyAdjugateMatrix2(__m128 lhs, __m128 rhs) noexcept
+    {
+        return _mm_sub_ps(_mm_mul_ps(lhs, MTH_SWIZZLE(rhs, 3, 0, 3, 0)),
+                          _mm_mul_ps(MTH_SWIZZLE(lhs, 1, 0, 3, 2), MTH_SWIZZLE(rhs, 2, 1, 2, 1)));
+    }
+
+
+    // Inverse through 2x2 block matrices (A B / C D), reusing the
+    // blocks' determinants and adjugate products. The layout does not
+    // matter as inverse(transpose(M)) == transpose(inverse(M)).
+    // result may alias matrix
+    inline void     InverseMatrix4(const float* matrix, float* result) noexcept
+    {
+        const __m128    vec0 = _mm_loadu_ps(matrix);
+        const __m128    vec1 = _mm_loadu_ps(matrix + 4);
+        const __m128    vec2 = _mm_loadu_ps(matrix + 8);
+        const __m128    vec3 = _mm_loadu_ps(matrix + 12);
+
+        // 2x2 blocks
+        const __m128    blockA = _mm_movelh_ps(vec0, vec1);
+        const __m128    blockB = _mm_movehl_ps(vec1, vec0);
+        const __m128    blockC = _mm_movelh_ps(vec2, vec3);
+        const __m128    blockD = _mm_movehl_ps(vec3, vec2);
+
+        // Determinants of all four blocks at once (|A|, |B|, |C|, |D|)
+        const __m128    blockDets = _mm_sub_ps
+        (
+            _mm_mul_ps(MTH_SHUFFLE(vec0, vec2, 0, 2, 0, 2), MTH_SHUFFLE(vec1, vec3, 1, 3, 1, 3)),
+            _mm_mul_ps(MTH_SHUFFLE(vec0, vec2, 1, 3, 1, 3), MTH_SHUFFLE(vec1, vec3, 0, 2, 0, 2))
+        );
+
+        const __m128    detA = MTH_SWIZZLE(blockDets, 0, 0, 0, 0);
+        const __m128    detB = MTH_SWIZZLE(blockDets, 1, 1, 1, 1);
+        const __m128    detC = MTH_SWIZZLE(blockDets, 2, 2, 2, 2);
+        const __m128    detD = MTH_SWIZZLE(blockDets, 3, 3, 3, 3);
+
+        // Shared adjugate products
+        const __m128    adjDC = AdjugateMultiplyMatrix2(blockD, blockC);
+        const __m128    adjAB = AdjugateMultiplyMatrix2(blockA, blockB);
+
+        // Adjugates of the inverse's blocks (X Y / Z W)
+        __m128          adjX = _mm_sub_ps(_mm_mul_ps(detD, blockA), MultiplyMatrix2(blockB, adjDC));
+        __m128          adjW = _mm_sub_ps(_mm_mul_ps(detA, blockD), MultiplyMatrix2(blockC, adjAB));
+        __m128          adjY = _mm_sub_ps(_mm_mul_ps(detB, blockC), MultiplyAdjugateMatrix2(blockD, adjAB));
+        __m128          adjZ = _mm_sub_ps(_mm_mul_ps(detC, blockB), MultiplyAdjugateMatrix2(blockA, adjDC));
+
+        // |M| = |A| |D| + |B| |C| - trace(adj(A)B adj(D)C)
+        __m128          trace = _mm_mul_ps(adjAB, MTH_SWIZZLE(adjDC, 0, 2, 1, 3));
+
+        trace = _mm_add_ps(trace, MTH_SWIZZLE(trace, 2, 3, 0, 1));
+        trace = _mm_add_ps(trace, MTH_SWIZZLE(trace, 1, 0, 3, 2));
+
+        __m128          determinant = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+
+        determinant = _mm_sub_ps(determinant, trace);
+
+        // Only divide once, adjugate signs folded in
+        const __m128    invDeterminant = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), determinant);
+
+        adjX = _mm_mul_ps(adjX, invDeterminant);
+        adjY = _mm_mul_ps(adjY, invDeterminant);
+        adjZ = _mm_mul_ps(adjZ, invDeterminant);
+        adjW = _mm_mul_ps(adjW, invDeterminant);
+
+        // Undo adjugates and reassemble blocks
+        _mm_storeu_ps(result, MTH_SHUFFLE(adjX, adjY, 3, 1, 3, 1));
+        _mm_storeu_ps(result + 4, MTH_SHUFFLE(adjX, adjY, 2, 0, 2, 0));
+        _mm_storeu_ps(result + 8, MTH_SHUFFLE(adjZ, adjW, 3, 1, 3, 1));
+        _mm_storeu_ps(result + 12, MTH_SHUFFLE(adjZ, adjW, 2, 0, 2, 0));
+    }
+
+
+    // Determinant from the 12 2x2 minors of the two upper and two lower
+    // columns, det(M) == det(transpose(M)) so layout does not matter
+    inline float    DeterminantMatrix4(const float* matrix) noexcept
+    {
+        const __m128    vec0 = _mm_loadu_ps(matrix);
+        const __m128    vec1 = _mm_loadu_ps(matrix + 4);
+        const __m128    vec2 = _mm_loadu_ps(matrix + 8);
+        const __m128    vec3 = _mm_loadu_ps(matrix + 12);
+
+        // Minors over element pairs (01, 02, 03, 12)
+        const __m128    upper = _mm_sub_ps
+        (
+            _mm_mul_ps(MTH_SWIZZLE(vec0, 0, 0, 0, 1), MTH_SWIZZLE(vec1, 1, 2, 3, 2)),
+            _mm_mul_ps(MTH_SWIZZLE(vec0, 1, 2, 3, 2), MTH_SWIZZLE(vec1, 0, 0, 0, 1))
+        );
+
+        const __m128    lower = _mm_sub_ps
+        (
+            _mm_mul_ps(MTH_SWIZZLE(vec2, 0, 0, 0, 1), MTH_SWIZZLE(vec3, 1, 2, 3, 2)),
+            _mm_mul_ps(MTH_SWIZZLE(vec2, 1, 2, 3, 2), MTH_SWIZZLE(vec3, 0, 0, 0, 1))
+        );
+
+        // Pairs (13, 23) of the upper columns, then of the lower ones
+        const __m128    remaining = _mm_sub_ps
+        (
+            _mm_mul_ps(MTH_SHUFFLE(vec0, vec2, 1, 2, 1, 2), MTH_SHUFFLE(vec1, vec3, 3, 3, 3, 3)),
+            _mm_mul_ps(MTH_SHUFFLE(vec1, vec3, 1, 2, 1, 2), MTH_SHUFFLE(vec0, vec2, 3, 3, 3, 3))
+        );
+
+        // Pair each upper minor with its complementary lower one:
+        // s0 c5 - s1 c4 + s2 c3 + s3 c2 - s4 c1 + s5 c0
+        __m128          sum = _mm_mul_ps
+        (
+            _mm_mul_ps(upper, MTH_SHUFFLE(remaining, lower, 3, 2, 3, 2)),
+            _mm_setr_ps(1.f, -1.f, 1.f, 1.f)
+        );
+
+        sum = _mm_add_ps(sum, _mm_mul_ps
+        (
+            _mm_mul_ps(remaining, MTH_SWIZZLE(lower, 1, 0, 1, 0)),
+            _mm_setr_ps(-1.f, 1.f, 0.f, 0.f)
+        ));
+
+        // Horizontal add
+        sum = _mm_add_ps(sum, MTH_SWIZZLE(sum, 2, 3, 0, 1));
+        sum = _mm_add_ps(sum, MTH_SWIZZLE(sum, 1, 0, 3, 2));
+
+        return _mm_cvtss_f32(sum);
+    }
+
+
+
+    // Transform an array of 3D vectors (tightly packed x, y, z) with an
+    // implicit w, keeping the matrix columns in registers.
+    // Use w = 1 for points and w = 0 for directions.
+    // out may be the same array as vectors
+    inline void     TransformVectors3(const float* matrix, const float* vectors, float* out,
+                                      std::size_t count, float w) noexcept
+    {
+        const __m128    column0 = _mm_loadu_ps(matrix);
+        const __m128    column1 = _mm_loadu_ps(matrix + 4);
+        const __m128    column2 = _mm_loadu_ps(matrix + 8);
+
+        // Translation column only contributes w times
+        const __m128    column3 = _mm_mul_ps(_mm_loadu_ps(matrix + 12), _mm_set1_ps(w));
+
+        for (std::size_t index = 0; index < count; ++index, vectors += 3, out += 3)
+        {
+            __m128      result = _mm_add_ps(column3, _mm_mul_ps(column0, _mm_set1_ps(vectors[0])));
+
+            result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_set1_ps(vectors[1])));
+            result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_set1_ps(vectors[2])));
+
+            // Store x, y then z
+            _mm_storel_pi(reinterpret_cast<__m64*>(out), result);
+            _mm_store_ss(out + 2, _mm_movehl_ps(result, result));
+        }
+    }
+
+
+    // Transform an array of 3D points (w = 1) and divide the result by
+    // its w component. out may be the same array as points
+    inline void     TransformPointsProjective3(const float* matrix, const float* points, float* out,
+                                               std::size_t count) noexcept
+    {
+        const __m128    column0 = _mm_loadu_ps(matrix);
+        const __m128    column1 = _mm_loadu_ps(matrix + 4);
+        const __m128    column2 = _mm_loadu_ps(matrix + 8);
+        const __m128    column3 = _mm_loadu_ps(matrix + 12);
+
+        for (std::size_t index = 0; index < count; ++index, points += 3, out += 3)
+        {
+            __m128      result = _mm_add_ps(column3, _mm_mul_ps(column0, _mm_set1_ps(points[0])));
+
+            result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_set1_ps(points[1])));
+            result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_set1_ps(points[2])));
+
+            // Perspective divide
+            result = _mm_div_ps(result, MTH_SWIZZLE(result, 3, 3, 3, 3));
+
+            _mm_storel_pi(reinterpret_cast<__m64*>(out), result);
+            _mm_store_ss(out + 2, _mm_movehl_ps(result, result));
+        }
+    }
+
+
+    // Transform an array of 3D points (w = 1) into homogeneous 4D
+    // vectors, without dividing by w
+    inline void     TransformPointsHomogeneous3(const float* matrix, const float* points, float* out,
+                                                std::size_t count) noexcept
+    {
+        const __m128    column0 = _mm_loadu_ps(matrix);
+        const __m128    column1 = _mm_loadu_ps(matrix + 4);
+        const __m128    column2 = _mm_loadu_ps(matrix + 8);
+        const __m128    column3 = _mm_loadu_ps(matrix + 12);
+
+        for (std::size_t index = 0; index < count; ++index, points += 3, out += 4)
+        {
+            __m128      result = _mm_add_ps(column3, _mm_mul_ps(column0, _mm_set1_ps(points[0])));
+
+            result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_set1_ps(points[1])));
+            result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_set1_ps(points[2])));
+
+            _mm_storeu_ps(out, result);
+        }
+    }
+
+
+    // Transform an array of 4D vectors. out may be the same array as vectors
+    inline void     TransformVectors4(const float* matrix, const float* vectors, float* out,
+                                      std::size_t count) noexcept
+    {
+        const __m128    column0 = _mm_loadu_ps(matrix);
+        const __m128    column1 = _mm_loadu_ps(matrix + 4);
+        const __m128    column2 = _mm_loadu_ps(matrix + 8);
+        const __m128    column3 = _mm_loadu_ps(matrix + 12);
+
+        for (std::size_t index = 0; index < count; ++index, vectors += 4, out += 4)
+        {
+            const __m128    vector = _mm_loadu_ps(vectors);
+
+            __m128          result = _mm_mul_ps(column0, MTH_SWIZZLE(vector, 0, 0, 0, 0));
+
+            result = _mm_add_ps(result, _mm_mul_ps(column1, MTH_SWIZZLE(vector, 1, 1, 1, 1)));
+            result = _mm_add_ps(result, _mm_mul_ps(column2, MTH_SWIZZLE(vector, 2, 2, 2, 2)));
+            result = _mm_add_ps(result, _mm_mul_ps(column3, MTH_SWIZZLE(vector, 3, 3, 3, 3)));
+
+            _mm_storeu_ps(out, result);
+        }
+    }
+
+
+    // Newton-Raphson steps on a reciprocal square root estimate,
+    // each one roughly doubles the number of correct bits
+    inline __m128   RefineInverseSquareRoot(__m128 values, __m128 estimate,
+                                            unsigned int refinements) noexcept
+    {
+        const __m128    half = _mm_set1_ps(0.5f);
+        const __m128    threeHalves = _mm_set1_ps(1.5f);
+        const __m128    halfValues = _mm_mul_ps(values, half);
+
+        for (unsigned int step = 0; step < refinements; ++step)
+        {
+            const __m128    squared = _mm_mul_ps(estimate, estimate);
+
+            estimate = _mm_mul_ps(estimate, _mm_sub_ps(threeHalves, _mm_mul_ps(halfValues, squared)));
+        }
+
+        return estimate;
+    }
+
+
+    // out[i] = 1 / sqrt(values[i]) from rsqrtps. out may be the same array as values
+    inline void     InverseSquareRoot(const float* values, float* out, std::size_t count,
+                                      unsigned int refinements) noexcept
+    {
+        std::size_t     index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128    value = _mm_loadu_ps(values + index);
+
+            _mm_storeu_ps(out + index, RefineInverseSquareRoot(value, _mm_rsqrt_ps(value), refinements));
+        }
+
+        for (; index < count; ++index)
+        {
+            const __m128    value = _mm_set_ss(values[index]);
+
+            out[index] = _mm_cvtss_f32(RefineInverseSquareRoot(value, _mm_rsqrt_ss(value), refinements));
+        }
+    }
+
+
+    // Scale an array of 4D vectors to unit length in place,
+    // using rsqrtps instead of sqrt and division
+    inline void     NormalizeVectors4(float* vectors, std::size_t count, unsigned int refinements) noexcept
+    {
+        for (std::size_t index = 0; index < count; ++index, vectors += 4)
+        {
+            const __m128    vector = _mm_loadu_ps(vectors);
+
+            // Squared length broadcast to every lane
+            __m128          lengthSquared = _mm_mul_ps(vector, vector);
+
+            lengthSquared = _mm_add_ps(lengthSquared, MTH_SWIZZLE(lengthSquared, 1, 0, 3, 2));
+            lengthSquared = _mm_add_ps(lengthSquared, MTH_SWIZZLE(lengthSquared, 2, 3, 0, 1));
+
+            const __m128    inverseLength = RefineInverseSquareRoot(lengthSquared, _mm_rsqrt_ps(lengthSquared),
+                                                                    refinements);
+
+            _mm_storeu_ps(vectors, _mm_mul_ps(vector, inverseLength));
+        }
+    }
+
+
+    // Blend arrays of quaternions (w, x, y, z) with the same ratio along
+    // the shortest path: out = normalize(lerp(from, +/-to, ratio)).
+    // out may be the same array as from or to
+    inline void     NlerpQuaternions(const float* from, const float* to, float* out, std::size_t count,
+                                     float ratio) noexcept
+    {
+        const __m128    ratios = _mm_set1_ps(ratio);
+        const __m128    signBit = _mm_set1_ps(-0.f);
+
+        for (std::size_t index = 0; index < count; ++index, from += 4, to += 4, out += 4)
+        {
+            const __m128    start = _mm_loadu_ps(from);
+            __m128          end = _mm_loadu_ps(to);
+
+            // Dot product broadcast to every lane, its sign flips end
+            __m128          dot = _mm_mul_ps(start, end);
+
+            dot = _mm_add_ps(dot, MTH_SWIZZLE(dot, 1, 0, 3, 2));
+            dot = _mm_add_ps(dot, MTH_SWIZZLE(dot, 2, 3, 0, 1));
+            end = _mm_xor_ps(end, _mm_and_ps(dot, signBit));
+
+            const __m128    blended = _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(end, start), ratios));
+
+            __m128          lengthSquared = _mm_mul_ps(blended, blended);
+
+            lengthSquared = _mm_add_ps(lengthSquared, MTH_SWIZZLE(lengthSquared, 1, 0, 3, 2));
+            lengthSquared = _mm_add_ps(lengthSquared, MTH_SWIZZLE(lengthSquared, 2, 3, 0, 1));
+
+            _mm_storeu_ps(out, _mm_div_ps(blended, _mm_sqrt_ps(lengthSquared)));
+        }
+    }
+
+
+    // Slerp arrays of quaternions (w, x, y, z) with the same ratio, without
+    // trigonometry: sin(t a) / sin(a) is expanded as a polynomial in cos(a)
+    // (Eberly's method, see Quaternion::SlerpFast). The ratio is shared so
+    // each term's (u t^2 - v) factor is computed once. Quaternions are
+    // transposed 4 at a time to get both weights of 4 pairs per series.
+    // out may be the same array as from or to
+    inline void     SlerpQuaternions(const float* from, const float* to, float* out, std::size_t count,
+                                     float ratio) noexcept
+    {
+        constexpr float     mu = 1.85298109240830f;
+
+        // u[i] = 1 / (i (2i + 1)), v[i] = i / (2i + 1), last term corrected by mu
+        constexpr float     u[8] =
+        {
+            1.f / (1.f * 3.f), 1.f / (2.f * 5.f), 1.f / (3.f * 7.f), 1.f / (4.f * 9.f),
+            1.f / (5.f * 11.f), 1.f / (6.f * 13.f), 1.f / (7.f * 15.f), mu / (8.f * 17.f)
+        };
+
+        constexpr float     v[8] =
+        {
+            1.f / 3.f, 2.f / 5.f, 3.f / 7.f, 4.f / 9.f,
+            5.f / 11.f, 6.f / 13.f, 7.f / 15.f, mu * 8.f / 17.f
+        };
+
+        const float         inverseRatio = 1.f - ratio;
+
+        // Per term factors for the end (ratio) and start (1 - ratio) weights
+        __m128              endTerms[8], startTerms[8], pairTerms[8];
+
+        for (int term = 0; term < 8; ++term)
+        {
+            const float     endTerm = u[term] * ratio * ratio - v[term];
+            const float     startTerm = u[term] * inverseRatio * inverseRatio - v[term];
+
+            endTerms[term] = _mm_set1_ps(endTerm);
+            startTerms[term] = _mm_set1_ps(startTerm);
+            pairTerms[term] = _mm_setr_ps(endTerm, startTerm, 0.f, 0.f);
+        }
+
+        const __m128        one = _mm_set1_ps(1.f);
+        const __m128        signBit = _mm_set1_ps(-0.f);
+        const __m128        endRatio = _mm_set1_ps(ratio);
+        const __m128        startRatio = _mm_set1_ps(inverseRatio);
+
+        std::size_t         index = 0;
+
+        // Four pairs at once, one component per register
+        for (; index + 4 <= count; index += 4, from += 16, to += 16, out += 16)
+        {
+            __m128          startW = _mm_loadu_ps(from), startX = _mm_loadu_ps(from + 4);
+            __m128          startY = _mm_loadu_ps(from + 8), startZ = _mm_loadu_ps(from + 12);
+            __m128          endW = _mm_loadu_ps(to), endX = _mm_loadu_ps(to + 4);
+            __m128          endY = _mm_loadu_ps(to + 8), endZ = _mm_loadu_ps(to + 12);
+
+            _MM_TRANSPOSE4_PS(startW, startX, startY, startZ);
+            _MM_TRANSPOSE4_PS(endW, endX, endY, endZ);
+
+            const __m128    dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(startW, endW), _mm_mul_ps(startX, endX)),
+                                             _mm_add_ps(_mm_mul_ps(startY, endY), _mm_mul_ps(startZ, endZ)));
+
+            // Shortest path: flip end and use |cos(a)|
+            const __m128    sign = _mm_and_ps(dot, signBit);
+            const __m128    cosineMinusOne = _mm_sub_ps(_mm_xor_ps(dot, sign), one);
+
+            // Horner scheme from the last term
+            __m128          endSeries = one, startSeries = one;
+
+            for (int term = 7; term >= 0; --term)
+            {
+                endSeries = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(endTerms[term], cosineMinusOne), endSeries));
+                startSeries = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(startTerms[term], cosineMinusOne), startSeries));
+            }
+
+            const __m128    endWeight = _mm_xor_ps(_mm_mul_ps(endRatio, endSeries), sign);
+            const __m128    startWeight = _mm_mul_ps(startRatio, startSeries);
+
+            __m128          resultW = _mm_add_ps(_mm_mul_ps(startW, startWeight), _mm_mul_ps(endW, endWeight));
+            __m128          resultX = _mm_add_ps(_mm_mul_ps(startX, startWeight), _mm_mul_ps(endX, endWeight));
+            __m128          resultY = _mm_add_ps(_mm_mul_ps(startY, startWeight), _mm_mul_ps(endY, endWeight));
+            __m128          resultZ = _mm_add_ps(_mm_mul_ps(startZ, startWeight), _mm_mul_ps(endZ, endWeight));
+
+            _MM_TRANSPOSE4_PS(resultW, resultX, resultY, resultZ);
+
+            _mm_storeu_ps(out, resultW);
+            _mm_storeu_ps(out + 4, resultX);
+            _mm_storeu_ps(out + 8, resultY);
+            _mm_storeu_ps(out + 12, resultZ);
+        }
+
+        // Remaining pairs one by one, end and start weights in lanes 0 and 1
+        const __m128        weights = _mm_setr_ps(ratio, inverseRatio, 0.f, 0.f);
+
+        for (; index < count; ++index, from += 4, to += 4, out += 4)
+        {
+            const __m128    start = _mm_loadu_ps(from);
+            __m128          end = _mm_loadu_ps(to);
+
+            __m128          dot = _mm_mul_ps(start, end);
+
+            dot = _mm_add_ps(dot, MTH_SWIZZLE(dot, 1, 0, 3, 2));
+            dot = _mm_add_ps(dot, MTH_SWIZZLE(dot, 2, 3, 0, 1));
+
+            const __m128    sign = _mm_and_ps(dot, signBit);
+
+            end = _mm_xor_ps(end, sign);
+
+            const __m128    cosineMinusOne = _mm_sub_ps(_mm_xor_ps(dot, sign), one);
+
+            __m128          series = one;
+
+            for (int term = 7; term >= 0; --term)
+                series = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(pairTerms[term], cosineMinusOne), series));
+
+            const __m128    coefficients = _mm_mul_ps(weights, series);
+
+            _mm_storeu_ps(out, _mm_add_ps(_mm_mul_ps(start, MTH_SWIZZLE(coefficients, 1, 1, 1, 1)),
+                                          _mm_mul_ps(end, MTH_SWIZZLE(coefficients, 0, 0, 0, 0))));
+        }
+    }
+
+
+    // Convert an array of quaternions (w, x, y, z) to column-major
+    // 4x4 rotation matrices. Quaternions are transposed 4 at a time so each
+    // matrix element of 4 matrices is one register, then transposed back
+    // to columns
+    inline void     QuaternionsToMatrices4(const float* quaternions, float* out, std::size_t count) noexcept
+    {
+        const __m128    two = _mm_set1_ps(2.f);
+        const __m128    lastColumn = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
+
+        for (std::size_t index = 0; index < count; index += 4)
+        {
+            const std::size_t   remaining = (count - index < 4) ? count - index : 4;
+
+            // Pad the last block with identity quaternions
+            alignas(16) float   padded[16] = { 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f,
+                                               1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f };
+            const float*        source = quaternions + index * 4;
+            float*              destination = out + index * 16;
+
+            if (remaining < 4)
+            {
+                for (std::size_t value = 0; value < remaining * 4; ++value)
+                    padded[value] = source[value];
+
+                source = padded;
+            }
+
+            __m128      w = _mm_loadu_ps(source), x = _mm_loadu_ps(source + 4);
+            __m128      y = _mm_loadu_ps(source + 8), z = _mm_loadu_ps(source + 12);
+
+            _MM_TRANSPOSE4_PS(w, x, y, z);
+
+            // Squares, and doubled products for the off-diagonal terms
+            const __m128    ww = _mm_mul_ps(w, w), xx = _mm_mul_ps(x, x);
+            const __m128    yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+            const __m128    x2 = _mm_mul_ps(x, two), y2 = _mm_mul_ps(y, two), z2 = _mm_mul_ps(z, two);
+            const __m128    xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+            const __m128    wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+
+            // Same terms as Quaternion::RotationMatrix
+            __m128      m00 = _mm_sub_ps(_mm_add_ps(ww, xx), _mm_add_ps(yy, zz));
+            __m128      m01 = _mm_add_ps(xy, wz);
+            __m128      m02 = _mm_sub_ps(xz, wy);
+            __m128      m10 = _mm_sub_ps(xy, wz);
+            __m128      m11 = _mm_sub_ps(_mm_add_ps(ww, yy), _mm_add_ps(xx, zz));
+            __m128      m12 = _mm_add_ps(yz, wx);
+            __m128      m20 = _mm_add_ps(xz, wy);
+            __m128      m21 = _mm_sub_ps(yz, wx);
+            __m128      m22 = _mm_sub_ps(_mm_add_ps(ww, zz), _mm_add_ps(xx, yy));
+            __m128      zero0 = _mm_setzero_ps(), zero1 = _mm_setzero_ps(), zero2 = _mm_setzero_ps();
+
+            // Lane i of each register becomes column 0, 1 or 2 of matrix i
+            _MM_TRANSPOSE4_PS(m00, m01, m02, zero0);
+            _MM_TRANSPOSE4_PS(m10, m11, m12, zero1);
+            _MM_TRANSPOSE4_PS(m20, m21, m22, zero2);
+
+            if (remaining == 4)
+            {
+                _mm_storeu_ps(destination, m00);
+                _mm_storeu_ps(destination + 4, m10);
+                _mm_storeu_ps(destination + 8, m20);
+                _mm_storeu_ps(destination + 12, lastColumn);
+                _mm_storeu_ps(destination + 16, m01);
+                _mm_storeu_ps(destination + 20, m11);
+                _mm_storeu_ps(destination + 24, m21);
+                _mm_storeu_ps(destination + 28, lastColumn);
+                _mm_storeu_ps(destination + 32, m02);
+                _mm_storeu_ps(destination + 36, m12);
+                _mm_storeu_ps(destination + 40, m22);
+                _mm_storeu_ps(destination + 44, lastColumn);
+                _mm_storeu_ps(destination + 48, zero0);
+                _mm_storeu_ps(destination + 52, zero1);
+                _mm_storeu_ps(destination + 56, zero2);
+                _mm_storeu_ps(destination + 60, lastColumn);
+                continue;
+            }
+
+            const __m128    columns[4][3] =
+            {
+                { m00, m10, m20 }, { m01, m11, m21 }, { m02, m12, m22 }, { zero0, zero1, zero2 }
+            };
+
+            for (std::size_t matrix = 0; matrix < remaining; ++matrix)
+            {
+                _mm_storeu_ps(destination + matrix * 16, columns[matrix][0]);
+                _mm_storeu_ps(destination + matrix * 16 + 4, columns[matrix][1]);
+                _mm_storeu_ps(destination + matrix * 16 + 8, columns[matrix][2]);
+                _mm_storeu_ps(destination + matrix * 16 + 12, lastColumn);
+            }
+        }
+    }
+
+
+    // Dot product of two 4-lane vectors, broadcast to every lane
+    inline __m128   DotBroadcast4(__m128 lhs, __m128 rhs) noexcept
+    {
+        __m128      dot = _mm_mul_ps(lhs, rhs);
+
+        dot = _mm_add_ps(dot, MTH_SWIZZLE(dot, 1, 0, 3, 2));
+        return _mm_add_ps(dot, MTH_SWIZZLE(dot, 2, 3, 0, 1));
+    }
+
+
+    // Normalize a dual quaternion held as real and dual registers,
+    // see DualQuaternion::Normalize
+    inline void     NormalizeDualQuaternion(__m128& real, __m128& dual) noexcept
+    {
+        const __m128    invLength = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(DotBroadcast4(real, real)));
+        const __m128    parallel = _mm_mul_ps(DotBroadcast4(real, dual), _mm_mul_ps(invLength, invLength));
+
+        dual = _mm_mul_ps(_mm_sub_ps(dual, _mm_mul_ps(real, parallel)), invLength);
+        real = _mm_mul_ps(real, invLength);
+    }
+
+
+    // Blend arrays of dual quaternions (real w, x, y, z then dual w, x, y, z)
+    // with the same ratio along the shortest path, then normalize (DLB).
+    // out may be the same array as from or to
+    inline void     NlerpDualQuaternions(const float* from, const float* to, float* out, std::size_t count,
+                                         float ratio) noexcept
+    {
+        const __m128    fromRatio = _mm_set1_ps(1.f - ratio);
+        const __m128    toRatio = _mm_set1_ps(ratio);
+        const __m128    signBit = _mm_set1_ps(-0.f);
+
+        for (std::size_t index = 0; index < count; ++index, from += 8, to += 8, out += 8)
+        {
+            const __m128    fromReal = _mm_loadu_ps(from), fromDual = _mm_loadu_ps(from + 4);
+            const __m128    toReal = _mm_loadu_ps(to), toDual = _mm_loadu_ps(to + 4);
+
+            // Flip both parts of to when the rotations are more than half a turn apart
+            const __m128    weight = _mm_xor_ps(toRatio, _mm_and_ps(DotBroadcast4(fromReal, toReal), signBit));
+
+            __m128          real = _mm_add_ps(_mm_mul_ps(fromReal, fromRatio), _mm_mul_ps(toReal, weight));
+            __m128          dual = _mm_add_ps(_mm_mul_ps(fromDual, fromRatio), _mm_mul_ps(toDual, weight));
+
+            NormalizeDualQuaternion(real, dual);
+
+            _mm_storeu_ps(out, real);
+            _mm_storeu_ps(out + 4, dual);
+        }
+    }
+
+
+    // Blend palette dual quaternions for each vertex with the given indices
+    // and weights (influences per vertex, one vertex after the other), then
+    // normalize. Signs are matched to the first influence of each vertex
+    inline void     BlendDualQuaternions(const float* palette, const std::uint32_t* indices, const float* weights,
+                                         float* out, std::size_t count, std::size_t influences) noexcept
+    {
+        const __m128    signBit = _mm_set1_ps(-0.f);
+
+        for (std::size_t vertex = 0; vertex < count; ++vertex, out += 8)
+        {
+            const float*    first = palette + 8 * static_cast<std::size_t>(*indices);
+            const __m128    pivot = _mm_loadu_ps(first);
+            const __m128    firstWeight = _mm_set1_ps(*weights);
+
+            __m128          real = _mm_mul_ps(pivot, firstWeight);
+            __m128          dual = _mm_mul_ps(_mm_loadu_ps(first + 4), firstWeight);
+
+            ++indices;
+            ++weights;
+
+            for (std::size_t influence = 1; influence < influences; ++influence, ++indices, ++weights)
+            {
+                const float*    transform = palette + 8 * static_cast<std::size_t>(*indices);
+                const __m128    transformReal = _mm_loadu_ps(transform);
+                const __m128    weight = _mm_xor_ps(_mm_set1_ps(*weights),
+                                                    _mm_and_ps(DotBroadcast4(pivot, transformReal), signBit));
+
+                real = _mm_add_ps(real, _mm_mul_ps(transformReal, weight));
+                dual = _mm_add_ps(dual, _mm_mul_ps(_mm_loadu_ps(transform + 4), weight));
+            }
+
+            NormalizeDualQuaternion(real, dual);
+
+            _mm_storeu_ps(out, real);
+            _mm_storeu_ps(out + 4, dual);
+        }
+    }
+
+#endif
+
+
+#ifdef MTH_SIMD_AVX
+
+    // Double precision version, one 256-bit register per column
+    inline void     MultiplyMatrix4(const double* lhs, const double* rhs, double* result) noexcept
+    {
+        const __m256d   column0 = _mm256_loadu_pd(lhs);
+        const __m256d   column1 = _mm256_loadu_pd(lhs + 4);
+        const __m256d   column2 = _mm256_loadu_pd(lhs + 8);
+        const __m256d   column3 = _mm256_loadu_pd(lhs + 12);
+
+        __m256d         results[4];
+
+        for (int column = 0; column < 4; ++column)
+        {
+            const double*   rhsColumn = rhs + column * 4;
+
+            __m256d     sum = _mm256_mul_pd(column0, _mm256_set1_pd(rhsColumn[0]));
+
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(column1, _mm256_set1_pd(rhsColumn[1])));
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(column2, _mm256_set1_pd(rhsColumn[2])));
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(column3, _mm256_set1_pd(rhsColumn[3])));
+
+            results[column] = sum;
+        }
+
+        for (int column = 0; column < 4; ++column)
+            _mm256_storeu_pd(result + column * 4, results[column]);
+    }
+
+#endif
+
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -0,0 +1,334 @@
+#ifndef __TRANSFORM_HIERARCHY_H__
+#define __TRANSFORM_HIERARCHY_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "MathGeneric.hpp"
+
+#include "Vector3.hpp"
+#include "Matrix4.hpp"
+#include "Quaternion.hpp"
+
+namespace math
+{
+    // Scene graph of local transforms (position, rotation, scale) and
+    // their world matrices, stored as structure-of-arrays.
+    // Nodes are only appended after their parent, so the arrays are always
+    // sorted topologically and one linear pass is enough to update them.
+    // Changing a local transform marks the node dirty, and Update only
+    // recomputes dirty nodes and their descendants
+    template <CFloatingType TValueType>
+    class TransformHierarchy
+    {
+    public:
+
+        // Parent index of root nodes
+        static constexpr uint32_t       NoParent = UINT32_MAX;
+
+        TransformHierarchy(void) = default;
+        TransformHierarchy(const TransformHierarchy&) = default;
+        TransformHierarchy(TransformHierarchy&&) noexcept = default;
+
+        ~TransformHierarchy(void) = default;
+
+        // Allocate memory for a number of nodes
+        void                            Reserve(std::size_t count);
+
+        // Remove all nodes
+        void                            Clear(void);
+
+        // Append a node and get its index. The parent must already exist
+        // (or be NoParent for a root). The node starts dirty
+        uint32_t                        AddNode(uint32_t parent,
+                                                const Vector3<TValueType>& position = Vector3<TValueType>::Zero(),
+                                                const Quaternion<TValueType>& rotation = Quaternion<TValueType>::Identity(),
+                                                const Vector3<TValueType>& scale = Vector3<TValueType>::One());
+
+        // Set local transform values, then mark the node dirty
+        void                            SetLocalPosition(uint32_t node, const Vector3<TValueType>& position);
+        void                            SetLocalRotation(uint32_t node, const Quaternion<TValueType>& rotation);
+        void                            SetLocalScale(uint32_t node, const Vector3<TValueType>& scale);
+        void                            SetLocalTransform(uint32_t node, const Vector3<TValueType>& position,
+                                                          const Quaternion<TValueType>& rotation,
+                                                          const Vector3<TValueType>& scale);
+
+        // Recompute this node's world matrix and its descendants' on next update
+        void                            MarkDirty(uint32_t node);
+
+        // Recompute world matrices of all dirty nodes and their descendants
+        void                            Update(void);
+
+        bool                            IsDirty(uint32_t node)                  const;
+
+        uint32_t                        GetParent(uint32_t node)                const;
+
+        const Vector3<TValueType>&      GetLocalPosition(uint32_t node)         const;
+        const Quaternion<TValueType>&   GetLocalRotation(uint32_t node)         const;
+        const Vector3<TValueType>&      GetLocalScale(uint32_t node)            const;
+
+        // World matrix as of the last update
+        const Matrix4<TValueType>&      GetWorldMatrix(uint32_t node)           const;
+
+        // All world matrices as of the last update, in node order
+        std::span<const Matrix4<TValueType>>    WorldMatrices(void)             const;
+
+        std::size_t                     Size(void)                              const;
+
+        TransformHierarchy&             operator=(const TransformHierarchy&) = default;
+        TransformHierarchy&             operator=(TransformHierarchy&&) noexcept = default;
+
+    private:
+
+        void                            CheckIndex(uint32_t node)               const;
+
+        std::vector<uint32_t>           m_parents;
+        std::vector<Vector3<TValueType>>        m_positions;
+        std::vector<Quaternion<TValueType>>     m_rotations;
+        std::vector<Vector3<TValueType>>        m_scales;
+        std::vector<Matrix4<TValueType>>        m_worlds;
+
+        // One flag per node, only set from m_firstDirty onwards
+        std::vector<uint8_t>            m_dirty;
+        std::size_t                     m_firstDirty = 0;
+    };
+
+
+    using TransformHierarchyf = TransformHierarchy<float>;
+    using TransformHierarchyd = TransformHierarchy<double>;
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::Reserve(std::size_t count)
+    {
+        m_parents.reserve(count);
+        m_positions.reserve(count);
+        m_rotations.reserve(count);
+        m_scales.reserve(count);
+        m_worlds.reserve(count);
+        m_dirty.reserve(count);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::Clear(void)
+    {
+        m_parents.clear();
+        m_positions.clear();
+        m_rotations.clear();
+        m_scales.clear();
+        m_worlds.clear();
+        m_dirty.clear();
+        m_firstDirty = 0;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    uint32_t TransformHierarchy<TValueType>::AddNode(uint32_t parent, const Vector3<TValueType>& position,
+                                                     const Quaternion<TValueType>& rotation,
+                                                     const Vector3<TValueType>& scale)
+    {
+        // Parents always come first, which keeps the arrays sorted
+        if (parent != NoParent && parent >= m_parents.size())
+            throw std::logic_error("Parent index out of range");
+
+        if (m_parents.size() >= NoParent)
+            throw std::logic_error("Too many nodes in hierarchy");
+
+        const uint32_t      node = static_cast<uint32_t>(m_parents.size());
+
+        m_parents.push_back(parent);
+        m_positions.push_back(position);
+        m_rotations.push_back(rotation);
+        m_scales.push_back(scale);
+        m_worlds.emplace_back(static_cast<TValueType>(1));
+        m_dirty.push_back(1);
+
+        m_firstDirty = std::min<std::size_t>(m_firstDirty, node);
+        return node;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::SetLocalPosition(uint32_t node, const Vector3<TValueType>& position)
+    {
+        MarkDirty(node);
+        m_positions[node] = position;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::SetLocalRotation(uint32_t node, const Quaternion<TValueType>& rotation)
+    {
+        MarkDirty(node);
+        m_rotations[node] = rotation;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::SetLocalScale(uint32_t node, const Vector3<TValueType>& scale)
+    {
+        MarkDirty(node);
+        m_scales[node] = scale;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::SetLocalTransform(uint32_t node, const Vector3<TValueType>& position,
+                                                           const Quaternion<TValueType>& rotation,
+                                                           const Vector3<TValueType>& scale)
+    {
+        MarkDirty(node);
+        m_positions[node] = position;
+        m_rotations[node] = rotation;
+        m_scales[node] = scale;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::MarkDirty(uint32_t node)
+    {
+        CheckIndex(node);
+
+        // Descendants are only flagged during the update pass
+        m_dirty[node] = 1;
+        m_firstDirty = std::min<std::size_t>(m_firstDirty, node);
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::Update(void)
+    {
+        const std::size_t       count = m_parents.size();
+
+        // Nodes before the first dirty one cannot be affected: their
+        // parents come before them too
+        for (std::size_t node = m_firstDirty; node < count; ++node)
+        {
+            const uint32_t      parent = m_parents[node];
+
+            // The parent was visited first, so its flag is already final
+            if (parent != NoParent)
+                m_dirty[node] |= m_dirty[parent];
+
+            if (!m_dirty[node])
+                continue;
+
+            const Matrix4<TValueType>   local = Matrix4<TValueType>::TRS(m_positions[node], m_rotations[node],
+                                                                         m_scales[node]);
+
+            if (parent == NoParent)
+                m_worlds[node] = local;
+
+            else
+                m_worlds[node] = m_worlds[parent] * local;
+        }
+
+        // Flags are only cleared once all children have read them
+        if (m_firstDirty < count)
+            std::fill(m_dirty.begin() + static_cast<std::ptrdiff_t>(m_firstDirty), m_dirty.end(), uint8_t(0));
+
+        m_firstDirty = count;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    bool TransformHierarchy<TValueType>::IsDirty(uint32_t node) const
+    {
+        CheckIndex(node);
+
+        if (m_dirty[node])
+            return true;
+
+        // Not flagged yet, but will be updated with an ancestor
+        for (uint32_t parent = m_parents[node]; parent != NoParent && parent >= m_firstDirty; parent = m_parents[parent])
+        {
+            if (m_dirty[parent])
+                return true;
+        }
+
+        return false;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    uint32_t TransformHierarchy<TValueType>::GetParent(uint32_t node) const
+    {
+        CheckIndex(node);
+        return m_parents[node];
+    }
+
+
+    template <CFloatingType TValueType> inline
+    const Vector3<TValueType>& TransformHierarchy<TValueType>::GetLocalPosition(uint32_t node) const
+    {
+        CheckIndex(node);
+        return m_positions[node];
+    }
+
+
+    template <CFloatingType TValueType> inline
+    const Quaternion<TValueType>& TransformHierarchy<TValueType>::GetLocalRotation(uint32_t node) const
+    {
+        CheckIndex(node);
+        return m_rotations[node];
+    }
+
+
+    template <CFloatingType TValueType> inline
+    const Vector3<TValueType>& TransformHierarchy<TValueType>::GetLocalScale(uint32_t node) const
+    {
+        CheckIndex(node);
+        return m_scales[node];
+    }
+
+
+    template <CFloatingType TValueType> inline
+    const Matrix4<TValueType>& TransformHierarchy<TValueType>::GetWorldMatrix(uint32_t node) const
+    {
+        CheckIndex(node);
+        return m_worlds[node];
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::span<const Matrix4<TValueType>> TransformHierarchy<TValueType>::WorldMatrices(void) const
+    {
+        return m_worlds;
+    }
+
+
+    template <CFloatingType TValueType> inline
+    std::size_t TransformHierarchy<TValueType>::Size(void) const
+    {
+        return m_parents.size();
+    }
+
+
+    template <CFloatingType TValueType> inline
+    void TransformHierarchy<TValueType>::CheckIndex(uint32_t node) const
+    {
+        if (node >= m_parents.size())
+            throw std::logic_error("Node index out of range");
+    }
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class TransformHierarchy<float>;
+    extern template class TransformHierarchy<double>;
+}
+
+#endif
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -2,32 +2,72 @@
 #define __TRIGONOMETRY_H__
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
 
 #include "Angle.hpp"
 
-// Number of times cos should run its loop
-#define COS_IT		6u
-
 #define MIN_COS		-1.f
 #define MAX_COS		1.f
 
 
 namespace math
 {
-	// Compute cosine of an angle in radians using
-	// 6 iterations of Taylor's series
-	template <CScalarType TValueType> inline
+	// Sin / Cos reduce the angle to [-pi / 4, pi / 4] and evaluate
+	// minimax polynomials (Cephes coefficients) when MY_TRIG_IMPL is defined
+	// or when evaluated at compile time, libm is used otherwise.
+	// Max error measured against long double libm: float 1.6 ulp on [-pi, pi]
+	// and 2.4 ulp up to |x| = 12000, double 1.6 ulp up to |x| = 1e9.
+	// Long double uses the double polynomials.
+	// The reduction is only exact up to SinCosMaxAngle, larger and non-finite
+	// angles fall back to libm (they do not compile in constant expressions)
+
+	// Compute cosine of an angle in radians
+	template <CScalarType TValueType> constexpr
 	TValueType		Cos(const Radian<TValueType>& rad);
 
-	// Compute sine using Cos with a pi / 2 offset
-	template <CScalarType TValueType> inline
+	// Compute sine of an angle in radians
+	template <CScalarType TValueType> constexpr
 	TValueType		Sin(const Radian<TValueType>& rad);
 
 	// Compute tan using sin / cos
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType		Tan(const Radian<TValueType>& rad);
 
+	// Compute both sine and cosine with a single range reduction
+	template <CScalarType TValueType> constexpr
+	void			SinCos(const Radian<TValueType>& rad, TValueType& sine, TValueType& cosine);
+
+	// Batch versions, polynomial and branch-free so loops vectorize.
+	// Blocks holding an angle outside SinCosMaxAngle use libm instead.
+	// Angles are in radians, output spans must be as large as the input.
+	// The type is deduced from the output span, the float and double
+	// overloads also take containers (e.g. std::vector) directly
+
+	template <CFloatingType TValueType> inline
+	void			Cos(std::type_identity_t<std::span<const TValueType>> radians,
+						std::span<TValueType> cosines);
+
+	template <CFloatingType TValueType> inline
+	void			Sin(std::type_identity_t<std::span<const TValueType>> radians,
+						std::span<TValueType> sines);
+
+	template <CFloatingType TValueType> inline
+	void			SinCos(std::type_identity_t<std::span<const TValueType>> radians,
+						   std::span<TValueType> sines, std::span<TValueType> cosines);
+
+	inline void		Cos(std::span<const float> radians, std::span<float> cosines);
+	inline void		Cos(std::span<const double> radians, std::span<double> cosines);
+
+	inline void		Sin(std::span<const float> radians, std::span<float> sines);
+	inline void		Sin(std::span<const double> radians, std::span<double> sines);
+
+	inline void		SinCos(std::span<const float> radians, std::span<float> sines, std::span<float> cosines);
+	inline void		SinCos(std::span<const double> radians, std::span<double> sines, std::span<double> cosines);
+
 	// Inverse trigonometry
 
 	template <CScalarType TValueType> inline
@@ -45,54 +85,111 @@ namespace math
 	Radian<TValueType>		Atan2(TValueType y, TValueType x);
 
 
-	// Class made to hold factorials for cos
-	template <CScalarType TValueType>
-	class Factorials
-	{
-	public:
 
-				Factorials(void) = default;
 
 
-		static const TValueType		m_evenFacts[6];
-	};
 
 
 
 
+	// Largest angle the polynomial path reduces accurately: 2^13 quadrants
+	// for float (exact Cody-Waite products), below 2^30 quadrants for double
+	template <CFloatingType TValueType>
+	constexpr TValueType	SinCosMaxAngle = std::is_same_v<TValueType, float> ?
+		static_cast<TValueType>(12800) : static_cast<TValueType>(1e9);
 
+	// False for angles out of the polynomial range, infinity and NaN
+	template <CFloatingType TValueType> constexpr
+	bool InSinCosRange(TValueType radians) noexcept
+	{
+		return (radians >= -SinCosMaxAngle<TValueType>) & (radians <= SinCosMaxAngle<TValueType>);
+	}
 
+	// Polynomial sine and cosine shared by scalar and batch functions.
+	// Only accurate in SinCosMaxAngle, other angles give sin(0) and cos(0)
+	template <CFloatingType TValueType> constexpr
+	void InternalSinCos(TValueType radians, TValueType& sine, TValueType& cosine) noexcept
+	{
+		constexpr bool		isFloat = std::is_same_v<TValueType, float>;
 
+		constexpr TValueType	twoOverPi = static_cast<TValueType>(0.636619772367581343076L);
 
+		// pi / 2 split in parts with few significant bits (Cody-Waite)
+		// so quadrant * part stays exact and the reduction keeps its precision.
+		// Float needs a fourth part to stay exact for quadrants up to 2^13
+		constexpr TValueType	piOverTwoA = isFloat ?
+			static_cast<TValueType>(1.5703125) : static_cast<TValueType>(1.57079625129699707031);
 
-	// Cos specifically made for sin to avoid constructing another Radian object
-	template <CScalarType TValueType> inline
-	static TValueType InternalCos(TValueType val)
-	{
-		TValueType	  powResult, cosResult = 0.f, itResult;
+		constexpr TValueType	piOverTwoB = isFloat ?
+			static_cast<TValueType>(4.837512969970703125e-4) :
+			static_cast<TValueType>(7.54978941586159635336e-8);
 
-		// Wrap angle between -pi and pi as 6 iterations of
-		// Taylor's series get less accurate as the angle approaches
-		// -2 pi or +2pi
-		TValueType	  radians = Wrap(val, -MTH_PI, MTH_PI);
+		constexpr TValueType	piOverTwoC = isFloat ?
+			static_cast<TValueType>(7.54953362047672271728515625e-8) :
+			static_cast<TValueType>(5.39030285815811905290e-15);
 
+		constexpr TValueType	piOverTwoD = isFloat ?
+			static_cast<TValueType>(2.56334406825708960298e-12) : static_cast<TValueType>(0);
 
-		for (unsigned int it = 1; it <= COS_IT; ++it)
-		{
-			// Get numerator, angle raised to the power of
-			// an even number
-			powResult = Pow(radians, it * 2);
+		constexpr TValueType	half = static_cast<TValueType>(0.5);
+		constexpr TValueType	one = static_cast<TValueType>(1);
+
+		// Out of range angles are zeroed so the conversion below is defined
+		radians = InSinCosRange(radians) ? radians : static_cast<TValueType>(0);
 
-			// Divide result by factorial of said power * sign
-			itResult = powResult * math::Factorials<TValueType>::m_evenFacts[it - 1];
+		// Nearest multiple of pi / 2, 32 bits so the conversion vectorizes
+		const TValueType	scaled = radians * twoOverPi;
+		const int32_t		quadrant = static_cast<int32_t>(scaled + (scaled < 0 ? -half : half));
+		const TValueType	multiple = static_cast<TValueType>(quadrant);
 
-			cosResult += itResult;
+		// Reduced angle in [-pi / 4, pi / 4]
+		TValueType			reduced = ((radians - multiple * piOverTwoA) - multiple * piOverTwoB) -
+									  multiple * piOverTwoC;
+
+		if constexpr (isFloat)
+			reduced -= multiple * piOverTwoD;
+
+		const TValueType	squared = reduced * reduced;
+		TValueType			sinPoly, cosPoly;
+
+		// Horner evaluation of odd (sin) and even (cos) polynomials
+		if constexpr (isFloat)
+		{
+			sinPoly = ((-1.9515295891e-4f * squared + 8.3321608736e-3f) * squared -
+					  1.6666654611e-1f) * squared;
 
+			cosPoly = ((2.443315711809948e-5f * squared - 1.388731625493765e-3f) * squared +
+					  4.166664568298827e-2f) * squared * squared;
 		}
+		else
+		{
+			sinPoly = (((((static_cast<TValueType>(1.58962301576546568060e-10) * squared -
+						static_cast<TValueType>(2.50507477628578072866e-8)) * squared +
+						static_cast<TValueType>(2.75573136213857245213e-6)) * squared -
+						static_cast<TValueType>(1.98412698295895385996e-4)) * squared +
+						static_cast<TValueType>(8.33333333332211858878e-3)) * squared -
+						static_cast<TValueType>(1.66666666666666307295e-1)) * squared;
+
+			cosPoly = (((((static_cast<TValueType>(-1.13585365213876817300e-11) * squared +
+						static_cast<TValueType>(2.08757008419747316778e-9)) * squared -
+						static_cast<TValueType>(2.75573141792967388112e-7)) * squared +
+						static_cast<TValueType>(2.48015872888517045348e-5)) * squared -
+						static_cast<TValueType>(1.38888888888730564116e-3)) * squared +
+						static_cast<TValueType>(4.16666666666665929218e-2)) * squared * squared;
+		}
+
+		const TValueType	sinReduced = reduced + reduced * sinPoly;
+		const TValueType	cosReduced = (one - half * squared) + cosPoly;
 
-		cosResult = 1.f - cosResult;
+		// Odd quadrants swap sine and cosine, then signs follow the quadrant:
+		// sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2
+		const bool			swap = (quadrant & 1) != 0;
 
-		return cosResult;
+		const TValueType	sinValue = swap ? cosReduced : sinReduced;
+		const TValueType	cosValue = swap ? sinReduced : cosReduced;
+
+		sine = (quadrant & 2) ? -sinValue : sinValue;
+		cosine = ((quadrant + 1) & 2) ? -cosValue : cosValue;
 	}
 
 	template <CScalarType TValueType> inline
@@ -110,74 +207,240 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Cos(const Radian<TValueType>& rad)
 	{
 #ifdef MY_TRIG_IMPL
-		// Wrap angle between -pi and pi as 6 iterations of
-		// Taylor's series get less accurate as the angle approaches
-		// -2 pi or +2pi
-		TValueType	radians = rad.Rad(true);
-		TValueType	powResult, cosResult = 0.f, itResult;
+		TValueType		sine, cosine;
 
-		for (unsigned int it = 1; it <= COS_IT; ++it)
+		SinCos(rad, sine, cosine);
+		return cosine;
+#else
+		if (std::is_constant_evaluated())
 		{
-			// Get numerator, angle raised to the power of
-			// an even number
-			powResult = Pow(radians, it * 2);
-
-			// Divide result by factorial of said power * sign
-			itResult = powResult * math::Factorials<TValueType>::m_evenFacts[it - 1];
-
-			cosResult += itResult;
+			TValueType		sine, cosine;
 
+			SinCos(rad, sine, cosine);
+			return cosine;
 		}
 
-		cosResult = 1.f - cosResult;
-
-		return cosResult;
-#else
 		return static_cast<TValueType>(cos(rad.Raw()));
 #endif
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Sin(const Radian<TValueType>& rad)
 	{
 #ifdef MY_TRIG_IMPL
-		// Apply 90 degree offset
-		// See: https://upload.wikimedia.org/wikipedia/commons/thumb/7/71/Sine_cosine_one_period.svg/1920px-Sine_cosine_one_period.svg.png
-		constexpr TValueType		piOverTwo = 1.570796326794896619231f;
-
-		// cos x == cos -x so get absolute value of angle to apply offset easily
-		TValueType				cosine = InternalCos(Absolute(rad.Raw()) - piOverTwo);
+		TValueType		sine, cosine;
 
+		SinCos(rad, sine, cosine);
+		return sine;
+#else
+		if (std::is_constant_evaluated())
+		{
+			TValueType		sine, cosine;
 
-		// Restore sign of angle as sine is an odd function,
-		// which means sin -x == -sinx
-		if (rad.Raw() < 0.f)
-			return -cosine;
-
-		else return cosine;
+			SinCos(rad, sine, cosine);
+			return sine;
+		}
 
-		// TODO: optimize
-#else
 		return static_cast<TValueType>(sin(rad.Raw()));
 #endif
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Tan(const Radian<TValueType>& rad)
 	{
 #ifdef MY_TRIG_IMPL
 		// tan x = sin x / cos x
-		return Sin(rad) / Cos(rad);
+		TValueType		sine, cosine;
+
+		SinCos(rad, sine, cosine);
+		return sine / cosine;
 #else
+		if (std::is_constant_evaluated())
+		{
+			TValueType		sine, cosine;
+
+			SinCos(rad, sine, cosine);
+			return sine / cosine;
+		}
+
 		return static_cast<TValueType>(tan(rad.Raw()));
 #endif
-		// TODO: needs to be faster
+	}
+
+
+	template <CScalarType TValueType> constexpr
+	void SinCos(const Radian<TValueType>& rad, TValueType& sine, TValueType& cosine)
+	{
+#ifndef MY_TRIG_IMPL
+		if (!std::is_constant_evaluated())
+		{
+			sine = static_cast<TValueType>(sin(rad.Raw()));
+			cosine = static_cast<TValueType>(cos(rad.Raw()));
+			return;
+		}
+#endif
+
+		// Polynomial path, also used for constant evaluation.
+		// Integral angles are evaluated in double precision
+		using TComputeType = std::conditional_t<std::is_floating_point_v<TValueType>,
+												TValueType, double>;
+
+		const TComputeType	radians = static_cast<TComputeType>(rad.Raw());
+		TComputeType		computedSin = 0, computedCos = 0;
+
+		if (InSinCosRange(radians))
+			InternalSinCos(radians, computedSin, computedCos);
+
+		else if (std::is_constant_evaluated())
+			throw std::logic_error("Angle out of constant evaluation range");
+
+		else
+		{
+			computedSin = static_cast<TComputeType>(sin(radians));
+			computedCos = static_cast<TComputeType>(cos(radians));
+		}
+
+		sine = static_cast<TValueType>(computedSin);
+		cosine = static_cast<TValueType>(computedCos);
+	}
+
+
+	// Run a batch kernel block by block. Each block is range checked
+	// before anything is written so spans may alias, and blocks with an angle
+	// out of the polynomial range go through the scalar SinCos instead
+	template <CFloatingType TValueType, typename TKernel> inline
+	void BatchSinCos(std::span<const TValueType> radians, TKernel&& kernel)
+	{
+		constexpr std::size_t	blockSize = 256;
+
+		for (std::size_t start = 0; start < radians.size(); start += blockSize)
+		{
+			const std::size_t	end = (radians.size() - start < blockSize) ?
+									  radians.size() : start + blockSize;
+			bool				inRange = true;
+
+			for (std::size_t index = start; index < end; ++index)
+				inRange &= InSinCosRange(radians[index]);
+
+			if (inRange)
+			{
+				for (std::size_t index = start; index < end; ++index)
+				{
+					TValueType		sine, cosine;
+
+					InternalSinCos(radians[index], sine, cosine);
+					kernel(index, sine, cosine);
+				}
+			}
+			else
+			{
+				for (std::size_t index = start; index < end; ++index)
+				{
+					TValueType		sine, cosine;
+
+					if (InSinCosRange(radians[index]))
+						InternalSinCos(radians[index], sine, cosine);
+
+					else
+					{
+						sine = static_cast<TValueType>(sin(radians[index]));
+						cosine = static_cast<TValueType>(cos(radians[index]));
+					}
+
+					kernel(index, sine, cosine);
+				}
+			}
+		}
+	}
+
+
+	template <CFloatingType TValueType> inline
+	void Cos(std::type_identity_t<std::span<const TValueType>> radians, std::span<TValueType> cosines)
+	{
+		if (cosines.size() != radians.size())
+			throw std::logic_error("Output span size does not match input size");
+
+		TValueType* const	cosOut = cosines.data();
+
+		BatchSinCos(radians, [cosOut](std::size_t index, TValueType, TValueType cosine)
+		{
+			cosOut[index] = cosine;
+		});
+	}
+
+
+	template <CFloatingType TValueType> inline
+	void Sin(std::type_identity_t<std::span<const TValueType>> radians, std::span<TValueType> sines)
+	{
+		if (sines.size() != radians.size())
+			throw std::logic_error("Output span size does not match input size");
+
+		TValueType* const	sinOut = sines.data();
+
+		BatchSinCos(radians, [sinOut](std::size_t index, TValueType sine, TValueType)
+		{
+			sinOut[index] = sine;
+		});
+	}
+
+
+	template <CFloatingType TValueType> inline
+	void SinCos(std::type_identity_t<std::span<const TValueType>> radians,
+				std::span<TValueType> sines, std::span<TValueType> cosines)
+	{
+		if (sines.size() != radians.size() || cosines.size() != radians.size())
+			throw std::logic_error("Output span size does not match input size");
+
+		TValueType* const	sinOut = sines.data();
+		TValueType* const	cosOut = cosines.data();
+
+		BatchSinCos(radians, [sinOut, cosOut](std::size_t index, TValueType sine, TValueType cosine)
+		{
+			sinOut[index] = sine;
+			cosOut[index] = cosine;
+		});
+	}
+
+
+	inline void Cos(std::span<const float> radians, std::span<float> cosines)
+	{
+		Cos<float>(radians, cosines);
+	}
+
+
+	inline void Cos(std::span<const double> radians, std::span<double> cosines)
+	{
+		Cos<double>(radians, cosines);
+	}
+
+
+	inline void Sin(std::span<const float> radians, std::span<float> sines)
+	{
+		Sin<float>(radians, sines);
+	}
+
+
+	inline void Sin(std::span<const double> radians, std::span<double> sines)
+	{
+		Sin<double>(radians, sines);
+	}
+
+
+	inline void SinCos(std::span<const float> radians, std::span<float> sines, std::span<float> cosines)
+	{
+		SinCos<float>(radians, sines, cosines);
+	}
+
+
+	inline void SinCos(std::span<const double> radians, std::span<double> sines, std::span<double> cosines)
+	{
+		SinCos<double>(radians, sines, cosines);
 	}
 
 	// TODO: re-implement my own inverse trig functions
@@ -189,21 +452,21 @@ namespace math
 			throw std::logic_error("cannot compute acos for an integral type");
 
 		else
-			return Radian(acos(cosine));
+			return Radian<TValueType>(static_cast<TValueType>(acos(cosine)));
 	}
 
 
 	template <CScalarType TValueType> inline
 	Radian<TValueType> Asin(TValueType sine)
 	{
-		return Radian(asin(sine));
+		return Radian<TValueType>(static_cast<TValueType>(asin(sine)));
 	}
 
 
 	template <CScalarType TValueType> inline
 	Radian<TValueType> Atan(TValueType tangent)
 	{
-		return Radian(atan(tangent));
+		return Radian<TValueType>(static_cast<TValueType>(atan(tangent)));
 	}
 
 
@@ -232,23 +495,6 @@ namespace math
 		return angle;
 	}
 
-#ifdef MY_TRIG_IMPL
-
-	template <CScalarType TValueType> inline
-	const TValueType math::Factorials<TValueType>::m_evenFacts[] =
-	{
-		// Pre-compute even factorials and divisions
-		// for faster cosine execution
-		1.f / static_cast<TValueType>(Factorial(2)),
-		-1.f / static_cast<TValueType>(Factorial(4)),
-		1.f / static_cast<TValueType>(Factorial(6)),
-		-1.f / static_cast<TValueType>(Factorial(8)),
-		1.f / static_cast<TValueType>(Factorial(10)),
-		-1.f / static_cast<TValueType>(Factorial(12))
-	};
-
-#endif
-
 
 }
 
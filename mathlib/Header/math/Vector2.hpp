@@ -1,14 +1,17 @@
 #ifndef __VECTOR2_H__
 #define __VECTOR2_H__
 
+#include <cstdint>
 #include <string>
 #include <sstream>
+#include <span>
 
 #include "MathGeneric.hpp"
 #include "VectorGeneric.hpp"
 
 
 #include "Angle.hpp"
+#include "FastMath.hpp"
 #include "Trigonometry.hpp"
 
 
@@ -21,15 +24,15 @@ namespace math
 	public:
 		// Constructors / destructor
 
-		inline				Vector(void) = default;
+		constexpr				Vector(void) = default;
 
-		inline
+		constexpr
 		explicit			Vector(TValueType val);
 
-		inline				Vector(TValueType x, TValueType y);
-		inline				Vector(const Vector& other );
+		constexpr				Vector(TValueType x, TValueType y);
+		constexpr				Vector(const Vector& other );
 
-		inline				~Vector(void) = default;
+		constexpr				~Vector(void) = default;
 
 		// Get angle from this vector to another
 		inline
@@ -43,52 +46,61 @@ namespace math
 
 		// Compute cross product with another
 		// this x other
-		inline TValueType			Cross(const Vector& other)						const;
+		constexpr TValueType			Cross(const Vector& other)						const;
 
 		// Get distance between 2 points
-		inline TValueType			DistanceFrom(const Vector& other)					const;
+		constexpr TValueType			DistanceFrom(const Vector& other)					const;
 
 		// Get distance squared between two points
-		inline TValueType			DistanceSquaredFrom(const Vector& other)			const;
+		constexpr TValueType			DistanceSquaredFrom(const Vector& other)			const;
 
 		// Compute dot product of two vectors
-		inline TValueType			Dot(const Vector& other)							const;
+		constexpr TValueType			Dot(const Vector& other)							const;
 
 		// Is this vector's magnitude longer than another ?
-		inline bool			IsLongerThan(const Vector& other)					const;
+		constexpr bool			IsLongerThan(const Vector& other)					const;
 
 		// Is this vector's magnitude shorter than another ?
-		inline bool			IsShorterThan(const Vector& other)				const;
+		constexpr bool			IsShorterThan(const Vector& other)				const;
 
 		// Is this vector's magnitude equal to 1 ?
-		inline bool			IsUnitVector(void)									const;
+		constexpr bool			IsUnitVector(void)									const;
 
-		inline TValueType			Magnitude(void)										const;
-		inline TValueType			MagnitudeSquared(void)								const;
+		constexpr TValueType			Magnitude(void)										const;
+		constexpr TValueType			MagnitudeSquared(void)								const;
 
 		// Adjust vector to turn into unit vector
-		inline void			Normalize(void);
+		constexpr void			Normalize(void);
 
 		// Get copy of this vector as a unit vector
-		inline Vector			Normalized(void)									const;
+		constexpr Vector			Normalized(void)									const;
+
+		// Approximate Normalize using a reciprocal square root estimate,
+		// without zero magnitude check. See FastMath.hpp for precision tiers
+		template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+		inline void			NormalizeFast(void);
+
+		// Get copy of this vector as an approximate unit vector
+		template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+		inline Vector			NormalizedFast(void)									const;
 
 		// Get vector normal to this one
-		inline Vector			Normal(void)										const;
+		constexpr Vector			Normal(void)										const;
 
 		// Project this vector onto another
-		inline void			ProjectOnto(const Vector& other);
+		constexpr void			ProjectOnto(const Vector& other);
 
 		// Reflect this vector onto another
-		inline void			ReflectOnto(const Vector& axis);
+		constexpr void			ReflectOnto(const Vector& axis);
 
 		// Reflect this vector onto a UNIT vector
-		inline void			ReflectOntoUnit(const Vector& axis);
+		constexpr void			ReflectOntoUnit(const Vector& axis);
 
 		// Rotate this point around the z axis
-		inline void			Rotate(Radian<TValueType> angle);
+		constexpr void			Rotate(Radian<TValueType> angle);
 
 		// Multiply this vector's components by another's
-		inline void			Scale(const Vector& other);
+		constexpr void			Scale(const Vector& other);
 
 		// Get components as string
 		inline std::string		String(void)										const;
@@ -97,66 +109,66 @@ namespace math
 		inline std::string		StringLong(void)									const;
 
 		// Add another vector's components to this one's
-		inline void			Translate(const Vector& other);
+		constexpr void			Translate(const Vector& other);
 
 		// Accessors
 
-		inline TValueType&			X(void);
-		inline TValueType&			Y(void);
+		constexpr TValueType&			X(void);
+		constexpr TValueType&			Y(void);
 
-		inline TValueType			GetX(void)											const;
-		inline TValueType			GetY(void)											const;
+		constexpr TValueType			GetX(void)											const;
+		constexpr TValueType			GetY(void)											const;
 
 
-		inline Vector&		operator=(const Vector& rhs);
+		constexpr Vector&		operator=(const Vector& rhs);
 
-		inline TValueType&			operator[](int index);
-		inline TValueType			operator[](int index)								const;
+		constexpr TValueType&			operator[](int index);
+		constexpr TValueType			operator[](int index)								const;
 
 		// Boolean test operators
 
-		inline bool			operator==(const Vector& rhs)						const;
-		inline bool			operator!=(const Vector& rhs)						const;
+		constexpr bool			operator==(const Vector& rhs)						const;
+		constexpr bool			operator!=(const Vector& rhs)						const;
 
 		// Component-wise operations
 
-		inline Vector			operator+(const Vector& rhs)						const;
-		inline Vector			operator-(const Vector& rhs)						const;
-		inline Vector			operator*(const Vector& rhs)						const;
-		inline Vector			operator/(const Vector& rhs)						const;
+		constexpr Vector			operator+(const Vector& rhs)						const;
+		constexpr Vector			operator-(const Vector& rhs)						const;
+		constexpr Vector			operator*(const Vector& rhs)						const;
+		constexpr Vector			operator/(const Vector& rhs)						const;
 
 		// Multiply all components by a single scalar
-		inline Vector			operator*(TValueType rhs)								const;
+		constexpr Vector			operator*(TValueType rhs)								const;
 
 		// Divide all components by a single scalar
-		inline Vector			operator/(TValueType rhs)								const;
+		constexpr Vector			operator/(TValueType rhs)								const;
 
 		// Flip sign of both componenents
-		inline Vector			operator-(void)										const;
+		constexpr Vector			operator-(void)										const;
 
 
 		// Component-wise operations
 
-		inline Vector&		operator+=(const Vector& rhs);
-		inline Vector&		operator-=(const Vector& rhs);
-		inline Vector&		operator*=(const Vector& rhs);
-		inline Vector&		operator/=(const Vector& rhs);
+		constexpr Vector&		operator+=(const Vector& rhs);
+		constexpr Vector&		operator-=(const Vector& rhs);
+		constexpr Vector&		operator*=(const Vector& rhs);
+		constexpr Vector&		operator/=(const Vector& rhs);
 
 		// Multiply all components by a single scalar
-		inline Vector&		operator*=(TValueType rhs);
+		constexpr Vector&		operator*=(TValueType rhs);
 
 		// Divide all components by a single scalar
-		inline Vector&		operator/=(TValueType rhs);
+		constexpr Vector&		operator/=(TValueType rhs);
 
 
 		// Constants
 
-		inline static Vector	Zero(void);
-		inline static Vector	One(void);
-		inline static Vector	Up(void);
-		inline static Vector	Down(void);
-		inline static Vector	Left(void);
-		inline static Vector	Right(void);
+		constexpr static Vector	Zero(void);
+		constexpr static Vector	One(void);
+		constexpr static Vector	Up(void);
+		constexpr static Vector	Down(void);
+		constexpr static Vector	Left(void);
+		constexpr static Vector	Right(void);
 
 
 	private:
@@ -168,36 +180,50 @@ namespace math
 
 	// Non-member functions (similar to member functions but provided for readability)
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType				Dot(const Vector<2, TValueType>& first, const Vector<2, TValueType>& second);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType				Cross(const Vector<2, TValueType>& first, const Vector<2, TValueType>& second);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>				Reflect(const Vector<2, TValueType>& target, const Vector<2, TValueType>& ontoNormal);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>				ReflectUnit(const Vector<2, TValueType>& target, const Vector<2, TValueType>& ontoNormal);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>				Project(const Vector<2, TValueType>& target, const Vector<2, TValueType>& ontoVector);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>				Normalize(const Vector<2, TValueType>& target);
 
+	namespace fast
+	{
+		// Normalize every vector of an array in place, see NormalizeFast.
+		// The float and double overloads take spans or containers directly
+		template <EPrecision TPrecision = EPrecision::MEDIUM, CFloatingType TValueType> inline
+		void							Normalize(std::type_identity_t<std::span<Vector<2, TValueType>>> vectors);
 
-	template <CScalarType TValueType> inline
+		template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+		void							Normalize(std::span<Vector<2, float>> vectors);
+
+		template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+		void							Normalize(std::span<Vector<2, double>> vectors);
+	}
+
+
+	template <CScalarType TValueType> constexpr
 	TValueType				Distance(const Vector<2, TValueType>& start, const Vector<2, TValueType>& end);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType				DistanceSquared(const Vector<2, TValueType>& start, const Vector<2, TValueType>& end);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>				Rotate(const Vector<2, TValueType>& target, Radian<TValueType> angle);
 
 
@@ -216,16 +242,16 @@ namespace math
 // ---- Implementation ----
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>::Vector(TValueType val)
 		: m_x(val), m_y(val) {}
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>::Vector(TValueType x, TValueType y)
 		: m_x(x), m_y(y) {}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>::Vector(const Vector<2, TValueType>& other)
 		: m_x(other.m_x), m_y(other.m_y) {}
 
@@ -264,7 +290,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::Cross(const Vector<2, TValueType>& other) const
 	{
 		// Only compute result for result's  z component as
@@ -273,14 +299,14 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::DistanceFrom(const Vector<2, TValueType>& other) const
 	{
 		return SquareRoot(DistanceSquaredFrom(other));
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::DistanceSquaredFrom(const Vector<2, TValueType>& other) const
 	{
 		// Find distance vector and get magnitude
@@ -288,7 +314,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::Dot(const Vector<2, TValueType>& other) const
 	{
 		// Multiply components
@@ -296,7 +322,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<2, TValueType>::IsLongerThan(const Vector<2, TValueType>& other) const
 	{
 		// Compare squared magnitudes to avoid two sqrt calls
@@ -304,7 +330,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<2, TValueType>::IsShorterThan(const Vector<2, TValueType>& other) const
 	{
 		// Compare squared magnitudes to avoid two sqrt calls
@@ -312,7 +338,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<2, TValueType>::IsUnitVector() const
 	{
 		// 1 squared == 1 so avoiding sqrt call is possible
@@ -320,13 +346,13 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::Magnitude() const
 	{
 		return SquareRoot(MagnitudeSquared());
 	}
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::MagnitudeSquared() const
 	{
 		// Square components
@@ -334,7 +360,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<2, TValueType>::Normalize()
 	{
 		TValueType		invMagnitude = Magnitude();
@@ -353,7 +379,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::Normalized(void) const
 	{
 		Vector<2, TValueType>		result = *this;
@@ -365,7 +391,36 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType>
+	template <fast::EPrecision TPrecision> inline
+	void Vector<2, TValueType>::NormalizeFast(void)
+	{
+		// Integral vectors keep the exact path
+		if constexpr (!std::is_floating_point_v<TValueType>)
+			Normalize();
+
+		else
+		{
+			TValueType		invMagnitude = fast::InverseSquareRoot<TPrecision>(MagnitudeSquared());
+
+			m_x *= invMagnitude;
+			m_y *= invMagnitude;
+		}
+	}
+
+
+	template <CScalarType TValueType>
+	template <fast::EPrecision TPrecision> inline
+	Vector<2, TValueType> Vector<2, TValueType>::NormalizedFast(void) const
+	{
+		Vector<2, TValueType>		result = *this;
+
+		result.template NormalizeFast<TPrecision>();
+		return result;
+	}
+
+
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::Normal(void) const
 	{
 		if constexpr (std::is_unsigned<TValueType>::value)
@@ -378,7 +433,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<2, TValueType>::ProjectOnto(const Vector<2, TValueType>& other)
 	{
 		// Apply projection formula
@@ -392,7 +447,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<2, TValueType>::ReflectOnto(const Vector<2, TValueType>& axis)
 	{
 		// Only reflect onto unit vector
@@ -403,7 +458,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<2, TValueType>::ReflectOntoUnit(const Vector<2, TValueType>& axis)
 	{
 		// Assume normal is already unit vector and skip normalize call
@@ -412,11 +467,12 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<2, TValueType>::Rotate(Radian<TValueType> angle)
 	{
-		TValueType		cosAngle = Cos(angle),
-					sinAngle = Sin(angle);
+		TValueType		cosAngle, sinAngle;
+
+		SinCos(angle, sinAngle, cosAngle);
 
 		// Copy x as base x value is needed for
 		// both x and y results
@@ -429,7 +485,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<2, TValueType>::Scale(const Vector<2, TValueType>& other)
 	{
 		*this *= other;
@@ -462,7 +518,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<2, TValueType>::Translate(const Vector<2, TValueType>& other)
 	{
 		*this += other;
@@ -470,7 +526,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<2, TValueType>::X()
 	{
 		return m_x;
@@ -478,7 +534,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<2, TValueType>::Y()
 	{
 		return m_y;
@@ -486,21 +542,21 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::GetX() const
 	{
 		return m_x;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::GetY() const
 	{
 		return m_y;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>& Vector<2, TValueType>::operator=(const Vector<2, TValueType>& rhs)
 	{
 		// Copy assign
@@ -511,7 +567,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<2, TValueType>::operator[](int index)
 	{
 		switch (index)
@@ -528,7 +584,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<2, TValueType>::operator[](int index) const
 	{
 		switch (index)
@@ -545,7 +601,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<2, TValueType>::operator==(const Vector<2, TValueType>& rhs) const
 	{
 		// Compare both components
@@ -558,28 +614,28 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<2, TValueType>::operator!=(const Vector<2, TValueType>& rhs) const
 	{
 		return !(*this == rhs);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Dot(const Vector<2, TValueType>& first, const Vector<2, TValueType>& second)
 	{
 		return first.Dot(second);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Cross(const Vector<2, TValueType>& first, const Vector<2, TValueType>& second)
 	{
 		return first.Cross(second);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Reflect(const Vector<2, TValueType>& target, const Vector<2, TValueType>& ontoNormal)
 	{
 		Vector<2, TValueType>		result = target;
@@ -591,7 +647,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> ReflectUnit(const Vector<2, TValueType>& target, const Vector<2, TValueType>& ontoNormal)
 	{
 		Vector<2, TValueType>		result = target;
@@ -603,7 +659,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Project(const Vector<2, TValueType>& target, const Vector<2, TValueType>& ontoVector)
 	{
 		Vector<2, TValueType>		result = target;
@@ -616,7 +672,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Normalize(const Vector<2, TValueType>& target)
 	{
 		Vector<2, TValueType>		result = target;
@@ -628,14 +684,14 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Distance(const Vector<2, TValueType>& start, const Vector<2, TValueType>& end)
 	{
 		return start.DistanceFrom(end);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType DistanceSquared(const Vector<2, TValueType>& start, const Vector<2, TValueType>& end)
 	{
 		return start.DistanceSquaredFrom(end);
@@ -643,7 +699,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Rotate(const Vector<2, TValueType>& target, Radian<TValueType> angle)
 	{
 		Vector<2, TValueType>		result = target;
@@ -658,28 +714,28 @@ namespace math
 	// Component-wise operators
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::operator+(const Vector<2, TValueType>& rhs) const
 	{
 		return Vector<2, TValueType>(m_x + rhs.m_x, m_y + rhs.m_y);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::operator-(const Vector<2, TValueType>& rhs) const
 	{
 		return Vector<2, TValueType>(m_x - rhs.m_x, m_y - rhs.m_y);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::operator*(const Vector<2, TValueType>& rhs) const
 	{
 		return Vector<2, TValueType>(m_x * rhs.m_x, m_y * rhs.m_y);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::operator/(const Vector<2, TValueType>& rhs) const
 	{
 		return Vector<2, TValueType>(m_x / rhs.m_x, m_y / rhs.m_y);
@@ -687,14 +743,14 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::operator*(TValueType rhs) const
 	{
 		return Vector<2, TValueType>(m_x * rhs, m_y * rhs);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::operator/(TValueType rhs) const
 	{
 		rhs = static_cast<TValueType>(1) / rhs;
@@ -704,7 +760,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::operator-(void) const
 	{
 		if constexpr (std::is_unsigned<TValueType>::value)
@@ -716,7 +772,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>& Vector<2, TValueType>::operator+=(const Vector<2, TValueType>& rhs)
 	{
 		m_x += rhs.m_x;
@@ -726,7 +782,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>& Vector<2, TValueType>::operator-=(const Vector<2, TValueType>& rhs)
 	{
 		m_x -= rhs.m_x;
@@ -737,7 +793,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>& Vector<2, TValueType>::operator*=(const Vector<2, TValueType>& rhs)
 	{
 		m_x *= rhs.m_x;
@@ -748,7 +804,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>& Vector<2, TValueType>::operator/=(const Vector<2, TValueType>& rhs)
 	{
 		m_x /= rhs.m_x;
@@ -758,7 +814,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>& Vector<2, TValueType>::operator*=(TValueType rhs)
 	{
 		m_x *= rhs;
@@ -769,7 +825,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType>& Vector<2, TValueType>::operator/=(TValueType rhs)
 	{
 		rhs = static_cast<TValueType>(1) / rhs;
@@ -786,42 +842,42 @@ namespace math
 	// Constants
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::Zero(void)
 	{
 		return Vector<2, TValueType>();
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::One(void)
 	{
 		return Vector<2, TValueType>(static_cast<TValueType>(1), static_cast<TValueType>(1));
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::Up(void)
 	{
 		return Vector<2, TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(1));
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::Down(void)
 	{
 		return Vector<2, TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(-1));
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::Left(void)
 	{
 		return Vector<2, TValueType>(static_cast<TValueType>(-1), static_cast<TValueType>(0));
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<2, TValueType> Vector<2, TValueType>::Right(void)
 	{
 		return Vector<2, TValueType>(static_cast<TValueType>(1), static_cast<TValueType>(0));
@@ -851,9 +907,43 @@ namespace math
 		return is;
 	}
 
+
+	template <fast::EPrecision TPrecision, CFloatingType TValueType> inline
+	void fast::Normalize(std::type_identity_t<std::span<Vector<2, TValueType>>> vectors)
+	{
+		for (Vector<2, TValueType>& vector : vectors)
+			vector.template NormalizeFast<TPrecision>();
+	}
+
+
+	template <fast::EPrecision TPrecision> inline
+	void fast::Normalize(std::span<Vector<2, float>> vectors)
+	{
+		Normalize<TPrecision, float>(vectors);
+	}
+
+
+	template <fast::EPrecision TPrecision> inline
+	void fast::Normalize(std::span<Vector<2, double>> vectors)
+	{
+		Normalize<TPrecision, double>(vectors);
+	}
+
 }
 
 namespace LibMath = math;
 namespace lm = LibMath;
 
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+	extern template class Vector<2, float>;
+	extern template class Vector<2, double>;
+	extern template class Vector<2, int32_t>;
+}
+
+#endif
+
 #endif
\ No newline at end of file
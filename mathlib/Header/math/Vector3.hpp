@@ -1,9 +1,11 @@
 #ifndef __VECTOR3_H__
 #define __VECTOR3_H__
 
+#include <cstdint>
 #include <string>
 #include <cmath>
 #include <sstream>
+#include <span>
 
 #include "MathGeneric.hpp"
 #include "VectorGeneric.hpp"
@@ -11,6 +13,7 @@
 #include "Trigonometry.hpp"
 #include "Arithmetic.hpp"
 #include "Angle.hpp"
+#include "FastMath.hpp"
 #include "Vector2.hpp"
 //#include "VectorQuatOperations.hpp"
 
@@ -25,16 +28,16 @@ namespace math
 	public:
 
 		// Constructors / destructor
-		inline				Vector(void) = default;
+		constexpr				Vector(void) = default;
 
-		inline
+		constexpr
 		explicit			Vector(TValueType val);
 
 
-		inline				Vector(TValueType x, TValueType y, TValueType z);
-		inline				Vector(const Vector& other);
+		constexpr				Vector(TValueType x, TValueType y, TValueType z);
+		constexpr				Vector(const Vector& other);
 
-		inline				~Vector(void) = default;
+		constexpr				~Vector(void) = default;
 
 		// Get angle from this vector to another
 		inline
@@ -48,52 +51,61 @@ namespace math
 
 		// Compute cross product with another
 		// this x other
-		inline Vector		Cross(const Vector& other)					const;
+		constexpr Vector		Cross(const Vector& other)					const;
 
 		// Get distance between 2 points
-		inline TValueType	DistanceFrom(const Vector& other)				const;
+		constexpr TValueType	DistanceFrom(const Vector& other)				const;
 
 		// Get distance squared between two points
-		inline TValueType	DistanceSquaredFrom(const Vector& other)		const;
+		constexpr TValueType	DistanceSquaredFrom(const Vector& other)		const;
 
 		// Get distance between 2 points disregarding the z axis
-		inline TValueType	Distance2DFrom(Vector const&)					const;
+		constexpr TValueType	Distance2DFrom(Vector const&)					const;
 
 		// Get distance squared between two points disregarding the z axis
-		inline TValueType	Distance2DSquaredFrom(Vector const&)			const;
+		constexpr TValueType	Distance2DSquaredFrom(Vector const&)			const;
 
 		// Compute dot product of two vectors
-		inline TValueType	Dot(const Vector& other)						const;
+		constexpr TValueType	Dot(const Vector& other)						const;
 
 		// Is this vector's magnitude longer than another ?
-		inline bool			IsLongerThan(const Vector& other)				const;
+		constexpr bool			IsLongerThan(const Vector& other)				const;
 
 		// Is this vector's magnitude shorter than another ?
-		inline bool			IsShorterThan(const Vector& other)			const;
+		constexpr bool			IsShorterThan(const Vector& other)			const;
 
 		// Is this vector's magnitude equal to 1 ?
-		inline bool			IsUnitVector(void)								const;
+		constexpr bool			IsUnitVector(void)								const;
 
-		inline TValueType	Magnitude(void)									const;
-		inline TValueType	MagnitudeSquared(void)							const;
+		constexpr TValueType	Magnitude(void)									const;
+		constexpr TValueType	MagnitudeSquared(void)							const;
 
 		// Adjust vector to turn into unit vector
-		inline void			Normalize(void);
+		constexpr void			Normalize(void);
 
 		// Get copy of this vector as a unit vector
-		inline Vector		Normalized(void)								const;
+		constexpr Vector		Normalized(void)								const;
+
+		// Approximate Normalize using a reciprocal square root estimate,
+		// without zero magnitude check. See FastMath.hpp for precision tiers
+		template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+		inline void			NormalizeFast(void);
+
+		// Get copy of this vector as an approximate unit vector
+		template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+		inline Vector		NormalizedFast(void)								const;
 
 		// Project this vector onto another
-		inline void			ProjectOnto(const Vector& other);
+		constexpr void			ProjectOnto(const Vector& other);
 
 		// Reflect this vector onto another
-		inline void			ReflectOnto(const Vector& axis);
+		constexpr void			ReflectOnto(const Vector& axis);
 
 		// Reflect this vector onto a UNIT vector
-		inline void			ReflectOntoUnit(const Vector& axis);
+		constexpr void			ReflectOntoUnit(const Vector& axis);
 
 		// Rotate this vector around the all 3 axes
-		inline void			Rotate
+		constexpr void			Rotate
 		(
 			Radian<TValueType> angleX,
 			Radian<TValueType> angleY,
@@ -101,11 +113,11 @@ namespace math
 		);
 
 		// Rotate this vector around an arbitrary axis
-		inline void			Rotate
+		constexpr void			Rotate
 		(Radian<TValueType> angle, const Vector& axis);
 
 		// Multiply this vector's components by another's
-		inline void			Scale(const Vector& other);
+		constexpr void			Scale(const Vector& other);
 
 		// Get components as string
 		inline std::string	String(void)									const;
@@ -114,71 +126,71 @@ namespace math
 		inline std::string	StringLong(void)								const;
 
 		// Add another vector's components to this one's
-		inline void			Translate(const Vector& other);
+		constexpr void			Translate(const Vector& other);
 
 		// Accessors
 
-		inline TValueType&	X(void);
-		inline TValueType&	Y(void);
-		inline TValueType&	Z(void);
+		constexpr TValueType&	X(void);
+		constexpr TValueType&	Y(void);
+		constexpr TValueType&	Z(void);
 
-		inline TValueType	GetX(void)										const;
-		inline TValueType	GetY(void)										const;
-		inline TValueType	GetZ(void)										const;
+		constexpr TValueType	GetX(void)										const;
+		constexpr TValueType	GetY(void)										const;
+		constexpr TValueType	GetZ(void)										const;
 
 
-		inline Vector&		operator=(const Vector& rhs);
+		constexpr Vector&		operator=(const Vector& rhs);
 
-		inline TValueType&			operator[](int index);
-		inline TValueType			operator[](int index)					const;
+		constexpr TValueType&			operator[](int index);
+		constexpr TValueType			operator[](int index)					const;
 
 		// Boolean test operators
 
-		inline bool			operator==(const Vector& rhs)					const;
-		inline bool			operator!=(const Vector& rhs)					const;
+		constexpr bool			operator==(const Vector& rhs)					const;
+		constexpr bool			operator!=(const Vector& rhs)					const;
 
 		// Component-wise operations
 
-		inline Vector			operator+(const Vector& rhs)				const;
-		inline Vector			operator-(const Vector& rhs)				const;
-		inline Vector			operator*(const Vector& rhs)				const;
-		inline Vector			operator/(const Vector& rhs)				const;
+		constexpr Vector			operator+(const Vector& rhs)				const;
+		constexpr Vector			operator-(const Vector& rhs)				const;
+		constexpr Vector			operator*(const Vector& rhs)				const;
+		constexpr Vector			operator/(const Vector& rhs)				const;
 
 		// Multiply all components by a single scalar
-		inline Vector			operator*(TValueType rhs)					const;
+		constexpr Vector			operator*(TValueType rhs)					const;
 
 		// Divide all components by a single scalar
-		inline Vector			operator/(TValueType rhs)					const;
+		constexpr Vector			operator/(TValueType rhs)					const;
 
 		// Flip sign of both components
-		inline Vector			operator-(void)								const;
+		constexpr Vector			operator-(void)								const;
 
 
 		// Component-wise operations
 
-		inline Vector&		operator+=(const Vector& rhs);
-		inline Vector&		operator-=(const Vector& rhs);
-		inline Vector&		operator*=(const Vector& rhs);
-		inline Vector&		operator/=(const Vector& rhs);
+		constexpr Vector&		operator+=(const Vector& rhs);
+		constexpr Vector&		operator-=(const Vector& rhs);
+		constexpr Vector&		operator*=(const Vector& rhs);
+		constexpr Vector&		operator/=(const Vector& rhs);
 
 		// Multiply all components by a single scalar
-		inline Vector&		operator*=(TValueType rhs);
+		constexpr Vector&		operator*=(TValueType rhs);
 
 		// Divide all components by a single scalar
-		inline Vector&		operator/=(TValueType rhs);
+		constexpr Vector&		operator/=(TValueType rhs);
 
 
 		// Constants
 
-		inline static Vector	Zero(void);
-		inline static Vector	One(void);
-		inline static Vector	Up(void);
-		inline static Vector	Down(void);
-		inline static Vector	Left(void);
-		inline static Vector	Right(void);
-		inline static Vector	Back(void);
-		inline static Vector	Front(void);
-		inline static Vector	Lerp(const Vector& start, const Vector& end, TValueType time);
+		constexpr static Vector	Zero(void);
+		constexpr static Vector	One(void);
+		constexpr static Vector	Up(void);
+		constexpr static Vector	Down(void);
+		constexpr static Vector	Left(void);
+		constexpr static Vector	Right(void);
+		constexpr static Vector	Back(void);
+		constexpr static Vector	Front(void);
+		constexpr static Vector	Lerp(const Vector& start, const Vector& end, TValueType time);
 
 
 	private:
@@ -190,42 +202,56 @@ namespace math
 
 	// Non-member functions (similar to member functions but provided for readability)
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType				Dot
 	(const Vector<3, TValueType>& first, const Vector<3, TValueType>& second);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType>		Cross
 	(const Vector<3, TValueType>& first, const Vector<3, TValueType>& second);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType>				Reflect
 	(const Vector<3, TValueType>& target, const Vector<3, TValueType>& ontoNormal);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType>				ReflectUnit
 	(const Vector<3, TValueType>& target, const Vector<3, TValueType>& ontoNormal);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType>				Project
 	(const Vector<3, TValueType>& target, const Vector<3, TValueType>& ontoVector);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType>				Normalize(const Vector<3, TValueType>& target);
 
+	namespace fast
+	{
+		// Normalize every vector of an array in place, see NormalizeFast.
+		// The float and double overloads take spans or containers directly
+		template <EPrecision TPrecision = EPrecision::MEDIUM, CFloatingType TValueType> inline
+		void							Normalize(std::type_identity_t<std::span<Vector<3, TValueType>>> vectors);
+
+		template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+		void							Normalize(std::span<Vector<3, float>> vectors);
 
-	template <CScalarType TValueType> inline
+		template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+		void							Normalize(std::span<Vector<3, double>> vectors);
+	}
+
+
+	template <CScalarType TValueType> constexpr
 	TValueType				Distance
 	(const Vector<3, TValueType>& start, const Vector<3, TValueType>& end);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType				DistanceSquared
 	(const Vector<3, TValueType>& start, const Vector<3, TValueType>& end);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType>				Rotate
 	(
 		const Vector<3, TValueType>& target,
@@ -235,7 +261,7 @@ namespace math
 	);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType>				Rotate
 	(
 		const Vector<3, TValueType>& target,
@@ -255,17 +281,17 @@ namespace math
 
 	// ---- Implementation ---
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>::Vector(TValueType val)
 		: m_x(val), m_y(val), m_z(val) {}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>::Vector(TValueType x, TValueType y, TValueType z)
 		: m_x(x), m_y(y), m_z(z) {}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>::Vector(const Vector<3, TValueType>& other)
 		: m_x(other.m_x), m_y(other.m_y), m_z(other.m_z) {}
 
@@ -307,7 +333,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::Cross
 		(const Vector<3, TValueType>& other) const
 	{
@@ -322,7 +348,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::DistanceFrom
 		(const Vector<3, TValueType>& other) const
 	{
@@ -330,7 +356,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::DistanceSquaredFrom
 		(const Vector<3, TValueType>& other) const
 	{
@@ -339,7 +365,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::Distance2DFrom
 		(const Vector<3, TValueType>& other) const
 	{
@@ -347,7 +373,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::Distance2DSquaredFrom(const Vector<3, TValueType>& other) const
 	{
 		// Ignore z axis
@@ -362,7 +388,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::Dot
 		(const Vector<3, TValueType>& other) const
 	{
@@ -372,7 +398,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		bool Vector<3, TValueType>::IsLongerThan
 		(const Vector<3, TValueType>& other) const
 	{
@@ -381,7 +407,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		bool Vector<3, TValueType>::IsShorterThan
 		(const Vector<3, TValueType>& other) const
 	{
@@ -390,7 +416,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		bool Vector<3, TValueType>::IsUnitVector() const
 	{
 		// 1 squared == 1 so avoiding sqrt call is possible
@@ -398,7 +424,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::Magnitude() const
 	{
 		return SquareRoot(MagnitudeSquared());
@@ -406,7 +432,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::MagnitudeSquared() const
 	{
 		// Square components
@@ -415,7 +441,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::Normalize()
 	{
 		TValueType		invMagnitude = Magnitude();
@@ -437,7 +463,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::Normalized(void) const
 	{
 		Vector<3, TValueType>		result = *this;
@@ -449,8 +475,38 @@ namespace math
 	}
 
 
+	template <CScalarType TValueType>
+	template <fast::EPrecision TPrecision> inline
+	void Vector<3, TValueType>::NormalizeFast(void)
+	{
+		// Integral vectors keep the exact path
+		if constexpr (!std::is_floating_point_v<TValueType>)
+			Normalize();
 
-	template <CScalarType TValueType> inline
+		else
+		{
+			TValueType		invMagnitude = fast::InverseSquareRoot<TPrecision>(MagnitudeSquared());
+
+			m_x *= invMagnitude;
+			m_y *= invMagnitude;
+			m_z *= invMagnitude;
+		}
+	}
+
+
+	template <CScalarType TValueType>
+	template <fast::EPrecision TPrecision> inline
+	Vector<3, TValueType> Vector<3, TValueType>::NormalizedFast(void) const
+	{
+		Vector<3, TValueType>		result = *this;
+
+		result.template NormalizeFast<TPrecision>();
+		return result;
+	}
+
+
+
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::ProjectOnto(const Vector<3, TValueType>& other)
 	{
 		// Apply projection formula
@@ -465,7 +521,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::ReflectOnto(const Vector<3, TValueType>& axis)
 	{
 		// Only reflect onto unit vector
@@ -476,7 +532,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::ReflectOntoUnit(const Vector<3, TValueType>& axis)
 	{
 		// Assume normal is already unit vector and skip normalize call
@@ -484,7 +540,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::Rotate
 		(Radian<TValueType> angleX, Radian<TValueType> angleY, Radian<TValueType> angleZ)
 	{
@@ -497,9 +553,11 @@ namespace math
 		{
 			Vector<3, TValueType>		copy = *this;
 
-			TValueType				cosYaw = Cos(angleZ), sinYaw = Sin(angleZ);
-			TValueType				cosPitch = Cos(angleX), sinPitch = Sin(angleX);
-			TValueType				cosRoll = Cos(angleY), sinRoll = Sin(angleY);
+			TValueType				cosYaw, sinYaw, cosPitch, sinPitch, cosRoll, sinRoll;
+
+			SinCos(angleZ, sinYaw, cosYaw);
+			SinCos(angleX, sinPitch, cosPitch);
+			SinCos(angleY, sinRoll, cosRoll);
 			TValueType				rowResult;
 
 
@@ -548,17 +606,16 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::Rotate
 		(Radian<TValueType> angle, const Vector<3, TValueType>& axis)
 	{
 		const Vector<3, TValueType>		norm = math::Normalize(axis);
 		const TValueType				xCpy = m_x, yCpy = m_y, zCpy = m_z;
 
-		// lib math trig functions are not precise enough,
-		// use the standard ones instead :(
-		const TValueType			cosAngle = Cos(angle);
-		const TValueType			sinAngle = Sin(angle);
+		TValueType					cosAngle, sinAngle;
+
+		SinCos(angle, sinAngle, cosAngle);
 
 		const TValueType			oneMinCos = static_cast<TValueType>(1) - cosAngle;
 		const Vector<3, TValueType>		oneMinAxis = norm * oneMinCos;
@@ -600,7 +657,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::Scale(const Vector<3, TValueType>& other)
 	{
 		*this *= other;
@@ -634,7 +691,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		void Vector<3, TValueType>::Translate(const Vector<3, TValueType>& other)
 	{
 		*this += other;
@@ -642,49 +699,49 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType& Vector<3, TValueType>::X()
 	{
 		return m_x;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType& Vector<3, TValueType>::Y()
 	{
 		return m_y;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType& Vector<3, TValueType>::Z()
 	{
 		return m_z;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::GetX() const
 	{
 		return m_x;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::GetY() const
 	{
 		return m_y;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::GetZ() const
 	{
 		return m_z;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>& Vector<3, TValueType>::operator=
 		(const Vector<3, TValueType>& rhs)
 	{
@@ -697,7 +754,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType& Vector<3, TValueType>::operator[](int index)
 	{
 		switch (index)
@@ -714,7 +771,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Vector<3, TValueType>::operator[](int index) const
 	{
 		switch (index)
@@ -734,7 +791,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		bool Vector<3, TValueType>::operator==(const Vector<3, TValueType>& rhs) const
 	{
 		// Compare all components
@@ -748,7 +805,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		bool Vector<3, TValueType>::operator!=
 		(const Vector<3, TValueType>& rhs) const
 	{
@@ -756,7 +813,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Dot
 		(const Vector<3, TValueType>& first, const Vector<3, TValueType>& second)
 	{
@@ -764,7 +821,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Cross
 		(const Vector<3, TValueType>& first, const Vector<3, TValueType>& second)
 	{
@@ -772,7 +829,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Reflect
 		(const Vector<3, TValueType>& target, const Vector<3, TValueType>& ontoNormal)
 	{
@@ -785,7 +842,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> ReflectUnit
 		(const Vector<3, TValueType>& target, const Vector<3, TValueType>& ontoNormal)
 	{
@@ -798,7 +855,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Project
 		(const Vector<3, TValueType>& target, const Vector<3, TValueType>& ontoVector)
 	{
@@ -812,7 +869,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Normalize(const Vector<3, TValueType>& target)
 	{
 		Vector<3, TValueType>		result = target;
@@ -824,7 +881,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType Distance
 		(const Vector<3, TValueType>& start, const Vector<3, TValueType>& end)
 	{
@@ -832,7 +889,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		TValueType DistanceSquared
 		(const Vector<3, TValueType>& start, const Vector<3, TValueType>& end)
 	{
@@ -840,7 +897,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Rotate
 		(
 			const Vector<3, TValueType>& target,
@@ -856,7 +913,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Rotate
 		(
 			const Vector<3, TValueType>& target,
@@ -875,7 +932,7 @@ namespace math
 	// Component-wise operators
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::operator+
 		(const Vector<3, TValueType>& rhs) const
 	{
@@ -883,7 +940,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::operator-
 		(const Vector<3, TValueType>& rhs) const
 	{
@@ -891,7 +948,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::operator*
 		(const Vector<3, TValueType>& rhs) const
 	{
@@ -899,7 +956,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::operator/
 		(const Vector<3, TValueType>& rhs) const
 	{
@@ -908,14 +965,14 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::operator*(TValueType rhs) const
 	{
 		return Vector<3, TValueType>(m_x * rhs, m_y * rhs, m_z * rhs);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::operator/(TValueType rhs) const
 	{
 		rhs = static_cast<TValueType>(1) / rhs;
@@ -924,7 +981,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType> Vector<3, TValueType>::operator-(void) const
 	{
 		if constexpr (std::is_unsigned<TValueType>::value)
@@ -935,7 +992,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>& Vector<3, TValueType>::operator+=
 		(const Vector<3, TValueType>& rhs)
 	{
@@ -947,7 +1004,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>& Vector<3, TValueType>::operator-=
 		(const Vector<3, TValueType>& rhs)
 	{
@@ -959,7 +1016,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>& Vector<3, TValueType>::operator*=
 		(const Vector<3, TValueType>& rhs)
 	{
@@ -971,7 +1028,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>& Vector<3, TValueType>::operator/=
 		(const Vector<3, TValueType>& rhs)
 	{
@@ -983,7 +1040,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>& Vector<3, TValueType>::operator*=(TValueType rhs)
 	{
 		m_x *= rhs;
@@ -994,7 +1051,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 		Vector<3, TValueType>& Vector<3, TValueType>::operator/=(TValueType rhs)
 	{
 		rhs = static_cast<TValueType>(1) / rhs;
@@ -1013,7 +1070,7 @@ namespace math
 	// Constants
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Zero(void)
 	{
 		return Vector<3, TValueType>();
@@ -1021,7 +1078,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::One(void)
 	{
 		return Vector<3, TValueType>(static_cast<TValueType>(1),
@@ -1030,7 +1087,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Up(void)
 	{
 		return Vector<3, TValueType>(static_cast<TValueType>(0),
@@ -1039,7 +1096,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Down(void)
 	{
 		return Vector<3, TValueType>(static_cast<TValueType>(0),
@@ -1048,7 +1105,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Left(void)
 	{
 		return Vector<3, TValueType>(static_cast<TValueType>(-1),
@@ -1057,7 +1114,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Right(void)
 	{
 		return Vector<3, TValueType>(static_cast<TValueType>(1),
@@ -1066,7 +1123,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Back(void)
 	{
 		return Vector<3, TValueType>(static_cast<TValueType>(0),
@@ -1075,7 +1132,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Front(void)
 	{
 		return Vector<3, TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(0), static_cast<TValueType>(1));
@@ -1113,15 +1170,49 @@ namespace math
 
 
 	
-	template<CScalarType TValueType>
+	template<CScalarType TValueType> constexpr
 	Vector<3, TValueType> Vector<3, TValueType>::Lerp(const Vector& start, const Vector& end, TValueType time)
 	{
 		return (end - start) * time + start;
 	}
 
+
+	template <fast::EPrecision TPrecision, CFloatingType TValueType> inline
+	void fast::Normalize(std::type_identity_t<std::span<Vector<3, TValueType>>> vectors)
+	{
+		for (Vector<3, TValueType>& vector : vectors)
+			vector.template NormalizeFast<TPrecision>();
+	}
+
+
+	template <fast::EPrecision TPrecision> inline
+	void fast::Normalize(std::span<Vector<3, float>> vectors)
+	{
+		Normalize<TPrecision, float>(vectors);
+	}
+
+
+	template <fast::EPrecision TPrecision> inline
+	void fast::Normalize(std::span<Vector<3, double>> vectors)
+	{
+		Normalize<TPrecision, double>(vectors);
+	}
+
 }
 
 namespace LibMath = math;
 namespace lm = LibMath;
 
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+	extern template class Vector<3, float>;
+	extern template class Vector<3, double>;
+	extern template class Vector<3, int32_t>;
+}
+
+#endif
+
 #endif
\ No newline at end of file
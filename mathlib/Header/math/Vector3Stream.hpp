@@ -0,0 +1,658 @@
+#ifndef __VECTOR3_STREAM_H__
+#define __VECTOR3_STREAM_H__
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "MathGeneric.hpp"
+#include "Arithmetic.hpp"
+#include "AlignedAllocator.hpp"
+#include "Simd.hpp"
+
+#include "Vector3.hpp"
+#include "Matrix4.hpp"
+
+namespace math
+{
+    // Structure-of-arrays container of 3D vectors: all x components
+    // are stored contiguously, then all y, then all z, so operations
+    // on many vectors run on full SIMD lanes
+    template <CScalarType TValueType>
+    class Vector3Stream
+    {
+    public:
+
+        // Every lane starts on a cache line
+        static constexpr std::size_t    Alignment = 64;
+
+        using TLaneType = std::vector<TValueType, AlignedAllocator<TValueType, Alignment>>;
+
+
+        // Constructors / destructor
+
+                    Vector3Stream(void) = default;
+        explicit    Vector3Stream(std::size_t size);
+        explicit    Vector3Stream(std::span<const Vector3<TValueType>> vectors);
+
+                    Vector3Stream(const Vector3Stream&) = default;
+                    Vector3Stream(Vector3Stream&&) noexcept = default;
+
+                    ~Vector3Stream(void) = default;
+
+        // Number of vectors
+        std::size_t             Size(void)                                  const;
+        bool                    Empty(void)                                 const;
+
+        // New vectors are zero-initialized
+        void                    Resize(std::size_t size);
+        void                    Reserve(std::size_t capacity);
+        void                    Clear(void);
+
+        void                    PushBack(const Vector3<TValueType>& vector);
+
+        // Gather / scatter a single vector
+        Vector3<TValueType>     Get(std::size_t index)                      const;
+        void                    Set(std::size_t index, const Vector3<TValueType>& vector);
+
+        // Copy all vectors back to an array of Vector3 (size must match)
+        void                    Store(std::span<Vector3<TValueType>> vectors) const;
+
+        // Lane accessors
+        TValueType*             X(void);
+        TValueType*             Y(void);
+        TValueType*             Z(void);
+
+        const TValueType*       X(void)                                     const;
+        const TValueType*       Y(void)                                     const;
+        const TValueType*       Z(void)                                     const;
+
+
+        // In-place batch operations
+
+        // Add the same offset to all vectors
+        void                    Translate(const Vector3<TValueType>& offset);
+
+        // Multiply all vectors by a scalar factor
+        void                    Scale(TValueType factor);
+
+        // Turn all vectors into unit vectors.
+        // Zero vectors are left untouched
+        void                    Normalize(void);
+
+        // Transform all vectors as points (w = 1) by a column-major matrix
+        void                    TransformPoints(const Matrix4<TValueType>& matrix);
+
+        Vector3Stream&          operator=(const Vector3Stream&) = default;
+        Vector3Stream&          operator=(Vector3Stream&&) noexcept = default;
+
+        // Component-wise operations (sizes must match)
+        Vector3Stream&          operator+=(const Vector3Stream& rhs);
+        Vector3Stream&          operator-=(const Vector3Stream& rhs);
+
+    private:
+
+        TLaneType               m_x;
+        TLaneType               m_y;
+        TLaneType               m_z;
+    };
+
+
+    // Non-member batch kernels. Outputs are resized to the inputs' size
+    // and may be the same object as an input
+
+    // out[i] = first[i] + second[i]
+    template <CScalarType TValueType> inline
+    void        Add
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        Vector3Stream<TValueType>& out
+    );
+
+    // out[i] = first[i] - second[i]
+    template <CScalarType TValueType> inline
+    void        Subtract
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        Vector3Stream<TValueType>& out
+    );
+
+    // out[i] = vectors[i] * factor
+    template <CScalarType TValueType> inline
+    void        Scale
+    (
+        const Vector3Stream<TValueType>& vectors, TValueType factor,
+        Vector3Stream<TValueType>& out
+    );
+
+    // out[i] = first[i] . second[i] (out must hold Size() values)
+    template <CScalarType TValueType> inline
+    void        Dot
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        std::type_identity_t<std::span<TValueType>> out
+    );
+
+    // out[i] = first[i] x second[i]
+    template <CScalarType TValueType> inline
+    void        Cross
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        Vector3Stream<TValueType>& out
+    );
+
+    // out[i] = vectors[i] / |vectors[i]|, zero vectors stay zero
+    template <CScalarType TValueType> inline
+    void        Normalize(const Vector3Stream<TValueType>& vectors, Vector3Stream<TValueType>& out);
+
+    // out[i] = |end[i] - start[i]| (out must hold Size() values)
+    template <CScalarType TValueType> inline
+    void        Distance
+    (
+        const Vector3Stream<TValueType>& start, const Vector3Stream<TValueType>& end,
+        std::type_identity_t<std::span<TValueType>> out
+    );
+
+    // out[i] = |end[i] - start[i]|^2 (out must hold Size() values)
+    template <CScalarType TValueType> inline
+    void        DistanceSquared
+    (
+        const Vector3Stream<TValueType>& start, const Vector3Stream<TValueType>& end,
+        std::type_identity_t<std::span<TValueType>> out
+    );
+
+    // out[i] = matrix * (points[i], 1), column-major
+    template <CScalarType TValueType> inline
+    void        TransformPoints
+    (
+        const Matrix4<TValueType>& matrix, const Vector3Stream<TValueType>& points,
+        Vector3Stream<TValueType>& out
+    );
+
+    using Vector3fStream = Vector3Stream<float>;
+    using Vector3dStream = Vector3Stream<double>;
+
+
+
+
+// ---- Implementation ----
+
+    template <CScalarType TValueType> inline
+    Vector3Stream<TValueType>::Vector3Stream(std::size_t size)
+        : m_x(size), m_y(size), m_z(size)
+    {
+    }
+
+
+    template <CScalarType TValueType> inline
+    Vector3Stream<TValueType>::Vector3Stream(std::span<const Vector3<TValueType>> vectors)
+        : m_x(vectors.size()), m_y(vectors.size()), m_z(vectors.size())
+    {
+        // Split AoS input into lanes
+        for (std::size_t index = 0; index < vectors.size(); ++index)
+        {
+            m_x[index] = vectors[index].GetX();
+            m_y[index] = vectors[index].GetY();
+            m_z[index] = vectors[index].GetZ();
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    std::size_t Vector3Stream<TValueType>::Size(void) const
+    {
+        return m_x.size();
+    }
+
+
+    template <CScalarType TValueType> inline
+    bool Vector3Stream<TValueType>::Empty(void) const
+    {
+        return m_x.empty();
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Resize(std::size_t size)
+    {
+        m_x.resize(size);
+        m_y.resize(size);
+        m_z.resize(size);
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Reserve(std::size_t capacity)
+    {
+        m_x.reserve(capacity);
+        m_y.reserve(capacity);
+        m_z.reserve(capacity);
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Clear(void)
+    {
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::PushBack(const Vector3<TValueType>& vector)
+    {
+        m_x.push_back(vector.GetX());
+        m_y.push_back(vector.GetY());
+        m_z.push_back(vector.GetZ());
+    }
+
+
+    template <CScalarType TValueType> inline
+    Vector3<TValueType> Vector3Stream<TValueType>::Get(std::size_t index) const
+    {
+        return Vector3<TValueType>(m_x[index], m_y[index], m_z[index]);
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Set(std::size_t index, const Vector3<TValueType>& vector)
+    {
+        m_x[index] = vector.GetX();
+        m_y[index] = vector.GetY();
+        m_z[index] = vector.GetZ();
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Store(std::span<Vector3<TValueType>> vectors) const
+    {
+        if (vectors.size() != Size())
+            throw std::logic_error("Vector3Stream size mismatch");
+
+        for (std::size_t index = 0; index < vectors.size(); ++index)
+            vectors[index] = Get(index);
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* Vector3Stream<TValueType>::X(void)
+    {
+        return m_x.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* Vector3Stream<TValueType>::Y(void)
+    {
+        return m_y.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    TValueType* Vector3Stream<TValueType>::Z(void)
+    {
+        return m_z.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* Vector3Stream<TValueType>::X(void) const
+    {
+        return m_x.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* Vector3Stream<TValueType>::Y(void) const
+    {
+        return m_y.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    const TValueType* Vector3Stream<TValueType>::Z(void) const
+    {
+        return m_z.data();
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Translate(const Vector3<TValueType>& offset)
+    {
+        const TValueType        offsetX = offset.GetX();
+        const TValueType        offsetY = offset.GetY();
+        const TValueType        offsetZ = offset.GetZ();
+
+        // One loop per lane so each one vectorizes on its own
+        for (TValueType& valueX : m_x)
+            valueX += offsetX;
+
+        for (TValueType& valueY : m_y)
+            valueY += offsetY;
+
+        for (TValueType& valueZ : m_z)
+            valueZ += offsetZ;
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Scale(TValueType factor)
+    {
+        math::Scale(*this, factor, *this);
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::Normalize(void)
+    {
+        math::Normalize(*this, *this);
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Vector3Stream<TValueType>::TransformPoints(const Matrix4<TValueType>& matrix)
+    {
+        math::TransformPoints(matrix, *this, *this);
+    }
+
+
+    template <CScalarType TValueType> inline
+    Vector3Stream<TValueType>& Vector3Stream<TValueType>::operator+=(const Vector3Stream& rhs)
+    {
+        Add(*this, rhs, *this);
+        return *this;
+    }
+
+
+    template <CScalarType TValueType> inline
+    Vector3Stream<TValueType>& Vector3Stream<TValueType>::operator-=(const Vector3Stream& rhs)
+    {
+        Subtract(*this, rhs, *this);
+        return *this;
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Add
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        Vector3Stream<TValueType>& out
+    )
+    {
+        const std::size_t       size = first.Size();
+
+        if (second.Size() != size)
+            throw std::logic_error("Vector3Stream size mismatch");
+
+        out.Resize(size);
+
+        const TValueType        *firstX = first.X(), *firstY = first.Y(), *firstZ = first.Z();
+        const TValueType        *secondX = second.X(), *secondY = second.Y(), *secondZ = second.Z();
+        TValueType              *outX = out.X(), *outY = out.Y(), *outZ = out.Z();
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            outX[index] = firstX[index] + secondX[index];
+            outY[index] = firstY[index] + secondY[index];
+            outZ[index] = firstZ[index] + secondZ[index];
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Subtract
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        Vector3Stream<TValueType>& out
+    )
+    {
+        const std::size_t       size = first.Size();
+
+        if (second.Size() != size)
+            throw std::logic_error("Vector3Stream size mismatch");
+
+        out.Resize(size);
+
+        const TValueType        *firstX = first.X(), *firstY = first.Y(), *firstZ = first.Z();
+        const TValueType        *secondX = second.X(), *secondY = second.Y(), *secondZ = second.Z();
+        TValueType              *outX = out.X(), *outY = out.Y(), *outZ = out.Z();
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            outX[index] = firstX[index] - secondX[index];
+            outY[index] = firstY[index] - secondY[index];
+            outZ[index] = firstZ[index] - secondZ[index];
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Scale
+    (
+        const Vector3Stream<TValueType>& vectors, TValueType factor,
+        Vector3Stream<TValueType>& out
+    )
+    {
+        const std::size_t       size = vectors.Size();
+
+        out.Resize(size);
+
+        const TValueType        *inX = vectors.X(), *inY = vectors.Y(), *inZ = vectors.Z();
+        TValueType              *outX = out.X(), *outY = out.Y(), *outZ = out.Z();
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            outX[index] = inX[index] * factor;
+            outY[index] = inY[index] * factor;
+            outZ[index] = inZ[index] * factor;
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Dot
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        std::type_identity_t<std::span<TValueType>> out
+    )
+    {
+        const std::size_t       size = first.Size();
+
+        if (second.Size() != size || out.size() != size)
+            throw std::logic_error("Vector3Stream size mismatch");
+
+        const TValueType        *firstX = first.X(), *firstY = first.Y(), *firstZ = first.Z();
+        const TValueType        *secondX = second.X(), *secondY = second.Y(), *secondZ = second.Z();
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            out[index] = (firstX[index] * secondX[index]) +
+                         (firstY[index] * secondY[index]) +
+                         (firstZ[index] * secondZ[index]);
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Cross
+    (
+        const Vector3Stream<TValueType>& first, const Vector3Stream<TValueType>& second,
+        Vector3Stream<TValueType>& out
+    )
+    {
+        const std::size_t       size = first.Size();
+
+        if (second.Size() != size)
+            throw std::logic_error("Vector3Stream size mismatch");
+
+        out.Resize(size);
+
+        const TValueType        *firstX = first.X(), *firstY = first.Y(), *firstZ = first.Z();
+        const TValueType        *secondX = second.X(), *secondY = second.Y(), *secondZ = second.Z();
+        TValueType              *outX = out.X(), *outY = out.Y(), *outZ = out.Z();
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            // Read everything first as out may be an input
+            const TValueType    x1 = firstX[index], y1 = firstY[index], z1 = firstZ[index];
+            const TValueType    x2 = secondX[index], y2 = secondY[index], z2 = secondZ[index];
+
+            outX[index] = (y1 * z2) - (z1 * y2);
+            outY[index] = (z1 * x2) - (x1 * z2);
+            outZ[index] = (x1 * y2) - (y1 * x2);
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Normalize(const Vector3Stream<TValueType>& vectors, Vector3Stream<TValueType>& out)
+    {
+        if constexpr (std::is_integral_v<TValueType>)
+            throw std::logic_error("Cannot normalize integral vectors");
+
+        else
+        {
+            const std::size_t       size = vectors.Size();
+            std::size_t             index = 0;
+
+            out.Resize(size);
+
+            const TValueType        *inX = vectors.X(), *inY = vectors.Y(), *inZ = vectors.Z();
+            TValueType              *outX = out.X(), *outY = out.Y(), *outZ = out.Z();
+
+#ifdef MTH_SIMD_SSE
+            if constexpr (std::is_same_v<TValueType, float>)
+            {
+                const __m128    one = _mm_set1_ps(1.f);
+                const __m128    zero = _mm_setzero_ps();
+
+                // Lanes are aligned so full blocks of 4 use aligned loads
+                for (; index + 4 <= size; index += 4)
+                {
+                    const __m128    x = _mm_load_ps(inX + index);
+                    const __m128    y = _mm_load_ps(inY + index);
+                    const __m128    z = _mm_load_ps(inZ + index);
+
+                    const __m128    lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+                                                               _mm_mul_ps(z, z));
+
+                    // 1 / length, masked to 0 for zero vectors
+                    const __m128    invLength = _mm_and_ps(_mm_div_ps(one, _mm_sqrt_ps(lengthSquared)),
+                                                           _mm_cmpgt_ps(lengthSquared, zero));
+
+                    _mm_store_ps(outX + index, _mm_mul_ps(x, invLength));
+                    _mm_store_ps(outY + index, _mm_mul_ps(y, invLength));
+                    _mm_store_ps(outZ + index, _mm_mul_ps(z, invLength));
+                }
+            }
+#endif
+
+            // Remaining vectors (or all of them without SIMD)
+            for (; index < size; ++index)
+            {
+                const TValueType    x = inX[index], y = inY[index], z = inZ[index];
+                const TValueType    lengthSquared = x * x + y * y + z * z;
+
+                const TValueType    invLength = (lengthSquared > static_cast<TValueType>(0)) ?
+                                    static_cast<TValueType>(1) / SquareRoot(lengthSquared) :
+                                    static_cast<TValueType>(0);
+
+                outX[index] = x * invLength;
+                outY[index] = y * invLength;
+                outZ[index] = z * invLength;
+            }
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    void DistanceSquared
+    (
+        const Vector3Stream<TValueType>& start, const Vector3Stream<TValueType>& end,
+        std::type_identity_t<std::span<TValueType>> out
+    )
+    {
+        const std::size_t       size = start.Size();
+
+        if (end.Size() != size || out.size() != size)
+            throw std::logic_error("Vector3Stream size mismatch");
+
+        const TValueType        *startX = start.X(), *startY = start.Y(), *startZ = start.Z();
+        const TValueType        *endX = end.X(), *endY = end.Y(), *endZ = end.Z();
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            const TValueType    diffX = endX[index] - startX[index];
+            const TValueType    diffY = endY[index] - startY[index];
+            const TValueType    diffZ = endZ[index] - startZ[index];
+
+            out[index] = diffX * diffX + diffY * diffY + diffZ * diffZ;
+        }
+    }
+
+
+    template <CScalarType TValueType> inline
+    void Distance
+    (
+        const Vector3Stream<TValueType>& start, const Vector3Stream<TValueType>& end,
+        std::type_identity_t<std::span<TValueType>> out
+    )
+    {
+        DistanceSquared(start, end, out);
+
+        std::size_t             index = 0;
+
+#ifdef MTH_SIMD_SSE
+        // Output span is not guaranteed to be aligned
+        if constexpr (std::is_same_v<TValueType, float>)
+        {
+            for (; index + 4 <= out.size(); index += 4)
+                _mm_storeu_ps(out.data() + index, _mm_sqrt_ps(_mm_loadu_ps(out.data() + index)));
+        }
+#endif
+
+        for (; index < out.size(); ++index)
+            out[index] = SquareRoot(out[index]);
+    }
+
+
+    template <CScalarType TValueType> inline
+    void TransformPoints
+    (
+        const Matrix4<TValueType>& matrix, const Vector3Stream<TValueType>& points,
+        Vector3Stream<TValueType>& out
+    )
+    {
+        const std::size_t       size = points.Size();
+
+        out.Resize(size);
+
+        // Column-major: values[column * 4 + row]
+        const TValueType*       values = matrix.Data();
+
+        const TValueType        m00 = values[0], m01 = values[4], m02 = values[8], m03 = values[12];
+        const TValueType        m10 = values[1], m11 = values[5], m12 = values[9], m13 = values[13];
+        const TValueType        m20 = values[2], m21 = values[6], m22 = values[10], m23 = values[14];
+
+        const TValueType        *inX = points.X(), *inY = points.Y(), *inZ = points.Z();
+        TValueType              *outX = out.X(), *outY = out.Y(), *outZ = out.Z();
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            const TValueType    x = inX[index], y = inY[index], z = inZ[index];
+
+            outX[index] = m00 * x + m01 * y + m02 * z + m03;
+            outY[index] = m10 * x + m11 * y + m12 * z + m13;
+            outZ[index] = m20 * x + m21 * y + m22 * z + m23;
+        }
+    }
+
+}
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -1,9 +1,11 @@
 #ifndef __VECTOR4_H__
 #define __VECTOR4_H__
 
+#include <cstdint>
 #include <string>
 #include <cmath>
 #include <sstream>
+#include <span>
 
 #include "MathGeneric.hpp"
 #include "VectorGeneric.hpp"
@@ -12,6 +14,7 @@
 #include "Arithmetic.hpp"
 
 #include "Angle.hpp"
+#include "FastMath.hpp"
 
 #include "Vector3.hpp"
 
@@ -24,16 +27,16 @@ namespace math
 
 		// Constructors / destructor
 
-	inline			Vector(void) = default;
+	constexpr			Vector(void) = default;
 
-	inline
+	constexpr
 	explicit		Vector(TValueType val);
 
-	inline			Vector(TValueType x, TValueType y, TValueType z, TValueType w);
+	constexpr			Vector(TValueType x, TValueType y, TValueType z, TValueType w);
 
-	inline			Vector(const Vector<4, TValueType>& other);
+	constexpr			Vector(const Vector<4, TValueType>& other);
 
-	inline			~Vector(void) = default;
+	constexpr			~Vector(void) = default;
 
 		// Get angle from this vector to another
 	inline			Radian<TValueType>
@@ -46,62 +49,71 @@ namespace math
 					AngleFromUnit(const Vector<4, TValueType>& other)				const;
 
 		// Get distance between 2 points
-	inline	TValueType			DistanceFrom(const Vector<4, TValueType>& other)					const;
+	constexpr	TValueType			DistanceFrom(const Vector<4, TValueType>& other)					const;
 
 		// Get distance squared between two points
-	inline	TValueType			DistanceSquaredFrom(const Vector<4, TValueType>& other)			const;
+	constexpr	TValueType			DistanceSquaredFrom(const Vector<4, TValueType>& other)			const;
 
 		// Get distance between 2 points disregarding the z and w axes
-	inline	TValueType			Distance2DFrom(Vector<4, TValueType> const& other)				const;
+	constexpr	TValueType			Distance2DFrom(Vector<4, TValueType> const& other)				const;
 
 		// Get distance squared between two points disregarding the z and w axes
-	inline	TValueType			Distance2DSquaredFrom(Vector<4, TValueType> const& other)		const;
+	constexpr	TValueType			Distance2DSquaredFrom(Vector<4, TValueType> const& other)		const;
 
 		// Get distance between two points disregarding the w axis
-	inline	TValueType			Distance3DFrom(Vector<4, TValueType> const& other)				const;
+	constexpr	TValueType			Distance3DFrom(Vector<4, TValueType> const& other)				const;
 
 		// Get distance squared between two points disregarding the w axis
-	inline	TValueType			Distance3DSquaredFrom(Vector<4, TValueType> const& other)		const;
+	constexpr	TValueType			Distance3DSquaredFrom(Vector<4, TValueType> const& other)		const;
 
 
 		// Compute dot product of two vectors
-	inline	TValueType			Dot(const Vector<4, TValueType>& other)							const;
+	constexpr	TValueType			Dot(const Vector<4, TValueType>& other)							const;
 
 		// Is this vector's magnitude longer than another ?
-	inline	bool			IsLongerThan(const Vector<4, TValueType>& other)					const;
+	constexpr	bool			IsLongerThan(const Vector<4, TValueType>& other)					const;
 
 		// Is this vector's magnitude shorter than another ?
-	inline	bool			IsShorterThan(const Vector<4, TValueType>& other)				const;
+	constexpr	bool			IsShorterThan(const Vector<4, TValueType>& other)				const;
 
 		// Is this vector's magnitude equal to 1 ?
-	inline	bool			IsUnitVector(void)									const;
+	constexpr	bool			IsUnitVector(void)									const;
 
-	inline	TValueType			Magnitude(void)										const;
-	inline	TValueType			MagnitudeSquared(void)								const;
+	constexpr	TValueType			Magnitude(void)										const;
+	constexpr	TValueType			MagnitudeSquared(void)								const;
 
 		// Adjust vector to turn into unit vector
-	inline	void			Normalize(void);
+	constexpr	void			Normalize(void);
 
 		// Get copy of this vector as a unit vector
-	inline	Vector<4, TValueType>			Normalized(void)									const;
+	constexpr	Vector<4, TValueType>			Normalized(void)									const;
+
+		// Approximate Normalize using a reciprocal square root estimate,
+		// without zero magnitude check. See FastMath.hpp for precision tiers
+		template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+	inline	void			NormalizeFast(void);
+
+		// Get copy of this vector as an approximate unit vector
+		template <fast::EPrecision TPrecision = fast::EPrecision::MEDIUM>
+	inline	Vector<4, TValueType>			NormalizedFast(void)									const;
 
 		// Project this vector onto another
-	inline	void			ProjectOnto(const Vector<4, TValueType>& other);
+	constexpr	void			ProjectOnto(const Vector<4, TValueType>& other);
 
 		// Reflect this vector onto another
-	inline	void			ReflectOnto(const Vector<4, TValueType>& axis);
+	constexpr	void			ReflectOnto(const Vector<4, TValueType>& axis);
 
 		// Reflect this vector onto a UNIT vector
-	inline	void			ReflectOntoUnit(const Vector<4, TValueType>& axis);
+	constexpr	void			ReflectOntoUnit(const Vector<4, TValueType>& axis);
 
 		// Rotate this vector around the all 3 axes (not w)
-	inline	void			Rotate(Radian<TValueType> angleX, Radian<TValueType> angleY, Radian<TValueType> angleZ);
+	constexpr	void			Rotate(Radian<TValueType> angleX, Radian<TValueType> angleY, Radian<TValueType> angleZ);
 
 		// Rotate this vector around an arbitrary 3D axis
-	inline	void			Rotate(Radian<TValueType> angle, const Vector3<TValueType>& axis);
+	constexpr	void			Rotate(Radian<TValueType> angle, const Vector3<TValueType>& axis);
 
 		// Multiply this vector's components by another's
-	inline	void			Scale(const Vector<4, TValueType>& other);
+	constexpr	void			Scale(const Vector<4, TValueType>& other);
 
 		// Get components as string
 	inline	std::string		String(void)										const;
@@ -110,76 +122,76 @@ namespace math
 	inline	std::string		StringLong(void)									const;
 
 		// Add another vector's components to this one's
-	inline	void			Translate(const Vector<4, TValueType>& other);
+	constexpr	void			Translate(const Vector<4, TValueType>& other);
 
 
 		// Accessors
 
-	inline	TValueType&			X(void);
-	inline	TValueType&			Y(void);
-	inline	TValueType&			Z(void);
-	inline	TValueType&			W(void);
+	constexpr	TValueType&			X(void);
+	constexpr	TValueType&			Y(void);
+	constexpr	TValueType&			Z(void);
+	constexpr	TValueType&			W(void);
 
-	inline	TValueType			GetX(void)											const;
-	inline	TValueType			GetY(void)											const;
-	inline	TValueType			GetZ(void)											const;
-	inline	TValueType			GetW(void)											const;
+	constexpr	TValueType			GetX(void)											const;
+	constexpr	TValueType			GetY(void)											const;
+	constexpr	TValueType			GetZ(void)											const;
+	constexpr	TValueType			GetW(void)											const;
 
 
-	inline	Vector<4, TValueType>&		operator=(const Vector<4, TValueType>& rhs);
+	constexpr	Vector<4, TValueType>&		operator=(const Vector<4, TValueType>& rhs);
 
-	inline	TValueType&			operator[](int index);
-	inline	TValueType			operator[](int index)								const;
+	constexpr	TValueType&			operator[](int index);
+	constexpr	TValueType			operator[](int index)								const;
 
 
 		// Boolean test operators
 
-	inline	bool			operator==(const Vector<4, TValueType>& rhs)						const;
-	inline	bool			operator!=(const Vector<4, TValueType>& rhs)						const;
+	constexpr	bool			operator==(const Vector<4, TValueType>& rhs)						const;
+	constexpr	bool			operator!=(const Vector<4, TValueType>& rhs)						const;
 
 
 		// Component-wise operations
 
-	inline	Vector<4, TValueType>			operator+(const Vector<4, TValueType>& rhs)						const;
-	inline	Vector<4, TValueType>			operator-(const Vector<4, TValueType>& rhs)						const;
-	inline	Vector<4, TValueType>			operator*(const Vector<4, TValueType>& rhs)						const;
-	inline	Vector<4, TValueType>			operator/(const Vector<4, TValueType>& rhs)						const;
+	constexpr	Vector<4, TValueType>			operator+(const Vector<4, TValueType>& rhs)						const;
+	constexpr	Vector<4, TValueType>			operator-(const Vector<4, TValueType>& rhs)						const;
+	constexpr	Vector<4, TValueType>			operator*(const Vector<4, TValueType>& rhs)						const;
+	constexpr	Vector<4, TValueType>			operator/(const Vector<4, TValueType>& rhs)						const;
 
 
 		// Multiply all components by a single scalar
-	inline	Vector<4, TValueType>			operator*(TValueType rhs)								const;
+	constexpr	Vector<4, TValueType>			operator*(TValueType rhs)								const;
 
 		// Divide all components by a single scalar
-	inline	Vector<4, TValueType>			operator/(TValueType rhs)								const;
+	constexpr	Vector<4, TValueType>			operator/(TValueType rhs)								const;
 
 		// Flip sign of both components
-	inline	Vector<4, TValueType>			operator-(void)										const;
+	constexpr	Vector<4, TValueType>			operator-(void)										const;
 
 
 		// Component-wise operations
 
-	inline	Vector<4, TValueType>&		operator+=(const Vector<4, TValueType>& rhs);
-	inline	Vector<4, TValueType>&		operator-=(const Vector<4, TValueType>& rhs);
-	inline	Vector<4, TValueType>&		operator*=(const Vector<4, TValueType>& rhs);
-	inline	Vector<4, TValueType>&		operator/=(const Vector<4, TValueType>& rhs);
+	constexpr	Vector<4, TValueType>&		operator+=(const Vector<4, TValueType>& rhs);
+	constexpr	Vector<4, TValueType>&		operator-=(const Vector<4, TValueType>& rhs);
+	constexpr	Vector<4, TValueType>&		operator*=(const Vector<4, TValueType>& rhs);
+	constexpr	Vector<4, TValueType>&		operator/=(const Vector<4, TValueType>& rhs);
 
 		// Multiply all components by a single scalar
-	inline	Vector<4, TValueType>&		operator*=(TValueType rhs);
+	constexpr	Vector<4, TValueType>&		operator*=(TValueType rhs);
 
 		// Divide all components by a single scalar
-	inline	Vector<4, TValueType>&		operator/=(TValueType rhs);
+	constexpr	Vector<4, TValueType>&		operator/=(TValueType rhs);
 
 
 		// Constants
 
-	inline	static Vector<4, TValueType>	Zero(void);
-	inline	static Vector<4, TValueType>	One(void);
-	inline	static Vector<4, TValueType>	Up(void);
-	inline	static Vector<4, TValueType>	Down(void);
-	inline	static Vector<4, TValueType>	Left(void);
-	inline	static Vector<4, TValueType>	Right(void);
-	inline	static Vector<4, TValueType>  Back(void);
-	inline	static Vector<4, TValueType>  Front(void);
+	constexpr	static Vector<4, TValueType>	Zero(void);
+	constexpr	static Vector<4, TValueType>	One(void);
+	constexpr	static Vector<4, TValueType>	Up(void);
+	constexpr	static Vector<4, TValueType>	Down(void);
+	constexpr	static Vector<4, TValueType>	Left(void);
+	constexpr	static Vector<4, TValueType>	Right(void);
+	constexpr	static Vector<4, TValueType>  Back(void);
+	constexpr	static Vector<4, TValueType>  Front(void);
 
 
 	private:
@@ -191,37 +203,51 @@ namespace math
 	};
 
 	// Non-member functions (similar to member functions but provided for readability)
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType				Dot(const Vector<4, TValueType>& first, const Vector<4, TValueType>& second);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>				Reflect(const Vector<4, TValueType>& target, const Vector<4, TValueType>& ontoNormal);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>				ReflectUnit(const Vector<4, TValueType>& target, const Vector<4, TValueType>& ontoNormal);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>				Project(const Vector<4, TValueType>& target, const Vector<4, TValueType>& ontoVector);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>				Normalize(const Vector<4, TValueType>& target);
 
+	namespace fast
+	{
+		// Normalize every vector of an array in place, see NormalizeFast.
+		// The float and double overloads take spans or containers directly
+		template <EPrecision TPrecision = EPrecision::MEDIUM, CFloatingType TValueType> inline
+		void							Normalize(std::type_identity_t<std::span<Vector<4, TValueType>>> vectors);
+
+		template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+		void							Normalize(std::span<Vector<4, float>> vectors);
 
-	template <CScalarType TValueType> inline
+		template <EPrecision TPrecision = EPrecision::MEDIUM> inline
+		void							Normalize(std::span<Vector<4, double>> vectors);
+	}
+
+
+	template <CScalarType TValueType> constexpr
 	TValueType				Distance(const Vector<4, TValueType>& start, const Vector<4, TValueType>& end);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType				DistanceSquared(const Vector<4, TValueType>& start, const Vector<4, TValueType>& end);
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>				Rotate
 	(
 		const Vector<4, TValueType>& target, Radian<TValueType> angleX, Radian<TValueType> angleY, Radian<TValueType> angleZ
 	);
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>				Rotate
 	(
 		const Vector<4, TValueType>& target, Radian<TValueType> angle, const Vector3<TValueType>& axis
@@ -245,19 +271,19 @@ namespace math
 /// ---- Implementation ----
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>::Vector(TValueType val)
 		: m_x(val), m_y(val), m_z(val), m_w(val)
 	{}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>::Vector(TValueType x, TValueType y, TValueType z, TValueType w)
 		: m_x(x), m_y(y), m_z(z), m_w(w)
 	{}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>::Vector(const Vector<4, TValueType>& other)
 		: m_x(other.m_x), m_y(other.m_y), m_z(other.m_z), m_w(other.m_w)
 	{}
@@ -299,14 +325,14 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::DistanceFrom(const Vector<4, TValueType>& other) const
 	{
 		return SquareRoot(DistanceSquaredFrom(other));
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::DistanceSquaredFrom(const Vector<4, TValueType>& other) const
 	{
 		// Find distance vector and get magnitude
@@ -314,7 +340,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::Distance2DFrom(Vector<4, TValueType> const& other) const
 	{
 		// Ignore z and w axes
@@ -326,7 +352,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::Distance2DSquaredFrom(Vector<4, TValueType> const& other) const
 	{
 		// Ignore z and w axes
@@ -338,7 +364,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::Distance3DFrom(Vector<4, TValueType> const& other) const
 	{
 		// Ignore w axis
@@ -350,7 +376,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::Distance3DSquaredFrom(Vector<4, TValueType> const& other) const
 	{
 		// Ignore w axis
@@ -362,7 +388,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::Dot(const Vector<4, TValueType>& other) const
 	{
 		// Multiply components
@@ -371,7 +397,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<4, TValueType>::IsLongerThan(const Vector<4, TValueType>& other) const
 	{
 		// Compare squared magnitudes to avoid two sqrt calls
@@ -379,7 +405,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<4, TValueType>::IsShorterThan(const Vector<4, TValueType>& other) const
 	{
 		// Compare squared magnitudes to avoid two sqrt calls
@@ -387,7 +413,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<4, TValueType>::IsUnitVector(void) const
 	{
 		// 1 squared == 1 so avoiding sqrt call is possible
@@ -395,14 +421,14 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::Magnitude(void) const
 	{
 		return SquareRoot(MagnitudeSquared());
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::MagnitudeSquared(void) const
 	{
 		// Square components
@@ -410,7 +436,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::Normalize(void)
 	{
 		// Only divide once
@@ -432,7 +458,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Normalized(void) const
 	{
 		Vector<4, TValueType>		result = *this;
@@ -444,7 +470,38 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType>
+	template <fast::EPrecision TPrecision> inline
+	void Vector<4, TValueType>::NormalizeFast(void)
+	{
+		// Integral vectors keep the exact path
+		if constexpr (!std::is_floating_point_v<TValueType>)
+			Normalize();
+
+		else
+		{
+			TValueType		invMagnitude = fast::InverseSquareRoot<TPrecision>(MagnitudeSquared());
+
+			m_x *= invMagnitude;
+			m_y *= invMagnitude;
+			m_z *= invMagnitude;
+			m_w *= invMagnitude;
+		}
+	}
+
+
+	template <CScalarType TValueType>
+	template <fast::EPrecision TPrecision> inline
+	Vector<4, TValueType> Vector<4, TValueType>::NormalizedFast(void) const
+	{
+		Vector<4, TValueType>		result = *this;
+
+		result.template NormalizeFast<TPrecision>();
+		return result;
+	}
+
+
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::ProjectOnto(const Vector<4, TValueType>& other)
 	{
 		// Apply projection formula
@@ -458,7 +515,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::ReflectOnto(const Vector<4, TValueType>& axis)
 	{
 		// Only reflect onto unit vector
@@ -468,7 +525,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::ReflectOntoUnit(const Vector<4, TValueType>& axis)
 	{
 		// Assume normal is already unit vector and skip normalize call
@@ -477,7 +534,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::Rotate(Radian<TValueType> angleX, Radian<TValueType> angleY, Radian<TValueType> angleZ)
 	{
 		if constexpr (std::is_unsigned_v<TValueType> || std::is_integral_v<TValueType>)
@@ -488,9 +545,11 @@ namespace math
 		{
 			Vector<4, TValueType>		copy = *this;
 
-			TValueType		cosYaw = Cos(angleZ), sinYaw = Sin(angleZ);
-			TValueType		cosPitch = Cos(angleX), sinPitch = Sin(angleX);
-			TValueType		cosRoll = Cos(angleY), sinRoll = Sin(angleY);
+			TValueType		cosYaw, sinYaw, cosPitch, sinPitch, cosRoll, sinRoll;
+
+			SinCos(angleZ, sinYaw, cosYaw);
+			SinCos(angleX, sinPitch, cosPitch);
+			SinCos(angleY, sinRoll, cosRoll);
 			TValueType		rowResult;
 
 			// Create rotation matrix
@@ -542,7 +601,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::Rotate(Radian<TValueType> angle, const Vector3<TValueType>& axis)
 	{
 		// Ignore w axis
@@ -557,7 +616,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::Scale(const Vector<4, TValueType>& other)
 	{
 		*this *= other;
@@ -593,14 +652,14 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	void Vector<4, TValueType>::Translate(const Vector<4, TValueType>& other)
 	{
 		*this += other;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<4, TValueType>::X(void)
 	{
 		return m_x;
@@ -608,7 +667,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<4, TValueType>::Y(void)
 	{
 		return m_y;
@@ -616,49 +675,49 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<4, TValueType>::Z(void)
 	{
 		return m_z;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<4, TValueType>::W(void)
 	{
 		return m_w;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::GetX(void) const
 	{
 		return m_x;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::GetY(void) const
 	{
 		return m_y;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::GetZ(void) const
 	{
 		return m_z;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::GetW(void) const
 	{
 		return m_w;
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Vector<4, TValueType>::operator=(const Vector<4, TValueType>& rhs)
 	{
 		// Copy assign
@@ -671,7 +730,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType& Vector<4, TValueType>::operator[](int index)
 	{
 		switch (index)
@@ -690,7 +749,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Vector<4, TValueType>::operator[](int index) const
 	{
 		switch (index)
@@ -710,7 +769,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<4, TValueType>::operator==(const Vector<4, TValueType>& rhs) const
 	{
 		// Compare all components
@@ -726,7 +785,7 @@ namespace math
 
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	bool Vector<4, TValueType>::operator!=(const Vector<4, TValueType>& rhs) const
 	{
 		return !(*this == rhs);
@@ -736,7 +795,7 @@ namespace math
 	// Component-wise operators
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::operator+(const Vector<4, TValueType>& rhs) const
 	{
 		return Vector<4, TValueType>(m_x + rhs.m_x, m_y + rhs.m_y,
@@ -744,7 +803,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::operator-(const Vector<4, TValueType>& rhs) const
 	{
 		return Vector<4, TValueType>(m_x - rhs.m_x, m_y - rhs.m_y,
@@ -752,7 +811,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::operator*(const Vector<4, TValueType>& rhs) const
 	{
 		return Vector<4, TValueType>(m_x * rhs.m_x, m_y * rhs.m_y,
@@ -760,7 +819,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::operator/(const Vector<4, TValueType>& rhs) const
 	{
 		return Vector<4, TValueType>(m_x / rhs.m_x, m_y / rhs.m_y,
@@ -768,7 +827,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::operator*(TValueType rhs) const
 	{
 		return Vector<4, TValueType>(m_x * rhs, m_y * rhs,
@@ -776,7 +835,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::operator/(TValueType rhs) const
 	{
 		rhs = static_cast<TValueType>(1) / rhs;
@@ -785,7 +844,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::operator-(void) const
 	{
 		if constexpr (std::is_unsigned<TValueType>::value)
@@ -796,7 +855,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Vector<4, TValueType>::operator+=(const Vector<4, TValueType>& rhs)
 	{
 		m_x += rhs.m_x;
@@ -808,7 +867,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Vector<4, TValueType>::operator-=(const Vector<4, TValueType>& rhs)
 	{
 		m_x -= rhs.m_x;
@@ -820,7 +879,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Vector<4, TValueType>::operator*=(const Vector<4, TValueType>& rhs)
 	{
 		m_x *= rhs.m_x;
@@ -832,7 +891,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Vector<4, TValueType>::operator/=(const Vector<4, TValueType>& rhs)
 	{
 		m_x /= rhs.m_x;
@@ -844,7 +903,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Vector<4, TValueType>::operator*=(TValueType rhs)
 	{
 		m_x *= rhs;
@@ -856,7 +915,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType>& Vector<4, TValueType>::operator/=(TValueType rhs)
 	{
 		rhs = static_cast<TValueType>(1) / rhs;
@@ -876,14 +935,14 @@ namespace math
 	// Constants
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Zero(void)
 	{
 		return Vector<4, TValueType>();
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::One(void)
 	{
 		return Vector<4, TValueType>(static_cast<TValueType>(1), static_cast<TValueType>(1),
@@ -891,7 +950,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Up(void)
 	{
 		return Vector<4, TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(1),
@@ -899,7 +958,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Down(void)
 	{
 		return Vector<4, TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(-1),
@@ -907,7 +966,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Left(void)
 	{
 		return Vector<4, TValueType>(static_cast<TValueType>(-1), static_cast<TValueType>(0),
@@ -915,7 +974,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Right(void)
 	{
 		return Vector<4, TValueType>(static_cast<TValueType>(1), static_cast<TValueType>(0),
@@ -923,7 +982,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Back(void)
 	{
 		return Vector<4, TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(0),
@@ -931,7 +990,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Vector<4, TValueType>::Front(void)
 	{
 		return Vector<4, TValueType>(static_cast<TValueType>(0), static_cast<TValueType>(0),
@@ -942,14 +1001,14 @@ namespace math
 	// !Constants
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Dot(const Vector<4, TValueType>& first, const Vector<4, TValueType>& second)
 	{
 		return first.Dot(second);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Reflect(const Vector<4, TValueType>& target, const Vector<4, TValueType>& ontoNormal)
 	{
 		Vector<4, TValueType>		copy = target;
@@ -961,7 +1020,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> ReflectUnit(const Vector<4, TValueType>& target, const Vector<4, TValueType>& ontoNormal)
 	{
 		Vector<4, TValueType>		copy = target;
@@ -973,7 +1032,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Project(const Vector<4, TValueType>& target, const Vector<4, TValueType>& ontoVector)
 	{
 		Vector<4, TValueType>		copy = target;
@@ -985,7 +1044,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Normalize(const Vector<4, TValueType>& target)
 	{
 		// Return normalized copy
@@ -993,21 +1052,21 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType Distance(const Vector<4, TValueType>& start, const Vector<4, TValueType>& end)
 	{
 		return start.DistanceFrom(end);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	TValueType DistanceSquared(const Vector<4, TValueType>& start, const Vector<4, TValueType>& end)
 	{
 		return start.DistanceSquaredFrom(end);
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Rotate(const Vector<4, TValueType>& target, Radian<TValueType> angleX, Radian<TValueType> angleY, Radian<TValueType> angleZ)
 	{
 		Vector<4, TValueType>		copy = target;
@@ -1019,7 +1078,7 @@ namespace math
 	}
 
 
-	template <CScalarType TValueType> inline
+	template <CScalarType TValueType> constexpr
 	Vector<4, TValueType> Rotate(const Vector<4, TValueType>& target, Radian<TValueType> angle, const Vector3<TValueType>& axis)
 	{
 		Vector<4, TValueType>		copy = target;
@@ -1054,10 +1113,54 @@ namespace math
 	}
 
 
+
+	template <fast::EPrecision TPrecision, CFloatingType TValueType> inline
+	void fast::Normalize(std::type_identity_t<std::span<Vector<4, TValueType>>> vectors)
+	{
+#ifdef MTH_SIMD_SSE
+		if constexpr (std::is_same_v<TValueType, float>)
+		{
+			static_assert(sizeof(Vector<4, float>) == 4 * sizeof(float), "Vector4 must be tightly packed");
+
+			simd::NormalizeVectors4(reinterpret_cast<float*>(vectors.data()), vectors.size(),
+									static_cast<unsigned int>(TPrecision));
+			return;
+		}
+#endif
+
+		for (Vector<4, TValueType>& vector : vectors)
+			vector.template NormalizeFast<TPrecision>();
+	}
+
+
+	template <fast::EPrecision TPrecision> inline
+	void fast::Normalize(std::span<Vector<4, float>> vectors)
+	{
+		Normalize<TPrecision, float>(vectors);
+	}
+
+
+	template <fast::EPrecision TPrecision> inline
+	void fast::Normalize(std::span<Vector<4, double>> vectors)
+	{
+		Normalize<TPrecision, double>(vectors);
+	}
+
 }
 
 namespace LibMath = math;
 namespace lm = LibMath;
 
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+	extern template class Vector<4, float>;
+	extern template class Vector<4, double>;
+	extern template class Vector<4, int32_t>;
+}
+
+#endif
 
 #endif
\ No newline at end of file
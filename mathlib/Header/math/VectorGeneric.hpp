@@ -48,6 +48,18 @@ namespace math
     using Vector4i = Vector4<int32_t>;
     using Vector4d = Vector4<double>;
 
+
+    // 6D vector (e.g. rigid body state or spatial velocity), implemented
+    // by the generic fixed-size vector in VectorN.hpp
+    template <CScalarType TValueType>
+    using Vector6 = Vector<6, TValueType>;
+
+
+    // Vector6 aliases for quick use
+
+    using Vector6f = Vector6<float>;
+    using Vector6d = Vector6<double>;
+
 }
 
 
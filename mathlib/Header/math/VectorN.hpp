@@ -0,0 +1,534 @@
+#ifndef __VECTOR_N_H__
+#define __VECTOR_N_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <iostream>
+
+#include "MathGeneric.hpp"
+#include "VectorGeneric.hpp"
+#include "Arithmetic.hpp"
+
+namespace math
+{
+    namespace detail
+    {
+        // Call function(0), function(1) ... function(TCount - 1) without a
+        // loop, so fixed-size operations are always fully unrolled
+        template <std::size_t TCount, typename TFunction> constexpr
+        void                    Unroll(TFunction&& function)
+        {
+            [&]<std::size_t... TIndices>(std::index_sequence<TIndices...>)
+            {
+                (function(TIndices), ...);
+            }
+            (std::make_index_sequence<TCount>{});
+        }
+    }
+
+
+    // Generic fixed-size vector, used for every dimension without a
+    // hand-written specialization (Vector2, Vector3 and Vector4 keep theirs)
+    template <uint8_t TDimensions, CScalarType TValueType>
+    class Vector
+    {
+        static_assert(TDimensions > 0, "Vector must have at least one component");
+
+    public:
+
+        // Constructors / destructor
+
+        constexpr                   Vector(void) = default;
+
+        // Set all components to the same value
+        constexpr explicit          Vector(TValueType value);
+
+        // One value per component
+        template <CScalarType... TArgs>
+            requires (sizeof...(TArgs) == TDimensions && TDimensions > 1)
+        constexpr                   Vector(TArgs... values);
+
+        constexpr                   Vector(const Vector& other) = default;
+
+        constexpr                   ~Vector(void) = default;
+
+        // Compute dot product of two vectors
+        constexpr TValueType        Dot(const Vector& other)                    const;
+
+        // Get distance between 2 points
+        constexpr TValueType        DistanceFrom(const Vector& other)           const;
+
+        // Get distance squared between two points
+        constexpr TValueType        DistanceSquaredFrom(const Vector& other)    const;
+
+        // Is this vector's magnitude equal to 1 ?
+        constexpr bool              IsUnitVector(void)                          const;
+
+        constexpr TValueType        Magnitude(void)                             const;
+        constexpr TValueType        MagnitudeSquared(void)                      const;
+
+        // Adjust vector to turn into unit vector
+        constexpr void              Normalize(void);
+
+        // Get copy of this vector as a unit vector
+        constexpr Vector            Normalized(void)                            const;
+
+        // Multiply this vector's components by another's
+        constexpr void              Scale(const Vector& other);
+
+        // Add another vector's components to this one's
+        constexpr void              Translate(const Vector& other);
+
+        // Number of components
+        static constexpr uint8_t    Size(void) { return TDimensions; }
+
+        // Contiguous components
+        constexpr TValueType*       Data(void)                                  { return m_values; }
+        constexpr const TValueType* Data(void)                                  const { return m_values; }
+
+
+        constexpr Vector&           operator=(const Vector& rhs) = default;
+
+        constexpr TValueType&       operator[](int index);
+        constexpr TValueType        operator[](int index)                       const;
+
+        // Boolean test operators
+
+        constexpr bool              operator==(const Vector& rhs)               const;
+        constexpr bool              operator!=(const Vector& rhs)               const;
+
+        // Component-wise operations
+
+        constexpr Vector            operator+(const Vector& rhs)                const;
+        constexpr Vector            operator-(const Vector& rhs)                const;
+        constexpr Vector            operator*(const Vector& rhs)                const;
+        constexpr Vector            operator/(const Vector& rhs)                const;
+
+        // Multiply all components by a single scalar
+        constexpr Vector            operator*(TValueType rhs)                   const;
+
+        // Divide all components by a single scalar
+        constexpr Vector            operator/(TValueType rhs)                   const;
+
+        // Flip sign of all components
+        constexpr Vector            operator-(void)                             const;
+
+        // Component-wise operations
+
+        constexpr Vector&           operator+=(const Vector& rhs);
+        constexpr Vector&           operator-=(const Vector& rhs);
+        constexpr Vector&           operator*=(const Vector& rhs);
+        constexpr Vector&           operator/=(const Vector& rhs);
+
+        // Multiply all components by a single scalar
+        constexpr Vector&           operator*=(TValueType rhs);
+
+        // Divide all components by a single scalar
+        constexpr Vector&           operator/=(TValueType rhs);
+
+        // Constants
+
+        constexpr static Vector     Zero(void);
+        constexpr static Vector     One(void);
+
+        // Unit vector along one axis
+        constexpr static Vector     Axis(int index);
+
+    private:
+
+        TValueType                  m_values[TDimensions]{};
+    };
+
+
+    // Non-member functions (similar to member functions but provided for readability)
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType                  Dot(const Vector<TDimensions, TValueType>& first,
+                                    const Vector<TDimensions, TValueType>& second);
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType                  Distance(const Vector<TDimensions, TValueType>& start,
+                                         const Vector<TDimensions, TValueType>& end);
+
+    // Multiply all components by a single scalar
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> operator*(TValueType lhs, const Vector<TDimensions, TValueType>& rhs)
+        requires (TDimensions > 4);
+
+    // Pass components to stream
+    template <uint8_t TDimensions, CScalarType TValueType> inline
+    std::ostream&               operator<<(std::ostream& os, const Vector<TDimensions, TValueType>& vector)
+        requires (TDimensions > 4);
+
+    // Get components from an input stream
+    template <uint8_t TDimensions, CScalarType TValueType> inline
+    std::istream&               operator>>(std::istream& is, Vector<TDimensions, TValueType>& vector)
+        requires (TDimensions > 4);
+
+
+    // ---- Implementation ---
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType>::Vector(TValueType value)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index) { m_values[index] = value; });
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType>
+    template <CScalarType... TArgs>
+        requires (sizeof...(TArgs) == TDimensions && TDimensions > 1)
+    constexpr Vector<TDimensions, TValueType>::Vector(TArgs... values)
+        : m_values{ static_cast<TValueType>(values)... }
+    {
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Vector<TDimensions, TValueType>::Dot(const Vector& other) const
+    {
+        TValueType      result = static_cast<TValueType>(0);
+
+        detail::Unroll<TDimensions>([&](std::size_t index) { result += m_values[index] * other.m_values[index]; });
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Vector<TDimensions, TValueType>::DistanceFrom(const Vector& other) const
+    {
+        return SquareRoot(DistanceSquaredFrom(other));
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Vector<TDimensions, TValueType>::DistanceSquaredFrom(const Vector& other) const
+    {
+        return (*this - other).MagnitudeSquared();
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool Vector<TDimensions, TValueType>::IsUnitVector(void) const
+    {
+        // 1 squared == 1 so avoiding sqrt call is possible
+        return AlmostEqual(MagnitudeSquared(), static_cast<TValueType>(1));
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Vector<TDimensions, TValueType>::Magnitude(void) const
+    {
+        return SquareRoot(MagnitudeSquared());
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Vector<TDimensions, TValueType>::MagnitudeSquared(void) const
+    {
+        return Dot(*this);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    void Vector<TDimensions, TValueType>::Normalize(void)
+    {
+        TValueType      invMagnitude = Magnitude();
+
+        if (AlmostEqual(invMagnitude, static_cast<TValueType>(0), std::numeric_limits<TValueType>::epsilon()))
+            throw std::logic_error("Cannot divide by zero magnitude");
+
+        // Only divide once
+        invMagnitude = static_cast<TValueType>(1) / invMagnitude;
+
+        *this *= invMagnitude;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::Normalized(void) const
+    {
+        Vector      result = *this;
+
+        result.Normalize();
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    void Vector<TDimensions, TValueType>::Scale(const Vector& other)
+    {
+        *this *= other;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    void Vector<TDimensions, TValueType>::Translate(const Vector& other)
+    {
+        *this += other;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType& Vector<TDimensions, TValueType>::operator[](int index)
+    {
+        if (index < 0 || index >= TDimensions)
+            throw std::logic_error("Vector index out of range");
+
+        return m_values[index];
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Vector<TDimensions, TValueType>::operator[](int index) const
+    {
+        if (index < 0 || index >= TDimensions)
+            throw std::logic_error("Vector index out of range");
+
+        return m_values[index];
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool Vector<TDimensions, TValueType>::operator==(const Vector& rhs) const
+    {
+        // Compare all components
+        bool        equal = true;
+
+        detail::Unroll<TDimensions>([&](std::size_t index)
+        {
+            equal = equal && AlmostEqual(m_values[index], rhs.m_values[index]);
+        });
+
+        return equal;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    bool Vector<TDimensions, TValueType>::operator!=(const Vector& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::operator+(const Vector& rhs) const
+    {
+        Vector      result = *this;
+
+        return result += rhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::operator-(const Vector& rhs) const
+    {
+        Vector      result = *this;
+
+        return result -= rhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::operator*(const Vector& rhs) const
+    {
+        Vector      result = *this;
+
+        return result *= rhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::operator/(const Vector& rhs) const
+    {
+        Vector      result = *this;
+
+        return result /= rhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::operator*(TValueType rhs) const
+    {
+        Vector      result = *this;
+
+        return result *= rhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::operator/(TValueType rhs) const
+    {
+        Vector      result = *this;
+
+        return result /= rhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::operator-(void) const
+    {
+        if constexpr (std::is_unsigned<TValueType>::value)
+            return *this;
+
+        else
+        {
+            Vector      result;
+
+            detail::Unroll<TDimensions>([&](std::size_t index) { result.m_values[index] = -m_values[index]; });
+            return result;
+        }
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType>& Vector<TDimensions, TValueType>::operator+=(const Vector& rhs)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index) { m_values[index] += rhs.m_values[index]; });
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType>& Vector<TDimensions, TValueType>::operator-=(const Vector& rhs)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index) { m_values[index] -= rhs.m_values[index]; });
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType>& Vector<TDimensions, TValueType>::operator*=(const Vector& rhs)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index) { m_values[index] *= rhs.m_values[index]; });
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType>& Vector<TDimensions, TValueType>::operator/=(const Vector& rhs)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index) { m_values[index] /= rhs.m_values[index]; });
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType>& Vector<TDimensions, TValueType>::operator*=(TValueType rhs)
+    {
+        detail::Unroll<TDimensions>([&](std::size_t index) { m_values[index] *= rhs; });
+        return *this;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType>& Vector<TDimensions, TValueType>::operator/=(TValueType rhs)
+    {
+        // Only divide once for floating point types
+        if constexpr (std::is_floating_point_v<TValueType>)
+            return *this *= static_cast<TValueType>(1) / rhs;
+
+        else
+        {
+            detail::Unroll<TDimensions>([&](std::size_t index) { m_values[index] /= rhs; });
+            return *this;
+        }
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::Zero(void)
+    {
+        return Vector(static_cast<TValueType>(0));
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::One(void)
+    {
+        return Vector(static_cast<TValueType>(1));
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> Vector<TDimensions, TValueType>::Axis(int index)
+    {
+        Vector      result(static_cast<TValueType>(0));
+
+        result[index] = static_cast<TValueType>(1);
+        return result;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Dot(const Vector<TDimensions, TValueType>& first, const Vector<TDimensions, TValueType>& second)
+    {
+        return first.Dot(second);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    TValueType Distance(const Vector<TDimensions, TValueType>& start, const Vector<TDimensions, TValueType>& end)
+    {
+        return start.DistanceFrom(end);
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> constexpr
+    Vector<TDimensions, TValueType> operator*(TValueType lhs, const Vector<TDimensions, TValueType>& rhs)
+        requires (TDimensions > 4)
+    {
+        return rhs * lhs;
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> inline
+    std::ostream& operator<<(std::ostream& os, const Vector<TDimensions, TValueType>& vector)
+        requires (TDimensions > 4)
+    {
+        // Pass components to stream
+        os << '{';
+
+        for (int index = 0; index < TDimensions; ++index)
+            os << (index ? "," : "") << vector[index];
+
+        return os << '}';
+    }
+
+
+    template <uint8_t TDimensions, CScalarType TValueType> inline
+    std::istream& operator>>(std::istream& is, Vector<TDimensions, TValueType>& vector)
+        requires (TDimensions > 4)
+    {
+        char        discard;
+
+        // Get input from stream, separators are discarded
+        is >> discard;
+
+        for (int index = 0; index < TDimensions; ++index)
+            is >> vector[index] >> discard;
+
+        return is;
+    }
+}
+
+#ifdef MTH_EXTERN_TEMPLATES
+
+// Instantiated once in the mathlib static lib (Instanciations.cpp)
+namespace math
+{
+    extern template class Vector<6, float>;
+    extern template class Vector<6, double>;
+    extern template class Vector<6, int32_t>;
+}
+
+#endif
+
+namespace LibMath = math;
+namespace lm = math;
+
+#endif
@@ -6,134 +6,229 @@
 #include "math/Matrix3.hpp"
 #include "math/Matrix4.hpp"
 
+#include "math/VectorN.hpp"
+#include "math/MatrixN.hpp"
+
 #include "math/Quaternion.hpp"
+#include "math/Affine3.hpp"
+#include "math/DualQuaternion.hpp"
+#include "math/TransformHierarchy.hpp"
+#include "math/AABB.hpp"
+#include "math/BVH.hpp"
+
+#include <cstdint>
+
+// With MTH_EXTERN_TEMPLATES, only float, double and int32 are compiled here
+// and the headers declare them extern so consumers do not instantiate them
 
 namespace math
 {
-	template Vector<2, float>;
-	template Vector<2, double>;
-	template Vector<2, long double>;
+	template class Vector<2, float>;
+	template class Vector<2, double>;
+	template class Vector<2, int32_t>;
+
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Vector<2, long double>;
+
+	template class Vector<2, unsigned int>;
+
+	template class Vector<2, short>;
+	template class Vector<2, unsigned short>;
+
+	template class Vector<2, long>;
+	template class Vector<2, unsigned long>;
+
+	template class Vector<2, long long>;
+	template class Vector<2, unsigned long long>;
+
+	template class Vector<2, char>;
+	template class Vector<2, unsigned char>;
+#endif
+
+
+	template class Vector<3, float>;
+	template class Vector<3, double>;
+	template class Vector<3, int32_t>;
+
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Vector<3, long double>;
+
+	template class Vector<3, unsigned int>;
+
+	template class Vector<3, short>;
+	template class Vector<3, unsigned short>;
+
+	template class Vector<3, long>;
+	template class Vector<3, unsigned long>;
+
+	template class Vector<3, long long>;
+	template class Vector<3, unsigned long long>;
+
+	template class Vector<3, char>;
+	template class Vector<3, unsigned char>;
+#endif
+
+
+	template class Vector<4, float>;
+	template class Vector<4, double>;
+	template class Vector<4, int32_t>;
+
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Vector<4, long double>;
+
+	template class Vector<4, unsigned int>;
+
+	template class Vector<4, short>;
+	template class Vector<4, unsigned short>;
+
+	template class Vector<4, long>;
+	template class Vector<4, unsigned long>;
+
+	template class Vector<4, long long>;
+	template class Vector<4, unsigned long long>;
+
+	template class Vector<4, char>;
+	template class Vector<4, unsigned char>;
+#endif
+
+
+	template class Matrix<2, float>;
+	template class Matrix<2, double>;
+	template class Matrix<2, int32_t>;
+
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Matrix<2, long double>;
+
+	template class Matrix<2, unsigned int>;
 
-	template Vector<2, int>;
-	template Vector<2, unsigned int>;
+	template class Matrix<2, short>;
+	template class Matrix<2, unsigned short>;
 
-	template Vector<2, short>;
-	template Vector<2, unsigned short>;
+	template class Matrix<2, long>;
+	template class Matrix<2, unsigned long>;
 
-	template Vector<2, long>;
-	template Vector<2, unsigned long>;
+	template class Matrix<2, long long>;
+	template class Matrix<2, unsigned long long>;
 
-	template Vector<2, long long>;
-	template Vector<2, unsigned long long>;
+	template class Matrix<2, char>;
+	template class Matrix<2, unsigned char>;
+#endif
 
-	template Vector<2, char>;
-	template Vector<2, unsigned char>;
 
+	template class Matrix<3, float>;
+	template class Matrix<3, double>;
+	template class Matrix<3, int32_t>;
 
-	template Vector<3, float>;
-	template Vector<3, double>;
-	template Vector<3, long double>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Matrix<3, long double>;
 
-	template Vector<3, int>;
-	template Vector<3, unsigned int>;
+	template class Matrix<3, unsigned int>;
 
-	template Vector<3, short>;
-	template Vector<3, unsigned short>;
+	template class Matrix<3, short>;
+	template class Matrix<3, unsigned short>;
 
-	template Vector<3, long>;
-	template Vector<3, unsigned long>;
+	template class Matrix<3, long>;
+	template class Matrix<3, unsigned long>;
 
-	template Vector<3, long long>;
-	template Vector<3, unsigned long long>;
+	template class Matrix<3, long long>;
+	template class Matrix<3, unsigned long long>;
 
-	template Vector<3, char>;
-	template Vector<3, unsigned char>;
+	template class Matrix<3, char>;
+	template class Matrix<3, unsigned char>;
+#endif
 
 
-	template Vector<4, float>;
-	template Vector<4, double>;
-	template Vector<4, long double>;
+	template class Matrix<4, float>;
+	template class Matrix<4, double>;
+	template class Matrix<4, int32_t>;
 
-	template Vector<4, int>;
-	template Vector<4, unsigned int>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Matrix<4, long double>;
 
-	template Vector<4, short>;
-	template Vector<4, unsigned short>;
+	template class Matrix<4, unsigned int>;
 
-	template Vector<4, long>;
-	template Vector<4, unsigned long>;
+	template class Matrix<4, short>;
+	template class Matrix<4, unsigned short>;
 
-	template Vector<4, long long>;
-	template Vector<4, unsigned long long>;
+	template class Matrix<4, long>;
+	template class Matrix<4, unsigned long>;
 
-	template Vector<4, char>;
-	template Vector<4, unsigned char>;
+	template class Matrix<4, long long>;
+	template class Matrix<4, unsigned long long>;
 
+	template class Matrix<4, char>;
+	template class Matrix<4, unsigned char>;
+#endif
 
-	template Matrix<2, float>;
-	template Matrix<2, double>;
-	template Matrix<2, long double>;
 
-	template Matrix<2, int>;
-	template Matrix<2, unsigned int>;
+	template class Vector<6, float>;
+	template class Vector<6, double>;
+	template class Vector<6, int32_t>;
 
-	template Matrix<2, short>;
-	template Matrix<2, unsigned short>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Vector<6, long double>;
+#endif
 
-	template Matrix<2, long>;
-	template Matrix<2, unsigned long>;
 
-	template Matrix<2, long long>;
-	template Matrix<2, unsigned long long>;
+	template class Matrix<6, float>;
+	template class Matrix<6, double>;
+	template class Matrix<6, int32_t>;
 
-	template Matrix<2, char>;
-	template Matrix<2, unsigned char>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Matrix<6, long double>;
+#endif
 
 
+	template class Quaternion<float>;
+	template class Quaternion<double>;
 
-	template Matrix<3, float>;
-	template Matrix<3, double>;
-	template Matrix<3, long double>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Quaternion<long double>;
+#endif
 
-	template Matrix<3, int>;
-	template Matrix<3, unsigned int>;
 
-	template Matrix<3, short>;
-	template Matrix<3, unsigned short>;
+	template class Affine3<float>;
+	template class Affine3<double>;
 
-	template Matrix<3, long>;
-	template Matrix<3, unsigned long>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class Affine3<long double>;
+#endif
 
-	template Matrix<3, long long>;
-	template Matrix<3, unsigned long long>;
 
-	template Matrix<3, char>;
-	template Matrix<3, unsigned char>;
+	template class DualQuaternion<float>;
+	template class DualQuaternion<double>;
 
+#ifndef MTH_EXTERN_TEMPLATES
+	template class DualQuaternion<long double>;
+#endif
 
-	template Matrix<4, float>;
-	template Matrix<4, double>;
-	template Matrix<4, long double>;
 
-	template Matrix<4, int>;
-	template Matrix<4, unsigned int>;
+	template class TransformHierarchy<float>;
+	template class TransformHierarchy<double>;
 
-	template Matrix<4, short>;
-	template Matrix<4, unsigned short>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class TransformHierarchy<long double>;
+#endif
 
-	template Matrix<4, long>;
-	template Matrix<4, unsigned long>;
 
-	template Matrix<4, long long>;
-	template Matrix<4, unsigned long long>;
+	template class AABB<2, float>;
+	template class AABB<2, double>;
+	template class AABB<3, float>;
+	template class AABB<3, double>;
 
-	template Matrix<4, char>;
-	template Matrix<4, unsigned char>;
+#ifndef MTH_EXTERN_TEMPLATES
+	template class AABB<2, long double>;
+	template class AABB<3, long double>;
+#endif
 
-	
-	template Quaternion<float>;
-	template Quaternion<double>;
-	template Quaternion<long double>;
 
+	template class BVH<float>;
+	template class BVH<double>;
+	template class TriangleBVH<float>;
+	template class TriangleBVH<double>;
 
-}
\ No newline at end of file
+#ifndef MTH_EXTERN_TEMPLATES
+	template class BVH<long double>;
+	template class TriangleBVH<long double>;
+#endif
+}